@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Set of 2D primitives split into spatial chunks, drawn only where visible
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ChunkedVertexArray : public Drawable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty array with a type and a chunk size
+    ///
+    /// \param type      Type of primitives
+    /// \param chunkSize Size of the chunks, in local coordinates; both components must be positive
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ChunkedVertexArray(PrimitiveType type = PrimitiveType::Triangles, Vector2f chunkSize = {512.f, 512.f});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add primitives to the array
+    ///
+    /// Each primitive is stored in the chunk which contains its
+    /// center. Trailing vertices which don't form a complete
+    /// primitive are ignored.
+    ///
+    /// Strips and fans can't be split across chunks: they are
+    /// converted to lists of lines or triangles, and each call
+    /// starts a new strip or fan.
+    ///
+    /// \param vertices    Pointer to the vertices of the primitives
+    /// \param vertexCount Number of vertices in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void append(const Vertex* vertices, std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the primitives from the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the vertex count
+    ///
+    /// Strips and fans count the vertices of the lists they
+    /// were converted to.
+    ///
+    /// \return Number of vertices stored in all the chunks
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getVertexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the number of chunks holding primitives
+    ///
+    /// \return Number of non-empty chunks
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getChunkCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the type of primitives given at construction
+    ///
+    /// \return Primitive type
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] PrimitiveType getPrimitiveType() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the chunks
+    ///
+    /// \return Size of the chunks, in local coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getChunkSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the bounding rectangle of the array
+    ///
+    /// The bounds of the chunks are maintained as primitives
+    /// are added, so this function doesn't iterate over the
+    /// vertices.
+    ///
+    /// \return Bounding rectangle of the array
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getBounds() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the visible chunks to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store a primitive in the chunk containing its center
+    ///
+    /// \param vertices    Pointers to the vertices of the primitive
+    /// \param vertexCount Number of vertices of the primitive (1 to 3)
+    ///
+    ////////////////////////////////////////////////////////////
+    void addPrimitive(const Vertex* const* vertices, std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Primitives located in a cell of the grid
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        std::vector<Vertex> vertices; //!< Vertices of the primitives, in list form
+        FloatRect           bounds;   //!< Bounding rectangle of the vertices
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::map<std::pair<int, int>, Chunk> m_chunks;        //!< Non-empty chunks, indexed by row and column
+    PrimitiveType                        m_primitiveType; //!< Type of primitives given at construction
+    Vector2f                             m_chunkSize;     //!< Size of the chunks
+    std::size_t                          m_vertexCount{}; //!< Number of vertices in all the chunks
+    FloatRect                            m_bounds;        //!< Bounding rectangle of all the chunks
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ChunkedVertexArray
+/// \ingroup graphics
+///
+/// `sf::ChunkedVertexArray` stores primitives like `sf::VertexArray`,
+/// but spreads them over a grid of chunks according to their
+/// position. When it is drawn, the chunks whose bounds are outside
+/// the view of the render target are skipped without reading their
+/// vertices, so a large world only costs the chunks that are on
+/// screen. The skipped chunks are counted as culled draw calls in
+/// the frame statistics of the render target.
+///
+/// Chunks are drawn in row-major order and each one with its own
+/// draw call. Primitives which belong to different chunks may
+/// therefore not be drawn in the order they were added; this class
+/// is meant for geometry whose primitives don't overlap, such as
+/// terrain or tiles. The chunk size is a trade-off between the
+/// number of draw calls and the amount of off-screen geometry drawn,
+/// a few times the size of the view is a good start.
+///
+/// Like `sf::VertexArray`, it inherits `sf::Drawable` but is not
+/// transformable; the transform of the render states is accounted
+/// for when culling the chunks.
+///
+/// Example:
+/// \code
+/// sf::ChunkedVertexArray terrain(sf::PrimitiveType::Triangles, {1024.f, 1024.f});
+/// for (const auto& cell : world)
+///     terrain.append(cell.vertices.data(), cell.vertices.size());
+/// ...
+/// window.draw(terrain);
+/// \endcode
+///
+/// \see `sf::VertexArray`, `sf::RenderTarget::cull`
+///
+////////////////////////////////////////////////////////////
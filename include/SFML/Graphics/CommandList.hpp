@@ -0,0 +1,275 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class RenderTarget;
+class VertexArray;
+
+////////////////////////////////////////////////////////////
+/// \brief List of draw calls recorded without OpenGL, to be submitted to a render target later
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API CommandList
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the view used by the next draws
+    ///
+    /// Until this function is called, draws use the view that
+    /// the render target has when the list is submitted.
+    ///
+    /// \param view New view to use
+    ///
+    /// \see `setLayer`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setView(const View& view);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the layer of the next draws
+    ///
+    /// Layers only matter when the list is sorted: draws of lower
+    /// layers are then submitted first. The default layer is 0.
+    ///
+    /// \param layer New layer
+    ///
+    /// \see `getLayer`, `sort`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLayer(int layer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the layer of the next draws
+    ///
+    /// \return Current layer
+    ///
+    /// \see `setLayer`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] int getLayer() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record primitives defined by an array of vertices
+    ///
+    /// The vertices are copied. Without a shader, they are also
+    /// transformed by `states.transform`, and strips and fans are
+    /// converted to lists, so that the draw can be merged with
+    /// the previous one if their other states are the same.
+    ///
+    /// The texture and the shader of \p states must still be
+    /// alive when the list is submitted. Shader uniforms are read
+    /// when the list is submitted, not when the draw is recorded.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*       vertices,
+              std::size_t         vertexCount,
+              PrimitiveType       type,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the primitives of a vertex array
+    ///
+    /// \param vertexArray Vertex array to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexArray& vertexArray, const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append the draws of another list
+    ///
+    /// This is how lists recorded on several threads are gathered
+    /// before being submitted. The draws of \p commandList keep
+    /// their views and layers; the view and layer used by the
+    /// next draws of this list are not changed.
+    ///
+    /// \param commandList List to append
+    ///
+    ////////////////////////////////////////////////////////////
+    void append(const CommandList& commandList);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reorder the draws to group those sharing the same states
+    ///
+    /// Draws are sorted by layer, then by shader, texture and
+    /// primitive type, and the draws which can share a draw call
+    /// are merged. Draws never move across a view change, and
+    /// the order of draws with the same key is preserved.
+    ///
+    /// Sorting changes the order in which primitives are drawn,
+    /// so it is only correct when the draws of a layer don't
+    /// overlap or don't depend on each other, for example with
+    /// opaque tiles or additive particles.
+    ///
+    ////////////////////////////////////////////////////////////
+    void sort();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the draws and reset the view and layer
+    ///
+    /// The memory is kept, so that the list can be recorded again
+    /// without allocating.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of draw calls that submitting the list will issue
+    ///
+    /// \return Number of draw commands, after merging
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCommandCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of vertices recorded
+    ///
+    /// \return Number of vertices in all the draw commands
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getVertexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the recorded primitives to a render target
+    ///
+    /// This function must be called on the thread where the
+    /// render target can be activated. The view is only changed
+    /// when the draws require it, and the view that the target
+    /// had before is restored at the end. The list is left
+    /// untouched and can be submitted again.
+    ///
+    /// \param target Render target to draw to
+    ///
+    ////////////////////////////////////////////////////////////
+    void submit(RenderTarget& target) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw call of the list
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Command
+    {
+        RenderStates  states;        //!< Render states, with an identity transform unless a shader is used
+        PrimitiveType type{};        //!< Type of primitives
+        std::size_t   firstVertex{}; //!< Index of the first vertex of the command
+        std::size_t   vertexCount{}; //!< Number of vertices of the command
+        std::size_t   view{};        //!< Index of the view in the list, `noView` for the view of the target
+        int           layer{};       //!< Layer used when sorting
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Merge a command into the last one if they can share a draw call
+    ///
+    /// The vertices of \p command must directly follow those of
+    /// the last command.
+    ///
+    /// \param command Command to add
+    ///
+    ////////////////////////////////////////////////////////////
+    void addCommand(const Command& command);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t noView = static_cast<std::size_t>(-1); //!< Index standing for the view of the target
+
+    std::vector<Command> m_commands;            //!< Recorded draw commands
+    std::vector<Vertex>  m_vertices;            //!< Vertices of all the commands
+    std::vector<View>    m_views;               //!< Views used by the commands
+    std::size_t          m_currentView{noView}; //!< Index of the view used by the next draws
+    int                  m_currentLayer{};      //!< Layer of the next draws
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::CommandList
+/// \ingroup graphics
+///
+/// `sf::RenderTarget` must be used on the thread where its OpenGL
+/// context is active, which makes the traversal of a scene single
+/// threaded. `sf::CommandList` records draw calls without touching
+/// OpenGL: the vertices are copied, and transformed on the calling
+/// thread when no shader is used. Several lists can therefore be
+/// recorded in parallel on worker threads, each thread using its
+/// own list, then gathered with `append` and submitted to the
+/// render target in a single call.
+///
+/// Consecutive draws which only differ by their transform are
+/// merged into one draw call while recording, the same way
+/// `sf::RenderTarget` batches draws. `sort` goes further by
+/// grouping the draws of a layer which share the same texture
+/// and shader, when their order doesn't matter.
+///
+/// The textures and shaders given in the render states are only
+/// referenced, they must stay alive until the list is submitted.
+///
+/// Usage example:
+/// \code
+/// std::vector<sf::CommandList> lists(workerCount);
+///
+/// // On each worker thread
+/// for (const Entity& entity : entitiesOfThisWorker)
+/// {
+///     lists[worker].setLayer(entity.layer);
+///     lists[worker].draw(entity.vertices.data(), entity.vertices.size(), sf::PrimitiveType::Triangles, entity.states);
+/// }
+///
+/// // On the main thread, once all the workers are done
+/// sf::CommandList frame;
+/// for (const sf::CommandList& list : lists)
+///     frame.append(list);
+/// frame.sort();
+/// frame.submit(window);
+/// \endcode
+///
+/// \see `sf::RenderTarget`, `sf::VertexArray`
+///
+////////////////////////////////////////////////////////////
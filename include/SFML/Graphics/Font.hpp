@@ -33,10 +33,13 @@
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <SFML/System/String.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <deque>
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -69,13 +72,59 @@ public:
         bool          hasVerticalMetrics{}; //!< Has native vertical metrics
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Occupancy statistics of the textures holding the glyphs
+    ///
+    ////////////////////////////////////////////////////////////
+    struct AtlasStatistics
+    {
+        std::size_t   textureCount{}; //!< Number of textures holding glyphs
+        std::size_t   glyphCount{};   //!< Number of glyphs packed into the textures
+        std::uint64_t textureArea{};  //!< Total area of the textures, in pixels
+        std::uint64_t usedArea{};     //!< Area occupied by the glyphs (padding included), in pixels
+        std::uint64_t wastedArea{};   //!< Area trapped below packed glyphs that can no longer be used, in pixels
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
     /// Construct an empty font that does not contain any glyphs.
     ///
     ////////////////////////////////////////////////////////////
-    Font() = default;
+    Font();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~Font();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// Glyphs still being loaded asynchronously by `copy`
+    /// are not copied, they are loaded again when needed.
+    ///
+    ////////////////////////////////////////////////////////////
+    Font(const Font& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    Font& operator=(const Font& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    Font(Font&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    Font& operator=(Font&&) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct the font from a file
@@ -262,6 +311,80 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] const Glyph& getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the glyphs of a set of characters ahead of time
+    ///
+    /// Glyphs are normally loaded the first time they are
+    /// requested, which may cause a hitch when a text using
+    /// many new characters is displayed. This function allows
+    /// to load them in advance, for example while a level loads.
+    ///
+    /// If asynchronous loading is enabled, the glyphs are
+    /// loaded in the background and this function returns
+    /// immediately.
+    ///
+    /// \param characters       Characters whose glyphs should be loaded
+    /// \param characterSize    Reference character size
+    /// \param bold             Load the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+    ///
+    /// \see `setAsyncLoadingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void preloadGlyphs(const String& characters,
+                       unsigned int  characterSize,
+                       bool          bold             = false,
+                       float         outlineThickness = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable asynchronous glyph loading
+    ///
+    /// When asynchronous loading is enabled, glyphs that are not
+    /// loaded yet are rasterized by a worker thread instead of
+    /// blocking the caller. Until a glyph is available, `getGlyph`
+    /// returns an empty glyph; `sf::Text` takes care of updating
+    /// its geometry once the missing glyphs are loaded.
+    ///
+    /// Loaded glyphs are written to the font textures by the
+    /// thread using the font, the next time glyphs are requested.
+    ///
+    /// The worker thread uses its own copy of the font data,
+    /// which is read from the source of the font when it is
+    /// opened or when asynchronous loading is enabled.
+    ///
+    /// Asynchronous loading is disabled by default.
+    ///
+    /// \param enabled `true` to enable asynchronous loading, `false` to disable it
+    ///
+    /// \see `isAsyncLoadingEnabled`, `getPendingGlyphCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAsyncLoadingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether asynchronous glyph loading is enabled or not
+    ///
+    /// \return `true` if asynchronous loading is enabled, `false` if it is disabled
+    ///
+    /// \see `setAsyncLoadingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isAsyncLoadingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of glyphs still being loaded asynchronously
+    ///
+    /// Glyphs which finished loading are added to the font by
+    /// this function, so that it can be polled to wait for the
+    /// glyphs requested with `preloadGlyphs`.
+    ///
+    /// \return Number of glyphs requested but not available yet
+    ///
+    /// \see `setAsyncLoadingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPendingGlyphCount() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Determine if this font has a glyph representing the requested code point
     ///
@@ -403,18 +526,60 @@ public:
     [[nodiscard]] float getUnderlineThickness(unsigned int characterSize) const;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Retrieve the texture containing the loaded glyphs of a certain size
+    /// \brief Retrieve a texture containing the loaded glyphs of a certain size
     ///
     /// The contents of the returned texture changes as more glyphs
     /// are requested, thus it is not very relevant. It is mainly
     /// used internally by `sf::Text`.
     ///
+    /// Glyphs of a given size are packed into a single texture
+    /// which grows as needed. Once it reaches the maximum texture
+    /// size, additional textures are created; the texture holding
+    /// a glyph is given by `sf::Glyph::textureIndex`.
+    ///
     /// \param characterSize Reference character size
+    /// \param index         Index of the texture, must be lower than `getTextureCount(characterSize)`
     ///
     /// \return Texture containing the glyphs of the requested size
     ///
+    /// \see `getTextureCount`
+    ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] const Texture& getTexture(unsigned int characterSize) const;
+    [[nodiscard]] const Texture& getTexture(unsigned int characterSize, std::size_t index = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of textures holding the glyphs of a certain size
+    ///
+    /// \param characterSize Reference character size
+    ///
+    /// \return Number of textures, always at least 1
+    ///
+    /// \see `getTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getTextureCount(unsigned int characterSize) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the occupancy statistics of the glyph textures of a certain size
+    ///
+    /// This can be used to evaluate how well the glyphs are
+    /// packed, and how much texture memory a given set of
+    /// characters requires.
+    ///
+    /// \param characterSize Reference character size
+    ///
+    /// \return Statistics of the textures of the requested size
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] AtlasStatistics getAtlasStatistics(unsigned int characterSize) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the occupancy statistics of all the glyph textures
+    ///
+    /// \return Statistics accumulated over all the character sizes loaded so far
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] AtlasStatistics getAtlasStatistics() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable the smooth filter
@@ -442,22 +607,55 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable signed distance field glyphs
+    ///
+    /// In distance field mode, each glyph is rasterized only once,
+    /// as a signed distance field at a fixed reference size, into
+    /// a texture shared by all the character sizes. `sf::Text`
+    /// scales these glyphs to its character size and renders them
+    /// with a built-in shader, which keeps their edges sharp at
+    /// any size and draws outlines from the distance field instead
+    /// of rasterizing outlined glyphs.
+    ///
+    /// Distance fields are only generated for scalable fonts,
+    /// other fonts keep using regular glyphs. The thickness of
+    /// outlines is limited to about 8 pixels at the reference
+    /// size of 64 pixels, and rendering them requires shader
+    /// support (see `sf::Shader::isAvailable`).
+    ///
+    /// Changing the mode discards all the glyphs loaded so far.
+    /// Distance field mode is disabled by default.
+    ///
+    /// \param enabled `true` to enable distance field glyphs, `false` to disable them
+    ///
+    /// \see `isDistanceFieldEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDistanceFieldEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether signed distance field glyphs are enabled or not
+    ///
+    /// \return `true` if distance field glyphs are enabled, `false` if they are disabled
+    ///
+    /// \see `setDistanceFieldEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDistanceFieldEnabled() const;
+
 private:
     friend class Text;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Structure defining a row of glyphs
+    /// \brief Structure defining a segment of the skyline of a texture
     ///
     ////////////////////////////////////////////////////////////
-    struct Row
+    struct SkylineNode
     {
-        Row(unsigned int rowTop, unsigned int rowHeight) : top(rowTop), height(rowHeight)
-        {
-        }
-
-        unsigned int width{}; //!< Current width of the row
-        unsigned int top;     //!< Y position of the row into the texture
-        unsigned int height;  //!< Height of the row
+        unsigned int x{};     //!< X position of the segment into the texture
+        unsigned int y{};     //!< Y position of the first free pixel below the segment
+        unsigned int width{}; //!< Width of the segment
     };
 
     ////////////////////////////////////////////////////////////
@@ -465,6 +663,41 @@ private:
     ////////////////////////////////////////////////////////////
     using GlyphTable = std::unordered_map<std::uint64_t, Glyph>; //!< Table mapping a codepoint to its glyph
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Structure defining a texture of a glyphs page
+    ///
+    /// Glyphs are packed with a bottom-left skyline algorithm.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct PageTexture
+    {
+        explicit PageTexture(bool smooth);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Find a free rectangle in the texture and reserve it
+        ///
+        /// \param size Width and height of the rectangle
+        ///
+        /// \return Position of the rectangle, or `std::nullopt` if it doesn't fit
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] std::optional<Vector2u> insert(Vector2u size);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Double the size of the texture, keeping its contents
+        ///
+        /// \return `true` on success, `false` if the maximum texture size has been reached
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool grow();
+
+        Texture                  texture;      //!< Texture containing the pixels of the glyphs
+        std::vector<SkylineNode> skyline;      //!< Upper contour of the allocated area, sorted from left to right
+        std::size_t              glyphCount{}; //!< Number of glyphs packed into the texture
+        std::uint64_t            usedArea{};   //!< Area allocated to glyphs, in pixels
+        std::uint64_t            wastedArea{}; //!< Area left unusable below allocated glyphs, in pixels
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a page of glyphs
     ///
@@ -473,10 +706,8 @@ private:
     {
         explicit Page(bool smooth);
 
-        GlyphTable       glyphs;     //!< Table mapping code points to their corresponding glyph
-        Texture          texture;    //!< Texture containing the pixels of the glyphs
-        unsigned int     nextRow{3}; //!< Y position of the next new row in the texture
-        std::vector<Row> rows;       //!< List containing the position of all the existing rows
+        GlyphTable              glyphs;   //!< Table mapping code points to their corresponding glyph
+        std::deque<PageTexture> textures; //!< Textures containing the pixels of the glyphs, never empty
     };
 
     ////////////////////////////////////////////////////////////
@@ -488,8 +719,15 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Open from stream and print errors with custom message
     ///
+    /// When the contents of the stream are available in memory,
+    /// FreeType reads them in place instead of through the stream.
+    ///
+    /// \param stream Stream to open the font from
+    /// \param type   Kind of source, for error messages
+    /// \param data   Pointer to the contents of the stream in memory, if any
+    ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool openFromStreamImpl(InputStream& stream, std::string_view type);
+    [[nodiscard]] bool openFromStreamImpl(InputStream& stream, std::string_view type, const void* data = nullptr);
 
     ////////////////////////////////////////////////////////////
     /// \brief Find or create the glyphs page corresponding to the given character size
@@ -501,6 +739,94 @@ private:
     ////////////////////////////////////////////////////////////
     Page& loadPage(unsigned int characterSize) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve a glyph from the page of the given size, loading it if necessary
+    ///
+    /// \param id               Glyph ID of the character to get
+    /// \param characterSize    Reference character size
+    /// \param bold             Retrieve the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+    ///
+    /// \return The glyph corresponding to `id` and `characterSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    const Glyph& getPageGlyph(std::uint32_t id, unsigned int characterSize, bool bold, float outlineThickness) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Request a glyph from the asynchronous loader
+    ///
+    /// \param id               Glyph ID of the character to load
+    /// \param characterSize    Reference character size
+    /// \param bold             Load the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+    /// \param key              Key of the glyph in its page
+    ///
+    /// \return `true` if the glyph will be loaded asynchronously, `false` if it must be loaded now
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool requestGlyph(std::uint32_t id,
+                                    unsigned int  characterSize,
+                                    bool          bold,
+                                    float         outlineThickness,
+                                    std::uint64_t key) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add the glyphs loaded asynchronously to their pages
+    ///
+    ////////////////////////////////////////////////////////////
+    void commitLoadedGlyphs() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief (Re)start the asynchronous loader if it is enabled
+    ///
+    ////////////////////////////////////////////////////////////
+    void restartAsyncLoader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a glyph is a placeholder for a glyph still being loaded
+    ///
+    /// This is used internally by Text to update its geometry
+    /// once all its glyphs are available.
+    ///
+    /// \param glyph Glyph returned by `getGlyph` or `getGlyphById`
+    ///
+    /// \return `true` if the glyph is not loaded yet
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isGlyphPending(const Glyph& glyph) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of times glyphs loaded asynchronously were added to the font
+    ///
+    /// Glyphs which finished loading are added to the font by
+    /// this function. This is used internally by Text.
+    ///
+    /// \return Counter incremented whenever new glyphs are available
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getGlyphGeneration() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether glyphs are currently rendered as distance fields
+    ///
+    /// \return `true` if distance field mode is enabled and supported by the font
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDistanceFieldActive() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a distance to the normalized units of the distance field
+    ///
+    /// This is used internally by Text to render outlines.
+    ///
+    /// \param distance      Distance, in pixels at the given character size
+    /// \param characterSize Reference character size
+    ///
+    /// \return Offset to apply to the values of the distance field
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getDistanceFieldOffset(float distance, unsigned int characterSize) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Load a new glyph and store it in the cache
     ///
@@ -515,15 +841,27 @@ private:
     Glyph loadGlyph(std::uint32_t id, unsigned int characterSize, bool bold, float outlineThickness) const;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Find a suitable rectangle within the texture for a glyph
+    /// \brief Write the pixels of a glyph to the page textures
+    ///
+    /// \param page   Page of glyphs to write to
+    /// \param glyph  Glyph whose texture rectangle is updated
+    /// \param size   Size of the pixels, padding included
+    /// \param pixels RGBA pixels of the glyph
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeGlyph(Page& page, Glyph& glyph, Vector2u size, const std::uint8_t* pixels) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a suitable rectangle within the page textures for a glyph
     ///
-    /// \param page Page of glyphs to search in
-    /// \param size Width and height of the rectangle
+    /// \param page         Page of glyphs to search in
+    /// \param size         Width and height of the rectangle
+    /// \param textureIndex Receives the index of the texture containing the rectangle
     ///
     /// \return Found rectangle within the texture
     ///
     ////////////////////////////////////////////////////////////
-    IntRect findGlyphRect(Page& page, Vector2u size) const;
+    IntRect findGlyphRect(Page& page, Vector2u size, unsigned int& textureIndex) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Make sure that the given size is the current one
@@ -557,17 +895,23 @@ private:
     // Types
     ////////////////////////////////////////////////////////////
     struct FontHandles;
+    struct AsyncLoader;
     using PageTable = std::unordered_map<unsigned int, Page>; //!< Table mapping a character size to its page (texture)
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::shared_ptr<FontHandles> m_fontHandles;    //!< Shared information about the internal font instance
-    bool                         m_isSmooth{true}; //!< Status of the smooth filter
-    Info                         m_info;           //!< Information about the font
-    mutable PageTable            m_pages;          //!< Table containing the glyphs pages by character size
+    std::shared_ptr<FontHandles> m_fontHandles;       //!< Shared information about the internal font instance
+    bool                         m_isSmooth{true};    //!< Status of the smooth filter
+    bool                         m_isDistanceField{}; //!< Are glyphs rendered as signed distance fields?
+    bool                         m_isAsync{};         //!< Are glyphs loaded asynchronously?
+    Info                         m_info;              //!< Information about the font
+    mutable PageTable            m_pages;             //!< Table containing the glyphs pages by character size
+    mutable std::unordered_map<unsigned int, GlyphTable> m_scaledGlyphs; //!< Distance field glyphs scaled to each character size
     mutable std::vector<std::uint8_t> m_pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
-    std::shared_ptr<InputStream> m_stream; //!< Stream for openFromFile and openFromMemory
+    std::shared_ptr<InputStream> m_stream;            //!< Stream for openFromFile and openFromMemory
+    std::unique_ptr<AsyncLoader> m_asyncLoader;       //!< Worker thread loading glyphs asynchronously
+    mutable std::uint64_t        m_glyphGeneration{}; //!< Incremented whenever glyphs loaded asynchronously are added
 };
 
 } // namespace sf
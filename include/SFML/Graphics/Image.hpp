@@ -54,6 +54,19 @@ class InputStream;
 class SFML_GRAPHICS_API Image
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Filters used to compute the pixels of a resampled image
+    ///
+    /// \see `resample`
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class ResamplingFilter
+    {
+        Box,      //!< Average of the covered pixels when downscaling, nearest pixel when upscaling
+        Bilinear, //!< Linear interpolation, smooth but slightly blurry
+        Lanczos   //!< Windowed sinc over 3 pixels, sharpest but slowest
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -299,6 +312,19 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool copy(const Image& source, Vector2u dest, const IntRect& sourceRect = {}, bool applyAlpha = false);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Fill a rectangle of the image with a color
+    ///
+    /// If `area` is empty, the whole image is filled. If it
+    /// crosses the bounds of the image, it is adjusted to fit
+    /// the image size.
+    ///
+    /// \param color Color to assign to the pixels
+    /// \param area  Rectangle to fill
+    ///
+    ////////////////////////////////////////////////////////////
+    void fill(Color color, const IntRect& area = {});
+
     ////////////////////////////////////////////////////////////
     /// \brief Change the color of a pixel
     ///
@@ -357,6 +383,51 @@ public:
     ////////////////////////////////////////////////////////////
     void flipVertically();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Multiply the color components of the pixels by their alpha
+    ///
+    /// Premultiplied pixels can be filtered without dark fringes
+    /// around transparent areas. They must be drawn with a blend
+    /// mode whose source factor is `sf::BlendMode::Factor::One`.
+    /// The result is rounded to the nearest value.
+    ///
+    /// \see `unpremultiplyAlpha`
+    ///
+    ////////////////////////////////////////////////////////////
+    void premultiplyAlpha();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Divide the color components of the pixels by their alpha
+    ///
+    /// This is the inverse of `premultiplyAlpha`, up to rounding.
+    /// The color of fully transparent pixels is set to black.
+    ///
+    /// \see `premultiplyAlpha`
+    ///
+    ////////////////////////////////////////////////////////////
+    void unpremultiplyAlpha();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the size of the image, scaling its content
+    ///
+    /// Unlike `resize`, the content of the image is kept and
+    /// stretched to the new size. The filter is computed with
+    /// colors premultiplied by alpha, so that the color of
+    /// transparent pixels doesn't bleed into their neighbors.
+    /// When downscaling, all the covered source pixels
+    /// contribute to each destination pixel.
+    ///
+    /// This function fails if the image is empty or if the
+    /// new size is zero, the image is left unchanged then.
+    ///
+    /// \param size   New size of the image, in pixels
+    /// \param filter Filter used to compute the new pixels
+    ///
+    /// \return `true` if the operation was successful, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool resample(Vector2u size, ResamplingFilter filter = ResamplingFilter::Bilinear);
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -386,6 +457,11 @@ private:
 /// functions (such as `loadFromMemory`) must use this
 /// representation as well.
 ///
+/// The pixel processing functions (`copy` with alpha blending,
+/// `createMaskFromColor`, flipping, `fill`, alpha premultiplication
+/// and `resample`) use the SIMD instructions of the processor when
+/// available, and split large images across several threads.
+///
 /// A `sf::Image` can be copied, but it is a heavy resource and
 /// if possible you should always use [const] references to
 /// pass or return them to avoid useless copies.
@@ -0,0 +1,343 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Index buffer storage for indexed primitives
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API IndexBuffer : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers, the same as the ones of `sf::VertexBuffer`
+    ///
+    ////////////////////////////////////////////////////////////
+    using Usage = VertexBuffer::Usage;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Size of the indices stored in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Format
+    {
+        UInt16, //!< 16-bit indices, up to 65536 vertices
+        UInt32  //!< 32-bit indices
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty index buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an `IndexBuffer` with a specific usage specifier
+    ///
+    /// Creates an empty index buffer and sets its usage to \p usage.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit IndexBuffer(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~IndexBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer(const IndexBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer& operator=(const IndexBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer(IndexBuffer&& source) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer& operator=(IndexBuffer&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the index buffer
+    ///
+    /// Creates the index buffer and allocates enough graphics
+    /// memory to hold `indexCount` indices of the given format.
+    /// Any previously allocated memory is freed in the process.
+    ///
+    /// In order to deallocate previously allocated memory pass 0
+    /// as `indexCount`. Don't forget to recreate with a non-zero
+    /// value when graphics memory should be allocated again.
+    ///
+    /// \param indexCount Number of indices worth of memory to allocate
+    /// \param format     Size of the indices
+    ///
+    /// \return `true` if creation was successful, `false` if the buffer or the format isn't supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t indexCount, Format format = Format::UInt16);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the index count
+    ///
+    /// \return Number of indices in the index buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getIndexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the format of the indices
+    ///
+    /// \return Size of the indices stored in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Format getFormat() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of 16-bit indices
+    ///
+    /// `offset` is specified as the number of indices to skip
+    /// from the beginning of the buffer. The rules are the same
+    /// as for `sf::VertexBuffer::update`: with an `offset` of 0,
+    /// a larger array grows the buffer, otherwise the update
+    /// fails if it doesn't fit in the buffer.
+    ///
+    /// The update fails if the buffer was created with
+    /// `Format::UInt32`.
+    ///
+    /// \param indices    Array of indices to copy to the buffer
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const std::uint16_t* indices, std::size_t indexCount, std::size_t offset = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of 32-bit indices
+    ///
+    /// `offset` is specified as the number of indices to skip
+    /// from the beginning of the buffer. The rules are the same
+    /// as for `sf::VertexBuffer::update`: with an `offset` of 0,
+    /// a larger array grows the buffer, otherwise the update
+    /// fails if it doesn't fit in the buffer.
+    ///
+    /// The update fails if the buffer was created with
+    /// `Format::UInt16`.
+    ///
+    /// \param indices    Array of indices to copy to the buffer
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const std::uint32_t* indices, std::size_t indexCount, std::size_t offset = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the index buffer.
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the index buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the usage specifier of this index buffer
+    ///
+    /// After changing the usage specifier, the index buffer has
+    /// to be updated with new data for the usage specifier to
+    /// take effect.
+    ///
+    /// The default usage type is `sf::IndexBuffer::Usage::Static`.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUsage(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of this index buffer
+    ///
+    /// \return Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind an index buffer for rendering
+    ///
+    /// This function is not part of the graphics API, it mustn't be
+    /// used when drawing SFML entities. It must be used only if you
+    /// mix `sf::IndexBuffer` with OpenGL code.
+    ///
+    /// \param indexBuffer Pointer to the index buffer to bind, can be null to use no index buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    static void bind(const IndexBuffer* indexBuffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports index buffers
+    ///
+    /// Index buffers are available whenever vertex buffers are.
+    ///
+    /// \return `true` if index buffers are supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports 32-bit indices
+    ///
+    /// 32-bit indices are always supported by desktop OpenGL,
+    /// they are optional with OpenGL ES.
+    ///
+    /// \return `true` if `Format::UInt32` is supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isUInt32Available();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports primitive restart
+    ///
+    /// When supported, the largest value of the index format
+    /// (0xFFFF for 16-bit indices, 0xFFFFFFFF for 32-bit
+    /// indices) ends the current strip or fan and starts a new
+    /// one, so that several strips are drawn in a single call.
+    ///
+    /// \return `true` if primitive restart is supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isPrimitiveRestartAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy indices of any format to the buffer
+    ///
+    /// \param indices    Array of indices to copy to the buffer
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool write(const void* indices, std::size_t indexCount, std::size_t offset);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_buffer{};               //!< Internal buffer identifier
+    std::size_t  m_size{};                 //!< Size in indices of the currently allocated buffer
+    Format       m_format{Format::UInt16}; //!< Size of the indices
+    Usage        m_usage{Usage::Static};   //!< How this index buffer is to be used
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::IndexBuffer
+/// \ingroup graphics
+///
+/// `sf::IndexBuffer` stores indices into the vertices of a
+/// `sf::VertexBuffer` in graphics memory.
+///
+/// Meshes and tile maps share most of their vertices between
+/// neighboring primitives. Drawing a quad with
+/// `sf::PrimitiveType::Triangles` requires 6 vertices, but with
+/// indices only the 4 corners are stored and the triangles
+/// refer to them, which saves memory and bandwidth and lets
+/// the GPU reuse the vertices it has already transformed.
+///
+/// 16-bit indices are enough for up to 65536 vertices and
+/// use half the memory of 32-bit indices.
+///
+/// Indexed geometry is drawn with the `sf::RenderTarget::draw`
+/// overloads that take an index buffer, the primitive type is
+/// the one of the vertex buffer. Indices stored in client
+/// memory can be drawn too, with or without a vertex buffer.
+///
+/// Usage example:
+/// \code
+/// // Two quads sharing their vertices
+/// std::vector<sf::Vertex> vertices = ...;
+/// std::vector<std::uint16_t> indices;
+/// for (std::uint16_t quad = 0; quad < vertices.size() / 4; ++quad)
+/// {
+///     const auto i = static_cast<std::uint16_t>(quad * 4);
+///     indices.insert(indices.end(), {i, std::uint16_t(i + 1), std::uint16_t(i + 2),
+///                                    std::uint16_t(i + 2), std::uint16_t(i + 1), std::uint16_t(i + 3)});
+/// }
+///
+/// sf::VertexBuffer vertexBuffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static);
+/// (void)vertexBuffer.create(vertices.size());
+/// (void)vertexBuffer.update(vertices.data());
+///
+/// sf::IndexBuffer indexBuffer;
+/// (void)indexBuffer.create(indices.size());
+/// (void)indexBuffer.update(indices.data(), indices.size());
+///
+/// window.draw(vertexBuffer, indexBuffer);
+/// \endcode
+///
+/// \see `sf::VertexBuffer`, `sf::RenderTarget`
+///
+////////////////////////////////////////////////////////////
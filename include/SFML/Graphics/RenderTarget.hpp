@@ -39,9 +39,14 @@
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/View.hpp>
 
+#include <SFML/Window/ContextSettings.hpp>
+
+#include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 
 #include <array>
+#include <memory>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -50,11 +55,18 @@
 namespace sf
 {
 class Drawable;
+class IndexBuffer;
 class Shader;
+class SpriteBatch;
 class Texture;
 class Transform;
 class VertexBuffer;
 
+namespace priv
+{
+class ShaderPipeline;
+}
+
 ////////////////////////////////////////////////////////////
 /// \brief Base class for all render targets (window, texture, ...)
 ///
@@ -66,7 +78,7 @@ public:
     /// \brief Destructor
     ///
     ////////////////////////////////////////////////////////////
-    virtual ~RenderTarget() = default;
+    virtual ~RenderTarget();
 
     ////////////////////////////////////////////////////////////
     /// \brief Deleted copy constructor
@@ -84,13 +96,13 @@ public:
     /// \brief Move constructor
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget(RenderTarget&&) noexcept = default;
+    RenderTarget(RenderTarget&&) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Move assignment
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget& operator=(RenderTarget&&) noexcept = default;
+    RenderTarget& operator=(RenderTarget&&) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Clear the entire target with a single color
@@ -333,6 +345,10 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Draw primitives defined by a vertex buffer
     ///
+    /// The vertices are read from the segment of the buffer which
+    /// holds its latest data (see `VertexBuffer::getSegmentOffset`),
+    /// \p firstVertex is relative to that segment.
+    ///
     /// \param vertexBuffer Vertex buffer
     /// \param firstVertex  Index of the first vertex to render
     /// \param vertexCount  Number of vertices to render
@@ -344,6 +360,81 @@ public:
               std::size_t         vertexCount,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices and 16-bit indices
+    ///
+    /// Every index must be lower than `vertexCount`, no
+    /// additional check is performed.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*        vertices,
+              std::size_t          vertexCount,
+              const std::uint16_t* indices,
+              std::size_t          indexCount,
+              PrimitiveType        type,
+              const RenderStates&  states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices and 32-bit indices
+    ///
+    /// Every index must be lower than `vertexCount`, no
+    /// additional check is performed. 32-bit indices may not be
+    /// supported with OpenGL ES, see `IndexBuffer::isUInt32Available`.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*        vertices,
+              std::size_t          vertexCount,
+              const std::uint32_t* indices,
+              std::size_t          indexCount,
+              PrimitiveType        type,
+              const RenderStates&  states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer and an index buffer
+    ///
+    /// The primitive type is the one of the vertex buffer.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer and a range of an index buffer
+    ///
+    /// The primitive type is the one of the vertex buffer.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer
+    /// \param firstIndex   Index of the first index to render
+    /// \param indexCount   Number of indices to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              std::size_t         firstIndex,
+              std::size_t         indexCount,
+              const RenderStates& states = RenderStates::Default);
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -450,12 +541,261 @@ public:
     ////////////////////////////////////////////////////////////
     void resetGLStates();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters describing the work done by the draw batcher
+    ///
+    /// \see `getBatchStatistics`, `setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct BatchStatistics
+    {
+        std::uint64_t batchedDraws{};    //!< Number of draw calls that were merged into a batch
+        std::uint64_t batchedVertices{}; //!< Number of vertices appended to batches
+        std::uint64_t flushes{};         //!< Number of batches submitted to OpenGL
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable automatic batching of draw calls
+    ///
+    /// When batching is enabled, consecutive calls to
+    /// `draw(const Vertex*, ...)` that use compatible render states
+    /// (same texture, coordinate type, blend mode and stencil
+    /// mode and no shader) are not sent to OpenGL immediately.
+    /// Their vertices are transformed on the CPU and accumulated
+    /// into an internal buffer, which is submitted as a single
+    /// draw call when the render states change, when the view
+    /// changes, when the target is cleared or displayed, or when
+    /// `flush` is called explicitly.
+    ///
+    /// Strip and fan primitives are converted to their list
+    /// counterparts so that they can be merged together.
+    ///
+    /// Because submission is deferred, textures used while batching
+    /// must stay alive and unmodified until the batch is flushed.
+    /// Call `flush` before issuing your own OpenGL commands.
+    ///
+    /// Batching is disabled by default. Disabling it flushes
+    /// any pending batch.
+    ///
+    /// \param enabled `true` to enable batching, `false` to disable it
+    ///
+    /// \see `isBatchingEnabled`, `flush`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBatchingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether automatic batching of draw calls is enabled
+    ///
+    /// \return `true` if batching is enabled, `false` otherwise
+    ///
+    /// \see `setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isBatchingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit the pending batch of draw calls to OpenGL
+    ///
+    /// This function does nothing if batching is disabled or
+    /// if no draw call is pending.
+    ///
+    /// \see `setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the counters of the draw batcher
+    ///
+    /// The counters accumulate until `resetBatchStatistics`
+    /// is called.
+    ///
+    /// \return Batching statistics of this render target
+    ///
+    /// \see `resetBatchStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const BatchStatistics& getBatchStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the counters of the draw batcher to zero
+    ///
+    /// \see `getBatchStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetBatchStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable culling of the draw calls outside the view
+    ///
+    /// When culling is enabled, `draw(const Vertex*, ...)` and its
+    /// indexed overloads compute the bounding rectangle of the
+    /// vertices, transformed by the render states and the current
+    /// view, and skip the draw call if it doesn't intersect the
+    /// visible area. Rotated views are accounted for. This applies
+    /// to every drawable that is rendered from vertices in client
+    /// memory, such as `sf::VertexArray`, `sf::Sprite`, `sf::Shape`
+    /// and `sf::Text`.
+    ///
+    /// Culling costs a pass over the vertices of each draw call,
+    /// which is usually much cheaper than rendering them when many
+    /// of them are off-screen. Draw calls that use a shader are
+    /// never culled, since the shader may move the vertices, and
+    /// neither are vertex buffers, whose vertices aren't readable.
+    ///
+    /// The culled draw calls are counted in the frame statistics.
+    ///
+    /// Culling is disabled by default.
+    ///
+    /// \param enabled `true` to enable culling, `false` to disable it
+    ///
+    /// \see `isCullingEnabled`, `isVisible`, `getFrameStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCullingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether culling of the draw calls outside the view is enabled
+    ///
+    /// \return `true` if culling is enabled, `false` otherwise
+    ///
+    /// \see `setCullingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isCullingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a rectangle is visible in the current view
+    ///
+    /// The rectangle is transformed by \p transform and by the
+    /// current view, including its rotation. Since the test works
+    /// on the bounding rectangle of the result, it may report
+    /// rectangles which are close to a corner of a rotated view as
+    /// visible, but it never reports a visible rectangle as hidden.
+    ///
+    /// This is useful to skip whole groups of objects, such as
+    /// the chunks of a large world, before drawing them.
+    ///
+    /// \param bounds    Rectangle to test, in local coordinates
+    /// \param transform Transform from local to world coordinates
+    ///
+    /// \return `true` if the rectangle may be visible, `false` if it is outside the view
+    ///
+    /// \see `setCullingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isVisible(const FloatRect& bounds, const Transform& transform = Transform::Identity) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a group of draw calls can be skipped because it is outside the view
+    ///
+    /// This performs the same test as `isVisible` with the
+    /// transform of \p states, and counts the skipped draw calls
+    /// in the frame statistics. Groups drawn with a shader are
+    /// never skipped, since the shader may move the vertices.
+    ///
+    /// Unlike the culling of individual draw calls, this test
+    /// is performed whether culling is enabled or not.
+    ///
+    /// \param bounds    Bounding rectangle of the group, in local coordinates
+    /// \param states    Render states the group would be drawn with
+    /// \param drawCount Number of draw calls in the group
+    ///
+    /// \return `true` if the group is outside the view and must be skipped, `false` otherwise
+    ///
+    /// \see `isVisible`, `getFrameStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool cull(const FloatRect& bounds, const RenderStates& states, std::size_t drawCount = 1);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters describing the rendering work of a frame
+    ///
+    /// \see `getFrameStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct FrameStatistics
+    {
+        std::uint64_t drawCalls{};           //!< Number of draw calls submitted to OpenGL
+        std::uint64_t vertices{};            //!< Number of vertices submitted to OpenGL
+        std::uint64_t stateChangesApplied{}; //!< Number of blend, stencil and texture changes sent to OpenGL
+        std::uint64_t stateChangesAvoided{}; //!< Number of blend, stencil and texture changes skipped by the states cache
+        std::uint64_t textureBinds{};        //!< Number of texture binds (including unbinds)
+        std::uint64_t shaderBinds{};         //!< Number of shader binds (including unbinds)
+        std::uint64_t viewApplications{};    //!< Number of times the view was applied
+        std::uint64_t culledDraws{};         //!< Number of draw calls skipped because they were outside the view
+        Time          gpuTime;               //!< GPU time of a recent frame, zero if GPU timing is unavailable
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the last completed frame
+    ///
+    /// Statistics are accumulated while drawing and are
+    /// published, then reset, every time a frame is completed
+    /// by calling `display()` on the render window or render
+    /// texture. Collecting them only costs a few integer
+    /// increments per draw call.
+    ///
+    /// If GPU timing is enabled, `gpuTime` holds the GPU time
+    /// elapsed between the first and the last command of the
+    /// most recent frame whose timing results are available.
+    /// Results are read without stalling the pipeline, so they
+    /// usually lag a couple of frames behind.
+    ///
+    /// \return Statistics of the last completed frame
+    ///
+    /// \see `setGpuTimingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const FrameStatistics& getFrameStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable measuring the GPU time of frames
+    ///
+    /// GPU timing relies on OpenGL timer queries. If they
+    /// are not supported by the driver, an error is printed
+    /// and timing stays disabled.
+    ///
+    /// GPU timing is disabled by default.
+    ///
+    /// \param enabled `true` to enable GPU timing, `false` to disable it
+    ///
+    /// \see `isGpuTimingEnabled`, `getFrameStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setGpuTimingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether GPU timing is enabled
+    ///
+    /// \return `true` if GPU timing is enabled, `false` otherwise
+    ///
+    /// \see `setGpuTimingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isGpuTimingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the target renders through the shader pipeline
+    ///
+    /// Targets created with a core profile context render through
+    /// the shader pipeline. Shaders drawn to such a target must
+    /// provide both a vertex and a fragment stage, and read the
+    /// built-in `sf_*` attributes and uniforms instead of the
+    /// fixed-function ones.
+    ///
+    /// \return `true` if the target renders through the shader pipeline, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isShaderPipelineEnabled() const;
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget() = default;
+    RenderTarget();
 
     ////////////////////////////////////////////////////////////
     /// \brief Performs the common initialization step after creation
@@ -463,10 +803,29 @@ protected:
     /// The derived classes must call this function after the
     /// target is created and ready for drawing.
     ///
+    /// If `settings` requests a core profile context
+    /// (`ContextSettings::Attribute::Core`), the target renders
+    /// through the shader pipeline instead of the fixed-function
+    /// pipeline, when the system supports it.
+    ///
+    /// \param settings Settings of the context the target renders with
+    ///
+    ////////////////////////////////////////////////////////////
+    void initialize(const ContextSettings& settings = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the end of a frame
+    ///
+    /// Publishes the statistics of the current frame and
+    /// resets the counters. The derived classes must call
+    /// this function every time they present a frame.
+    ///
     ////////////////////////////////////////////////////////////
-    void initialize();
+    void endFrame();
 
 private:
+    friend class SpriteBatch;
+
     ////////////////////////////////////////////////////////////
     /// \brief Apply the current view
     ///
@@ -514,6 +873,98 @@ private:
     ////////////////////////////////////////////////////////////
     void applyShader(const Shader* shader);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Make sure the shader pipeline exists in the active context
+    ///
+    /// \return `true` if the shader pipeline can be used for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool ensureShaderPipeline();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the shader pipeline program and vertex layout for a draw
+    ///
+    /// \param states       Render states to use for drawing
+    /// \param buffer       Vertex buffer object holding the vertices to draw
+    /// \param bufferOffset Offset of the first vertex in the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void prepareShaderPipelineDraw(const RenderStates& states, unsigned int buffer, std::size_t bufferOffset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Indices of an indexed draw
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Indices
+    {
+        const void*  data{};   //!< Pointer to the indices, or offset in the index buffer if `buffer` is not 0
+        std::size_t  count{};  //!< Number of indices to draw
+        bool         wide{};   //!< Are the indices 32-bit instead of 16-bit?
+        unsigned int buffer{}; //!< Index buffer object holding the indices, 0 if they are in client memory
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives immediately, bypassing the batcher
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    /// \param indices     Indices in client memory, null to draw the vertices in order
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVertices(const Vertex*       vertices,
+                      std::size_t         vertexCount,
+                      PrimitiveType       type,
+                      const RenderStates& states,
+                      const Indices*      indices = nullptr);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives from a vertex buffer
+    ///
+    /// \param vertexBuffer Vertex buffer holding the vertices
+    /// \param firstVertex  Index of the first vertex to render
+    /// \param vertexCount  Number of vertices to render
+    /// \param states       Render states to use for drawing
+    /// \param indices      Indices in an index buffer, null to draw the vertices in order
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVertexBuffer(const VertexBuffer& vertexBuffer,
+                          std::size_t         firstVertex,
+                          std::size_t         vertexCount,
+                          const RenderStates& states,
+                          const Indices*      indices = nullptr);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a draw call must be skipped because it is outside the view
+    ///
+    /// Culled draw calls are counted in the frame statistics.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param states      Render states to use for drawing
+    ///
+    /// \return `true` if culling is enabled and the vertices are outside the view
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool cullVertices(const Vertex* vertices, std::size_t vertexCount, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Try to append primitives to the pending batch
+    ///
+    /// The pending batch is flushed first if its states are
+    /// not compatible with the new ones.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    /// \return `true` if the primitives were batched, `false` if they must be drawn immediately
+    ///
+    ////////////////////////////////////////////////////////////
+    bool batchVertices(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states);
+
     ////////////////////////////////////////////////////////////
     /// \brief Setup environment for drawing
     ///
@@ -533,6 +984,15 @@ private:
     ////////////////////////////////////////////////////////////
     void drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives
+    ///
+    /// \param type    Type of primitives to draw
+    /// \param indices Indices of the vertices to draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedPrimitives(PrimitiveType type, const Indices& indices);
+
     ////////////////////////////////////////////////////////////
     /// \brief Clean up environment after drawing
     ///
@@ -541,6 +1001,30 @@ private:
     ////////////////////////////////////////////////////////////
     void cleanupDraw(const RenderStates& states);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Prepare a draw that submits its own vertex data
+    ///
+    /// The pending batch is flushed, the target is activated and
+    /// the render states are applied. The caller is then free to
+    /// set up its own client arrays and issue the draw call, and
+    /// must finish with `endCustomDraw`.
+    ///
+    /// \param states Render states to use for drawing
+    ///
+    /// \return `true` if the draw can proceed, `false` if the target could not be activated or renders through the shader pipeline
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool beginCustomDraw(const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Clean up after a draw started with `beginCustomDraw`
+    ///
+    /// \param states      Render states used for drawing
+    /// \param vertexCount Number of vertices that were rendered
+    ///
+    ////////////////////////////////////////////////////////////
+    void endCustomDraw(const RenderStates& states, std::size_t vertexCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Render states cache
     ///
@@ -561,13 +1045,39 @@ private:
         std::array<Vertex, 4> vertexCache{};           //!< Pre-transformed vertices cache
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Pending batch of draw calls
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Batch
+    {
+        bool                enabled{};                      //!< Is batching enabled?
+        PrimitiveType       type{PrimitiveType::Triangles}; //!< Primitive type of the batched vertices
+        RenderStates        states;                         //!< Render states shared by the batched vertices
+        std::vector<Vertex> vertices;                       //!< Pre-transformed vertices waiting to be drawn
+        BatchStatistics     statistics;                     //!< Batching counters
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Ring of OpenGL timer queries used for GPU timing
+    ///
+    ////////////////////////////////////////////////////////////
+    struct GpuTimer;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    View          m_defaultView; //!< Default view
-    View          m_view;        //!< Current view
-    StatesCache   m_cache{};     //!< Render states cache
-    std::uint64_t m_id{};        //!< Unique number that identifies the RenderTarget
+    View                                  m_defaultView;             //!< Default view
+    View                                  m_view;                    //!< Current view
+    StatesCache                           m_cache{};                 //!< Render states cache
+    Batch                                 m_batch;                   //!< Pending batch of draw calls
+    bool                                  m_cullingEnabled{};        //!< Are the draw calls outside the view skipped?
+    FrameStatistics                       m_frameStatistics;         //!< Statistics of the frame being rendered
+    FrameStatistics                       m_lastFrameStatistics;     //!< Statistics of the last completed frame
+    std::unique_ptr<GpuTimer>             m_gpuTimer;                //!< GPU timer, null if GPU timing is disabled
+    std::uint64_t                         m_id{};                    //!< Unique number that identifies the RenderTarget
+    bool                                  m_shaderPipelineEnabled{}; //!< Does the target render through the shader pipeline?
+    std::unique_ptr<priv::ShaderPipeline> m_shaderPipeline;          //!< Shader pipeline objects of the active context
 };
 
 } // namespace sf
@@ -36,7 +36,11 @@
 
 #include <SFML/System/Vector2.hpp>
 
+#include <functional>
 #include <memory>
+#include <optional>
+
+#include <cstdint>
 
 
 namespace sf
@@ -46,6 +50,8 @@ namespace priv
 class RenderTextureImpl;
 }
 
+class Image;
+
 ////////////////////////////////////////////////////////////
 /// \brief Target for off-screen 2D rendering into a texture
 ///
@@ -225,6 +231,8 @@ public:
     /// has been drawn so far. Like for windows, calling this
     /// function is mandatory at the end of rendering. Not calling
     /// it may leave the texture in an undefined state.
+    /// The pending batch of draw calls (see
+    /// `RenderTarget::setBatchingEnabled`), if any, is rendered first.
     ///
     ////////////////////////////////////////////////////////////
     void display();
@@ -267,6 +275,55 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] const Texture& getTexture() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start copying the contents of the render-texture to an image without blocking
+    ///
+    /// This function should be called after `display`. The copy
+    /// completes while the next frames are rendered, it is
+    /// retrieved like with `Texture::copyToImageAsync`.
+    ///
+    /// \param callback Function called with the image once the copy is complete (optional)
+    ///
+    /// \return Ticket identifying the copy, 0 if the render-texture is not created
+    ///
+    /// \see `pollAsyncCopy`, `waitForAsyncCopy`, `processAsyncCopies`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t copyToImageAsync(std::function<void(Image&&)> callback = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the image of an asynchronous copy if it is complete
+    ///
+    /// \param ticket Ticket returned by `copyToImageAsync`
+    ///
+    /// \return Copied image, or `std::nullopt` if the copy is not
+    ///         complete yet or was already delivered
+    ///
+    /// \see `Texture::pollAsyncCopy`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Image> pollAsyncCopy(std::uint64_t ticket);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until an asynchronous copy is complete and retrieve its image
+    ///
+    /// \param ticket Ticket returned by `copyToImageAsync`
+    ///
+    /// \return Copied image, or `std::nullopt` if the copy was already delivered
+    ///
+    /// \see `Texture::waitForAsyncCopy`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Image> waitForAsyncCopy(std::uint64_t ticket);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deliver the complete asynchronous copies to their callbacks
+    ///
+    /// \see `Texture::processAsyncCopies`
+    ///
+    ////////////////////////////////////////////////////////////
+    void processAsyncCopies();
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -198,6 +198,16 @@ protected:
     ////////////////////////////////////////////////////////////
     void onResize() override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called before the window is displayed
+    ///
+    /// This function renders the pending batch of draw calls
+    /// (see `RenderTarget::setBatchingEnabled`), if any, so
+    /// that it is part of the displayed frame.
+    ///
+    ////////////////////////////////////////////////////////////
+    void onDisplay() override;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
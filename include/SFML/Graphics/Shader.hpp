@@ -37,14 +37,22 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <cstddef>
+#include <cstdint>
 
 
 namespace sf
 {
 class InputStream;
 class Texture;
+class UniformBuffer;
+
+namespace priv
+{
+class ShaderPipeline;
+}
 
 ////////////////////////////////////////////////////////////
 /// \brief Shader class (vertex, geometry and fragment)
@@ -84,6 +92,65 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static inline CurrentTextureType CurrentTexture;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics of the program binary cache
+    ///
+    /// \see `setBinaryCacheDirectory`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct BinaryCacheStatistics
+    {
+        std::size_t hits{};   //!< Number of programs loaded from the cache
+        std::size_t misses{}; //!< Number of programs compiled from source while the cache was enabled
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Resolved location of a uniform variable
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    class UniformHandle
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Creates an invalid handle, setting a value through
+        /// it has no effect.
+        ///
+        ////////////////////////////////////////////////////////////
+        UniformHandle() = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the handle refers to a uniform of the shader
+        ///
+        /// \return `true` if the uniform was found, `false` otherwise
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isValid() const
+        {
+            return m_location != -1;
+        }
+
+    private:
+        friend class Shader;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Construct the handle from a location and a storage slot
+        ///
+        ////////////////////////////////////////////////////////////
+        UniformHandle(int location, std::size_t slot) : m_location(location), m_slot(slot)
+        {
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        int         m_location{-1}; //!< Location of the uniform in the program
+        std::size_t m_slot{};       //!< Index of the storage of the deferred value
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -778,6 +845,320 @@ public:
     ////////////////////////////////////////////////////////////
     void setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Resolve the location of a uniform variable
+    ///
+    /// Setting a uniform through the name looks the name up and
+    /// makes the program current every time. The handle returned
+    /// by this function skips both: the values set through it are
+    /// only recorded, and uploaded to the program the next time
+    /// the shader is bound, typically by the next draw call using
+    /// it. This is the fastest way to update many uniforms every
+    /// frame.
+    ///
+    /// The handle stays valid until the shader is loaded again.
+    /// A uniform should be set either through its handle or its
+    /// name, not both: the recorded values are uploaded last and
+    /// replace the ones set through the name.
+    ///
+    /// \param name Name of the uniform variable in GLSL
+    ///
+    /// \return Handle of the uniform, invalid if the shader has no such uniform
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] UniformHandle getUniformHandle(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p float uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param x      Value of the float scalar
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, float x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec2 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the vec2 vector
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, Glsl::Vec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec3 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the vec3 vector
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Vec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec4 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the vec4 vector
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Vec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p int uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param x      Value of the int scalar
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, int x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec2 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the ivec2 vector
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, Glsl::Ivec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec3 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the ivec3 vector
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Ivec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec4 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the ivec4 vector
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Ivec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bool uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param x      Value of the bool scalar
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, bool x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec2 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the bvec2 vector
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, Glsl::Bvec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec3 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the bvec3 vector
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Bvec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec4 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the bvec4 vector
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Bvec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat3 matrix
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param matrix Value of the mat3 matrix
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Mat3& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat4 matrix
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param matrix Value of the mat4 matrix
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Mat4& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify a texture as \p sampler2D uniform
+    ///
+    /// Like `setUniform(const std::string&, const Texture&)`,
+    /// `texture` must remain alive as long as the shader uses it.
+    ///
+    /// \param handle  Handle of the texture in the shader
+    /// \param texture Texture to assign
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify current texture as \p sampler2D uniform
+    ///
+    /// \param handle Handle of the texture in the shader
+    ///
+    /// \see `getUniformHandle`, `setUniform(const std::string&, CurrentTextureType)`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, CurrentTextureType);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p float[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param scalarArray pointer to array of \p float values
+    /// \param length      Number of elements in the array
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const float* scalarArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec2[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param vectorArray pointer to array of \p vec2 values
+    /// \param length      Number of elements in the array
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Vec2* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec3[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param vectorArray pointer to array of \p vec3 values
+    /// \param length      Number of elements in the array
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Vec3* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec4[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param vectorArray pointer to array of \p vec4 values
+    /// \param length      Number of elements in the array
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Vec4* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p mat3[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param matrixArray pointer to array of \p mat3 values
+    /// \param length      Number of elements in the array
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Mat3* matrixArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p mat4[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param matrixArray pointer to array of \p mat4 values
+    /// \param length      Number of elements in the array
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Mat4* matrixArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Attach a uniform buffer to a uniform block
+    ///
+    /// \a name is the name of the block in the shader:
+    /// \code
+    /// layout(std140) uniform Frame // this is the block in the shader
+    /// {
+    ///     mat4 view;
+    ///     float time;
+    /// };
+    /// \endcode
+    /// \code
+    /// sf::UniformBuffer frameBuffer;
+    /// ...
+    /// shader.setUniformBlock("Frame", frameBuffer);
+    /// \endcode
+    /// The same buffer can be attached to several shaders, its
+    /// contents are then uploaded once and shared by all of them.
+    /// It is important to note that `buffer` must remain alive
+    /// as long as the shader uses it, no copy is made internally.
+    ///
+    /// \param name   Name of the uniform block in GLSL
+    /// \param buffer Uniform buffer holding the values of the block
+    ///
+    /// \see `sf::UniformBuffer`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformBlock(const std::string& name, const UniformBuffer& buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary uniform buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformBlock(const std::string& name, const UniformBuffer&& buffer) = delete;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the underlying OpenGL handle of the shader.
     ///
@@ -844,7 +1225,64 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static bool isGeometryAvailable();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable the program binary cache
+    ///
+    /// Compiling and linking shaders is slow, and happens every
+    /// time a shader is loaded. When the cache is enabled, each
+    /// linked program is saved in `directory`, and loading the
+    /// same source code again with the same graphics driver
+    /// loads the saved program instead of compiling it.
+    ///
+    /// Programs saved by another driver, or rejected by the
+    /// current one, are compiled from source again and replace
+    /// the saved version. The directory is created if needed.
+    ///
+    /// The cache is disabled by default, pass an empty path to
+    /// disable it again. It has no effect if
+    /// `isBinaryCacheAvailable()` returns `false`.
+    ///
+    /// \param directory Directory where the programs are saved
+    ///
+    /// \see `getBinaryCacheStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setBinaryCacheDirectory(const std::filesystem::path& directory);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the directory of the program binary cache
+    ///
+    /// \return Directory of the cache, empty if the cache is disabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::filesystem::path getBinaryCacheDirectory();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the program binary cache
+    ///
+    /// The statistics count the shaders loaded by all threads
+    /// since the start of the program.
+    ///
+    /// \return Number of programs loaded from the cache and compiled from source
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static BinaryCacheStatistics getBinaryCacheStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports the program binary cache
+    ///
+    /// Retrieving linked programs requires OpenGL 4.1 or the
+    /// `ARB_get_program_binary` extension, and a driver which
+    /// supports at least one binary format.
+    ///
+    /// \return `true` if the program binary cache is supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isBinaryCacheAvailable();
+
 private:
+    friend class priv::ShaderPipeline;
+
     ////////////////////////////////////////////////////////////
     /// \brief Compile the shader(s) and create the program
     ///
@@ -871,6 +1309,20 @@ private:
     ////////////////////////////////////////////////////////////
     void bindTextures() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the values set through uniform handles
+    ///
+    /// The program must be bound when this function is called.
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyDeferredUniforms() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind all the uniform buffers used by the shader
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindUniformBlocks() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the location ID of a shader uniform
     ///
@@ -890,6 +1342,63 @@ private:
     ////////////////////////////////////////////////////////////
     struct UniformBinder;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Value recorded through a uniform handle
+    ///
+    ////////////////////////////////////////////////////////////
+    struct DeferredUniform
+    {
+        ////////////////////////////////////////////////////////////
+        /// \brief GLSL types which can be recorded
+        ///
+        ////////////////////////////////////////////////////////////
+        enum class Type
+        {
+            Float,
+            Vec2,
+            Vec3,
+            Vec4,
+            Int,
+            Ivec2,
+            Ivec3,
+            Ivec4,
+            Mat3,
+            Mat4
+        };
+
+        int                location{-1}; //!< Location of the uniform in the program
+        Type               type{};       //!< Type of the recorded value
+        std::size_t        count{};      //!< Number of array elements
+        std::vector<float> floats;       //!< Components of float, vector and matrix values
+        std::vector<int>   ints;         //!< Components of integer and boolean values
+        mutable bool       pending{};    //!< Has the value changed since it was last uploaded?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record a new value for a uniform handle
+    ///
+    /// \param handle Handle of the uniform
+    /// \param type   Type of the value
+    /// \param count  Number of array elements
+    ///
+    /// \return Storage to fill with the value, or null if the handle is invalid
+    ///
+    ////////////////////////////////////////////////////////////
+    DeferredUniform* deferUniform(UniformHandle handle, DeferredUniform::Type type, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Uniform buffer attached to a uniform block
+    ///
+    /// The binding point of a block is its position in the
+    /// list of blocks of the shader.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct UniformBlock
+    {
+        unsigned int         index{};  //!< Index of the block in the program
+        const UniformBuffer* buffer{}; //!< Buffer holding the values of the block
+    };
+
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
@@ -899,10 +1408,14 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int m_shaderProgram{};    //!< OpenGL identifier for the program
-    int          m_currentTexture{-1}; //!< Location of the current texture in the shader
-    TextureTable m_textures;           //!< Texture variables in the shader, mapped to their location
-    UniformTable m_uniforms;           //!< Parameters location cache
+    unsigned int                     m_shaderProgram{};    //!< OpenGL identifier for the program
+    std::uint64_t                    m_programId{};        //!< Unique identifier of the program, changed on reload
+    int                              m_currentTexture{-1}; //!< Location of the current texture in the shader
+    TextureTable                     m_textures;           //!< Texture variables in the shader, mapped to location
+    UniformTable                     m_uniforms;           //!< Parameters location cache
+    std::vector<DeferredUniform>     m_deferredUniforms;   //!< Values recorded through uniform handles, one per handle
+    mutable std::vector<std::size_t> m_pendingUniforms;    //!< Indices of the deferred values to upload
+    std::vector<UniformBlock>        m_uniformBlocks;      //!< Uniform buffers attached to the blocks of the shader
 };
 
 } // namespace sf
@@ -969,6 +1482,25 @@ private:
 /// given \p sampler2D uniform to the current texture of the
 /// object being drawn (which cannot be known in advance).
 ///
+/// Uniforms which are updated every frame are best set through
+/// handles. `getUniformHandle` looks the name up once, and the
+/// values set through the handle are uploaded when the shader
+/// is next used for drawing, without any lookup or program switch:
+/// \code
+/// const sf::Shader::UniformHandle offsetHandle = shader.getUniformHandle("offset");
+/// ...
+/// shader.setUniform(offsetHandle, 2.f);
+/// \endcode
+///
+/// Values shared by many shaders can be stored in a
+/// `sf::UniformBuffer` and attached to a GLSL uniform block with
+/// `setUniformBlock`, so that they are uploaded once for all of them.
+///
+/// Loading many shaders at startup can take a long time, most
+/// of it spent by the driver compiling them. Once a cache
+/// directory is set with `setBinaryCacheDirectory`, the compiled
+/// programs are saved there and loaded directly the next time.
+///
 /// To apply a shader to a drawable, you must pass it as an
 /// additional parameter to the `RenderWindow::draw` function:
 /// \code
@@ -1018,6 +1550,31 @@ private:
 /// sf::Shader::bind(nullptr);
 /// \endcode
 ///
-/// \see `sf::Glsl`
+/// Render targets created with a core profile context (see
+/// `sf::ContextSettings`) don't feed the deprecated built-in
+/// GLSL variables (`gl_Vertex`, `gl_ModelViewProjectionMatrix`,
+/// ...). Shaders used with them receive the vertex data through
+/// the `sf_position`, `sf_color` and `sf_texCoords` attributes,
+/// and the transforms through the `sf_modelViewProjection` and
+/// `sf_textureMatrix` uniforms:
+/// \code
+/// #version 150
+/// in vec2 sf_position;
+/// in vec4 sf_color;
+/// in vec2 sf_texCoords;
+/// uniform mat4 sf_modelViewProjection;
+/// uniform mat4 sf_textureMatrix;
+/// out vec4 color;
+/// out vec2 texCoords;
+///
+/// void main()
+/// {
+///     gl_Position = sf_modelViewProjection * vec4(sf_position, 0.0, 1.0);
+///     texCoords   = (sf_textureMatrix * vec4(sf_texCoords, 0.0, 1.0)).xy;
+///     color       = sf_color;
+/// }
+/// \endcode
+///
+/// \see `sf::Glsl`, `sf::UniformBuffer`
 ///
 ////////////////////////////////////////////////////////////
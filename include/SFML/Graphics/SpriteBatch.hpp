@@ -0,0 +1,346 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Sprite;
+class Texture;
+class Transform;
+
+////////////////////////////////////////////////////////////
+/// \brief Drawable collection of many textured quads sharing
+///        a single texture, rendered in one draw call
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SpriteBatch : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty sprite batch from a texture
+    ///
+    /// \param texture Source texture shared by all the instances
+    ///
+    /// \see `setTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpriteBatch(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpriteBatch(const Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the source texture of the sprite batch
+    ///
+    /// The `texture` argument refers to a texture that must
+    /// exist as long as the sprite batch uses it. Indeed, the
+    /// sprite batch doesn't store its own copy of the texture,
+    /// but rather keeps a pointer to the one that you passed
+    /// to this function.
+    ///
+    /// \param texture New texture
+    ///
+    /// \see `getTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the source texture of the sprite batch
+    ///
+    /// \return Reference to the sprite batch's texture
+    ///
+    /// \see `setTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append an instance to the batch
+    ///
+    /// An instance is rendered exactly like a `sf::Sprite`
+    /// with the given transform, texture rectangle and color.
+    ///
+    /// \param transform   Transform of the instance, relative to the batch
+    /// \param textureRect Sub-rectangle of the texture to display
+    /// \param color       Global color of the instance
+    ///
+    /// \return Index of the new instance
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t add(const Transform& transform, const IntRect& textureRect, Color color = Color::White);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append an instance copying the properties of a sprite
+    ///
+    /// The transform, texture rectangle and color of the sprite
+    /// are copied. Its texture is ignored, all instances use the
+    /// texture of the batch.
+    ///
+    /// \param sprite Sprite to copy the properties from
+    ///
+    /// \return Index of the new instance
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t add(const Sprite& sprite);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the transform of an instance
+    ///
+    /// \param index     Index of the instance
+    /// \param transform New transform of the instance, relative to the batch
+    ///
+    /// \see `getInstanceTransform`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setInstanceTransform(std::size_t index, const Transform& transform);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the texture rectangle of an instance
+    ///
+    /// \param index       Index of the instance
+    /// \param textureRect New sub-rectangle of the texture to display
+    ///
+    /// \see `getInstanceTextureRect`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setInstanceTextureRect(std::size_t index, const IntRect& textureRect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the color of an instance
+    ///
+    /// \param index Index of the instance
+    /// \param color New color of the instance
+    ///
+    /// \see `getInstanceColor`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setInstanceColor(std::size_t index, Color color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the transform of an instance
+    ///
+    /// \param index Index of the instance
+    ///
+    /// \return Transform of the instance, relative to the batch
+    ///
+    /// \see `setInstanceTransform`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Transform getInstanceTransform(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture rectangle of an instance
+    ///
+    /// \param index Index of the instance
+    ///
+    /// \return Texture rectangle of the instance
+    ///
+    /// \see `setInstanceTextureRect`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] IntRect getInstanceTextureRect(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the color of an instance
+    ///
+    /// \param index Index of the instance
+    ///
+    /// \return Color of the instance
+    ///
+    /// \see `setInstanceColor`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Color getInstanceColor(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the number of instances in the batch
+    ///
+    /// \return Number of instances
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getInstanceCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve storage for a number of instances
+    ///
+    /// \param instanceCount Number of instances to reserve storage for
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t instanceCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the instances from the batch
+    ///
+    /// The storage is kept to be reused by new instances.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the batch
+    ///
+    /// The returned rectangle is in local coordinates, which means
+    /// that it ignores the transformations (translation, rotation,
+    /// scale, ...) that are applied to the batch itself, but
+    /// contains the transformed bounds of all its instances.
+    ///
+    /// \return Local bounding rectangle of the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the batch
+    ///
+    /// The returned rectangle is in global coordinates, which means
+    /// that it takes into account the transformations (translation,
+    /// rotation, scale, ...) that are applied to the batch.
+    ///
+    /// \return Global bounding rectangle of the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getGlobalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports instanced rendering
+    ///
+    /// This function should always be called before relying
+    /// on instanced rendering. If it returns `false`, sprite
+    /// batches are still drawn in a single draw call, but their
+    /// vertices are expanded on the CPU.
+    ///
+    /// \return `true` if instanced rendering is supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isInstancingAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the sprite batch to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Expand the instances into CPU vertices if needed
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureVerticesUpdate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Built-in shader program used for instanced rendering
+    ///
+    ////////////////////////////////////////////////////////////
+    struct InstancingProgram;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Texture*                             m_texture;                  //!< Texture shared by all the instances
+    std::vector<std::array<float, 6>>          m_transforms;               //!< Affine transform rows of each instance
+    std::vector<std::array<float, 4>>          m_textureRects;             //!< Texture rectangle of each instance
+    std::vector<Color>                         m_colors;                   //!< Color of each instance
+    mutable std::vector<Vertex>                m_vertices;                 //!< CPU-expanded vertices, for the fallback path
+    mutable bool                               m_verticesNeedUpdate{true}; //!< Do the CPU-expanded vertices need an update?
+    mutable std::shared_ptr<InstancingProgram> m_program;                  //!< Shared instancing program, created on first draw
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpriteBatch
+/// \ingroup graphics
+///
+/// `sf::SpriteBatch` stores many sprite-like instances that
+/// all use the same texture and renders them with a single
+/// draw call. Each instance has its own transform, texture
+/// rectangle and color; the batch itself is also
+/// transformable as a whole.
+///
+/// Instance data is kept in tightly packed arrays, one per
+/// property, so that it can be streamed to the GPU without
+/// any conversion. When the system supports instanced
+/// rendering (see `isInstancingAvailable`), only these arrays
+/// and a single quad are submitted and the GPU expands the
+/// instances. Otherwise, or when a custom shader is used in
+/// the render states, the quads are expanded on the CPU and
+/// drawn as a single triangle list.
+///
+/// Drawing thousands of sprites through a sprite batch avoids
+/// the per-sprite virtual call, quad generation and state
+/// setup that `sf::Sprite` pays for.
+///
+/// Usage example:
+/// \code
+/// const sf::Texture texture("particles.png");
+///
+/// sf::SpriteBatch batch(texture);
+/// for (const Particle& particle : particles)
+/// {
+///     sf::Transform transform;
+///     transform.translate(particle.position).rotate(particle.angle);
+///     batch.add(transform, {{0, 0}, {8, 8}}, particle.color);
+/// }
+///
+/// window.draw(batch);
+/// \endcode
+///
+/// \see `sf::Sprite`, `sf::Texture`
+///
+////////////////////////////////////////////////////////////
@@ -42,7 +42,9 @@
 #include <SFML/System/Vector2.hpp>
 
 #include <functional>
+#include <limits>
 #include <memory>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -180,6 +182,22 @@ public:
     ////////////////////////////////////////////////////////////
     void setString(const String& string);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Append characters to the text's string
+    ///
+    /// Only the last line of the text is laid out again when
+    /// characters are appended to its string, which makes this
+    /// function suited to texts growing continuously such as
+    /// logs or consoles. The same applies when `setString` is
+    /// called with a string starting with the current one.
+    ///
+    /// \param string Characters to append
+    ///
+    /// \see `setString`, `getString`
+    ///
+    ////////////////////////////////////////////////////////////
+    void appendString(const String& string);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the text's font
     ///
@@ -722,6 +740,11 @@ public:
     /// necessary. Any changes made to the vertex data will be
     /// discarded whenever this happens.
     ///
+    /// The texture coordinates refer to the font texture given
+    /// by the `textureIndex` of each glyph, which is the first
+    /// one unless the font needed several textures to hold all
+    /// the glyphs of the character size.
+    ///
     /// \return Reference to the vertex data of this text
     ///
     ////////////////////////////////////////////////////////////
@@ -786,6 +809,52 @@ private:
     ////////////////////////////////////////////////////////////
     void ensureGeometryUpdate() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Range of vertices sampling the same font texture
+    ///
+    ////////////////////////////////////////////////////////////
+    struct TextureRange
+    {
+        std::size_t  vertexOffset{}; //!< Index of the first vertex of the range
+        unsigned int textureIndex{}; //!< Index of the font texture used by the range
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw vertices split into font texture ranges
+    ///
+    /// \param target   Render target to draw to
+    /// \param states   Current render states
+    /// \param vertices Vertices to draw
+    /// \param ranges   Font textures used by the vertices, empty if they all use the first one
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawTextureRanges(RenderTarget&                    target,
+                           RenderStates                     states,
+                           const VertexArray&               vertices,
+                           const std::vector<TextureRange>& ranges) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Layout of a line, kept to update the geometry incrementally
+    ///
+    ////////////////////////////////////////////////////////////
+    struct LineRecord
+    {
+        std::size_t stringOffset{};         //!< Index of the first character of the line in the string
+        std::size_t glyphsStart{};          //!< Index of the first glyph of the line
+        std::size_t glyphsCount{};          //!< Number of glyphs of the line
+        std::size_t verticesStart{};        //!< Index of the first fill vertex of the line
+        std::size_t verticesCount{};        //!< Number of fill vertices of the line
+        std::size_t outlineVerticesStart{}; //!< Index of the first outline vertex of the line
+        std::size_t outlineVerticesCount{}; //!< Number of outline vertices of the line
+        std::size_t firstCodepointOffset{std::numeric_limits<std::size_t>::max()}; //!< Index of the first segment of the line
+        bool     isRightToLeft{}; //!< Does the first segment of the line read from right to left?
+        float    lineWidth{};     //!< Width of the line
+        float    shift{};         //!< Horizontal shift applied to the line to align it
+        float    y{};             //!< Vertical position of the pen at the start of the line
+        Vector2f previousMin;     //!< Top-left corner of the bounds of the previous lines (unaligned)
+        Vector2f previousMax;     //!< Bottom-right corner of the bounds of the previous lines (unaligned)
+    };
+
     struct ShaperImpl;
 
     ////////////////////////////////////////////////////////////
@@ -806,11 +875,17 @@ private:
     GlyphPreProcessor     m_glyphPreProcessor;                           //!< Glyph pre-processor
     mutable VertexArray   m_vertices{PrimitiveType::Triangles};          //!< Vertex array containing the fill geometry
     mutable VertexArray   m_outlineVertices{PrimitiveType::Triangles}; //!< Vertex array containing the outline geometry
-    mutable FloatRect     m_bounds;               //!< Bounding rectangle of the text (in local coordinates)
-    mutable bool          m_geometryNeedUpdate{}; //!< Does the geometry need to be recomputed?
-    mutable std::uint64_t m_fontTextureId{};      //!< The font texture id
-    mutable std::vector<ShapedGlyph>    m_glyphs; //!< Cluster positions
-    mutable std::shared_ptr<ShaperImpl> m_shaper; //!< The shaper implementation
+    mutable FloatRect     m_bounds;                //!< Bounding rectangle of the text (in local coordinates)
+    mutable bool          m_geometryNeedUpdate{};  //!< Does the geometry need to be recomputed?
+    mutable bool          m_stringAppended{};      //!< Were characters only appended since the last update?
+    mutable std::uint64_t m_fontTextureId{};       //!< The font texture id
+    mutable std::uint64_t m_fontGlyphGeneration{}; //!< The font glyph generation
+    mutable bool          m_glyphsPending{};       //!< Were some glyphs still being loaded by the font?
+    mutable std::vector<TextureRange>   m_textureRanges;        //!< Font textures used by the fill geometry
+    mutable std::vector<TextureRange>   m_outlineTextureRanges; //!< Font textures used by the outline geometry
+    mutable std::vector<ShapedGlyph>    m_glyphs;               //!< Cluster positions
+    mutable std::vector<LineRecord>     m_lines;                //!< Layout of the lines of the text
+    mutable std::shared_ptr<ShaperImpl> m_shaper;               //!< The shaper implementation
 };
 
 } // namespace sf
@@ -36,7 +36,11 @@
 
 #include <SFML/System/Vector2.hpp>
 
+#include <array>
 #include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
 
 #include <cstddef>
 #include <cstdint>
@@ -48,6 +52,11 @@ class InputStream;
 class Window;
 class Image;
 
+namespace priv
+{
+struct CompressedImage;
+}
+
 ////////////////////////////////////////////////////////////
 /// \brief Image living on the graphics card that can be used for drawing
 ///
@@ -55,6 +64,20 @@ class Image;
 class SFML_GRAPHICS_API Texture : GlResource
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Staging memory of an asynchronous texture update
+    ///
+    /// \see `beginAsyncUpdate`, `endAsyncUpdate`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct AsyncUpdate
+    {
+        std::uint8_t* pixels{};  //!< Memory to fill with the RGBA pixels of the area, from any thread
+        Vector2u      size;      //!< Size of the area to update
+        Vector2u      dest;      //!< Position of the area to update
+        std::size_t   staging{}; //!< Index of the staging buffer holding the pixels
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -290,6 +313,10 @@ public:
     /// The maximum size for a texture depends on the graphics
     /// driver and can be retrieved with the `getMaximumSize` function.
     ///
+    /// Besides the formats supported by `sf::Image`, DDS, KTX and
+    /// KTX2 files containing GPU compressed images are accepted,
+    /// see the class description for details.
+    ///
     /// If this function fails, the texture is left unchanged.
     ///
     /// \param filename Path of the image file to load
@@ -315,6 +342,10 @@ public:
     /// The maximum size for a texture depends on the graphics
     /// driver and can be retrieved with the `getMaximumSize` function.
     ///
+    /// Besides the formats supported by `sf::Image`, DDS, KTX and
+    /// KTX2 files containing GPU compressed images are accepted,
+    /// see the class description for details.
+    ///
     /// If this function fails, the texture is left unchanged.
     ///
     /// \param data Pointer to the file data in memory
@@ -341,6 +372,10 @@ public:
     /// The maximum size for a texture depends on the graphics
     /// driver and can be retrieved with the `getMaximumSize` function.
     ///
+    /// Besides the formats supported by `sf::Image`, DDS, KTX and
+    /// KTX2 files containing GPU compressed images are accepted,
+    /// see the class description for details.
+    ///
     /// If this function fails, the texture is left unchanged.
     ///
     /// \param stream Source stream to read from
@@ -551,6 +586,165 @@ public:
     ////////////////////////////////////////////////////////////
     void update(const Window& window, Vector2u dest);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start an asynchronous update of a part of the texture
+    ///
+    /// This function provides staging memory for the pixels of
+    /// the area to update. It can be filled from any thread,
+    /// including threads without an active OpenGL context,
+    /// then the update is submitted with `endAsyncUpdate`.
+    ///
+    /// When pixel buffer objects are supported, the staging
+    /// memory is mapped from one of them, so that the pixels
+    /// are transferred to the texture by the graphics driver
+    /// without stalling the calling thread. Several updates
+    /// can be in progress at the same time, each of them uses
+    /// its own staging buffer.
+    ///
+    /// \param size Width and height of the area to update
+    /// \param dest Coordinates of the destination position
+    ///
+    /// \return Staging memory of the update, or `std::nullopt`
+    ///         if the texture was not previously created or
+    ///         the area is outside of the texture
+    ///
+    /// \see `endAsyncUpdate`, `updateAsync`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<AsyncUpdate> beginAsyncUpdate(Vector2u size, Vector2u dest);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit an asynchronous update of a part of the texture
+    ///
+    /// The staging memory of the update must have been filled
+    /// and must not be accessed anymore. The returned ticket
+    /// can be polled with `isUpdateComplete` to know when the
+    /// graphics driver has finished transferring the pixels.
+    /// Drawing the texture always uses the updated pixels,
+    /// it is not necessary to wait for the transfer.
+    ///
+    /// \param asyncUpdate Update started with `beginAsyncUpdate`
+    ///
+    /// \return Ticket identifying the update
+    ///
+    /// \see `beginAsyncUpdate`, `isUpdateComplete`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t endAsyncUpdate(const AsyncUpdate& asyncUpdate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture asynchronously from an array of pixels
+    ///
+    /// The pixels are copied to staging memory, then the update
+    /// is submitted like with `beginAsyncUpdate` and
+    /// `endAsyncUpdate`.
+    ///
+    /// The size of the pixel array must match the `size` argument,
+    /// and it must contain 32-bits RGBA pixels.
+    ///
+    /// \param pixels Array of pixels to copy to the texture
+    /// \param size   Width and height of the pixel region contained in `pixels`
+    /// \param dest   Coordinates of the destination position
+    ///
+    /// \return Ticket identifying the update, 0 if the texture was not updated
+    ///
+    /// \see `isUpdateComplete`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t updateAsync(const std::uint8_t* pixels, Vector2u size, Vector2u dest);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether an asynchronous update is complete
+    ///
+    /// This function never blocks. Without fence support in the
+    /// graphics driver, updates are reported complete as soon
+    /// as they are submitted.
+    ///
+    /// \param ticket Ticket returned by `endAsyncUpdate` or `updateAsync`
+    ///
+    /// \return `true` if the pixels were transferred to the texture
+    ///
+    /// \see `waitForUpdate`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isUpdateComplete(std::uint64_t ticket) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until an asynchronous update is complete
+    ///
+    /// \param ticket Ticket returned by `endAsyncUpdate` or `updateAsync`
+    ///
+    /// \see `isUpdateComplete`
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitForUpdate(std::uint64_t ticket) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start copying the texture to an image without blocking
+    ///
+    /// Unlike `copyToImage`, this function doesn't wait for the
+    /// graphics driver: the pixels are read into a pixel buffer
+    /// object while the application keeps rendering, so that the
+    /// capture of a frame is typically ready a couple of frames
+    /// later. The image is retrieved with `pollAsyncCopy`,
+    /// `waitForAsyncCopy` or, if a callback was given, by
+    /// `processAsyncCopies`. Each copy is delivered only once.
+    ///
+    /// A small ring of copies can be in flight at the same time.
+    /// When all of them are busy, the oldest copy is completed
+    /// synchronously and its image is kept until it is retrieved.
+    ///
+    /// When pixel buffer objects are not supported, the copy is
+    /// performed synchronously with `copyToImage`.
+    ///
+    /// \param callback Function called with the image once the copy is complete (optional)
+    ///
+    /// \return Ticket identifying the copy, 0 if the texture is empty
+    ///
+    /// \see `pollAsyncCopy`, `waitForAsyncCopy`, `processAsyncCopies`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::uint64_t copyToImageAsync(std::function<void(Image&&)> callback = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the image of an asynchronous copy if it is complete
+    ///
+    /// This function never blocks.
+    ///
+    /// \param ticket Ticket returned by `copyToImageAsync`
+    ///
+    /// \return Copied image, or `std::nullopt` if the copy is not
+    ///         complete yet or was already delivered
+    ///
+    /// \see `copyToImageAsync`, `waitForAsyncCopy`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Image> pollAsyncCopy(std::uint64_t ticket);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until an asynchronous copy is complete and retrieve its image
+    ///
+    /// \param ticket Ticket returned by `copyToImageAsync`
+    ///
+    /// \return Copied image, or `std::nullopt` if the copy was already delivered
+    ///
+    /// \see `copyToImageAsync`, `pollAsyncCopy`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Image> waitForAsyncCopy(std::uint64_t ticket);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deliver the complete asynchronous copies to their callbacks
+    ///
+    /// This function never blocks, it is meant to be called once
+    /// per frame. Callbacks are invoked from the calling thread.
+    /// Copies started without a callback are left untouched.
+    ///
+    /// \see `copyToImageAsync`
+    ///
+    ////////////////////////////////////////////////////////////
+    void processAsyncCopies();
+
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable the smooth filter
     ///
@@ -711,11 +905,26 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static unsigned int getMaximumSize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether asynchronous updates are transferred by the graphics driver
+    ///
+    /// Asynchronous updates are available everywhere, but when
+    /// pixel buffer objects are not supported, `endAsyncUpdate`
+    /// copies the pixels to the texture synchronously.
+    ///
+    /// \return `true` if pixel buffer objects are supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAsyncUpdateAvailable();
+
 private:
     friend class Text;
     friend class RenderTexture;
     friend class RenderTarget;
 
+    struct StagingPool;
+    struct ReadbackRing;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get a valid image size according to hardware support
     ///
@@ -731,6 +940,22 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static unsigned int getValidSize(unsigned int size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the texture from a GPU compressed image
+    ///
+    /// The blocks are uploaded as they are when the graphics
+    /// driver supports their format, otherwise the base level
+    /// is decoded and loaded like an `sf::Image`.
+    ///
+    /// \param image Compressed image read from a DDS, KTX or KTX2 file
+    /// \param sRgb  `true` to enable sRGB conversion, `false` to use the setting of the file
+    /// \param area  Area of the image to load
+    ///
+    /// \return `true` if loading was successful, `false` if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromCompressedImage(const priv::CompressedImage& image, bool sRgb, const IntRect& area);
+
     ////////////////////////////////////////////////////////////
     /// \brief Invalidate the mipmap if one exists
     ///
@@ -740,19 +965,36 @@ private:
     ////////////////////////////////////////////////////////////
     void invalidateMipmap();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the matrix that maps texture coordinates to normalized OpenGL coordinates
+    ///
+    /// The matrix accounts for pixel coordinates, padding of
+    /// textures whose actual size is a power of two and
+    /// flipped pixels.
+    ///
+    /// \param coordinateType Type of texture coordinates to map
+    ///
+    /// \return Column-major 4x4 texture matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::array<float, 16> getTextureMatrix(CoordinateType coordinateType) const;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Vector2u      m_size;            //!< Public texture size
-    Vector2u      m_actualSize;      //!< Actual texture size (can be greater than public size because of padding)
-    unsigned int  m_texture{};       //!< Internal texture identifier
-    bool          m_isSmooth{};      //!< Status of the smooth filter
-    bool          m_sRgb{};          //!< Should the texture source be converted from sRGB?
-    bool          m_isRepeated{};    //!< Is the texture in repeat mode?
-    mutable bool  m_pixelsFlipped{}; //!< To work around the inconsistency in Y orientation
-    bool          m_fboAttachment{}; //!< Is this texture owned by a framebuffer object?
-    bool          m_hasMipmap{};     //!< Has the mipmap been generated?
-    std::uint64_t m_cacheId;         //!< Unique number that identifies the texture to the render target's cache
+    Vector2u                      m_size;            //!< Public texture size
+    Vector2u                      m_actualSize;      //!< Actual texture size (can be greater than public size because of padding)
+    unsigned int                  m_texture{};       //!< Internal texture identifier
+    bool                          m_isSmooth{};      //!< Status of the smooth filter
+    bool                          m_sRgb{};          //!< Should the texture source be converted from sRGB?
+    bool                          m_isRepeated{};    //!< Is the texture in repeat mode?
+    mutable bool                  m_pixelsFlipped{}; //!< To work around the inconsistency in Y orientation
+    bool                          m_fboAttachment{}; //!< Is this texture owned by a framebuffer object?
+    bool                          m_hasMipmap{};     //!< Has the mipmap been generated?
+    bool                          m_isCompressed{};  //!< Does the texture store compressed blocks?
+    std::uint64_t                 m_cacheId;         //!< Unique number that identifies the texture to the render target's cache
+    std::unique_ptr<StagingPool>  m_stagingPool;     //!< Staging buffers of the asynchronous updates
+    std::unique_ptr<ReadbackRing> m_readbackRing;    //!< Pixel buffers of the asynchronous copies
 };
 
 ////////////////////////////////////////////////////////////
@@ -819,6 +1061,18 @@ SFML_GRAPHICS_API void swap(Texture& left, Texture& right) noexcept;
 /// This option is only useful in conjunction with an sRGB capable
 /// framebuffer. This can be requested during window creation.
 ///
+/// Textures can also be loaded from DDS, KTX and KTX2 files holding
+/// GPU compressed images (BC1 to BC5, BC7, ETC1 and ETC2). When the
+/// graphics driver supports the format, the compressed blocks and
+/// the mipmap levels stored in the file are uploaded as they are:
+/// loading is faster and the texture uses 4 to 8 times less video
+/// memory. Otherwise, or when only a part of the image is loaded,
+/// the base level is decoded on the CPU and the texture is loaded
+/// like any other image. Formats declared as sRGB in the file are
+/// loaded with sRGB conversion enabled. The pixels of a compressed
+/// texture can't be changed with `update`, it can be copied or read
+/// back to an image though.
+///
 /// Usage example:
 /// \code
 /// // This example shows the most common use of sf::Texture:
@@ -0,0 +1,304 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <deque>
+#include <filesystem>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Packs many images into a few shared textures
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureAtlas
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of an image added to the atlas
+    ///
+    /// Handles are given in the order the images are added,
+    /// starting from 0.
+    ///
+    ////////////////////////////////////////////////////////////
+    using Handle = std::size_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty atlas
+    ///
+    /// The padding is left around every image, so that the
+    /// texture filter doesn't sample the neighbor images. When
+    /// extrusion is enabled, the padding is filled with the
+    /// border pixels of the image instead of transparent pixels,
+    /// which also avoids seams between tiles drawn side by side.
+    ///
+    /// \param pageSize Size of the textures that the images are packed into
+    /// \param padding  Number of pixels left around every image
+    /// \param extrude  Fill the padding with the border pixels of the images?
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureAtlas(Vector2u pageSize = {2048, 2048}, unsigned int padding = 1, bool extrude = true);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an image to the atlas
+    ///
+    /// The image is stored until the next call to `pack`, which
+    /// places it into one of the textures of the atlas.
+    ///
+    /// \param image Image to add
+    ///
+    /// \return Handle identifying the image in the atlas
+    ///
+    /// \see `pack`
+    ///
+    ////////////////////////////////////////////////////////////
+    Handle add(Image image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pack the images added since the last call into the textures
+    ///
+    /// Images are placed with the MaxRects algorithm, the largest
+    /// ones first, into the free space left in the existing
+    /// textures; new textures are created when they are full.
+    /// Images whose position was restored with `loadLayoutFromFile`
+    /// are placed at that position without searching, provided
+    /// that their size didn't change.
+    ///
+    /// Textures which already exist keep their identity, so that
+    /// sprites using them stay valid.
+    ///
+    /// \return `true` if all the images were packed, `false` if
+    ///         some of them are larger than a texture or a texture
+    ///         couldn't be created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool pack();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture containing a packed image
+    ///
+    /// \param handle Handle returned by `add`, the image must have been packed
+    ///
+    /// \return Texture containing the image
+    ///
+    /// \see `getTextureRect`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the area of a packed image in its texture
+    ///
+    /// The rectangle excludes the padding, it can be given
+    /// directly to `sf::Sprite` along with `getTexture`.
+    ///
+    /// \param handle Handle returned by `add`, the image must have been packed
+    ///
+    /// \return Texture rectangle of the image
+    ///
+    /// \see `getTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] IntRect getTextureRect(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of images added to the atlas
+    ///
+    /// \return Number of images, packed or not
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getImageCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of textures of the atlas
+    ///
+    /// \return Number of textures
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPageCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a texture of the atlas
+    ///
+    /// \param index Index of the texture, must be less than `getPageCount()`
+    ///
+    /// \return Texture at the given index
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getPage(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter of all the textures
+    ///
+    /// \param smooth `true` to enable smoothing, `false` to disable it
+    ///
+    /// \see `Texture::setSmooth`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the positions of the packed images to a file
+    ///
+    /// The layout only depends on the sizes of the images, it can
+    /// be restored at the next startup with `loadLayoutFromFile`
+    /// to skip the search for free space.
+    ///
+    /// \param filename Path of the file to save
+    ///
+    /// \return `true` if saving was successful
+    ///
+    /// \see `loadLayoutFromFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool saveLayoutToFile(const std::filesystem::path& filename) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the positions of the images from a file
+    ///
+    /// The layout applies to the images which are added and
+    /// packed afterwards, matched by handle. It must have been
+    /// saved by an atlas with the same page size, padding and
+    /// extrusion.
+    ///
+    /// \param filename Path of the file to load
+    ///
+    /// \return `true` if loading was successful
+    ///
+    /// \see `saveLayoutToFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadLayoutFromFile(const std::filesystem::path& filename);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Texture of the atlas and its free space
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Page
+    {
+        Texture              texture;   //!< Texture containing the images
+        std::vector<IntRect> freeRects; //!< Maximal free rectangles of the texture
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Position of an image in the atlas
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        std::size_t page{}; //!< Index of the texture containing the image
+        IntRect     rect;   //!< Area of the image in the texture, empty if not packed
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a new texture
+    ///
+    /// \return `true` if the texture was created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool addPage();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy an image and its padding to its place in the atlas
+    ///
+    /// \param image Image to copy
+    /// \param entry Position of the image
+    ///
+    ////////////////////////////////////////////////////////////
+    void upload(const Image& image, const Entry& entry);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u                              m_pageSize;   //!< Size of the textures
+    unsigned int                          m_padding;    //!< Number of pixels left around every image
+    bool                                  m_extrude;    //!< Fill the padding with the border pixels of the images?
+    bool                                  m_isSmooth{}; //!< Status of the smooth filter of the textures
+    std::deque<Page>                      m_pages;      //!< Textures of the atlas (deque keeps references stable)
+    std::vector<Entry>                    m_entries;    //!< Positions of the images, indexed by handle
+    std::vector<std::pair<Handle, Image>> m_pending;    //!< Images waiting to be packed
+    std::vector<Entry>                    m_layout;     //!< Positions restored from a layout file, indexed by handle
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureAtlas
+/// \ingroup graphics
+///
+/// `sf::TextureAtlas` packs many small images into a few large
+/// textures. Sprites drawn from the same texture don't require
+/// any texture change between them, so that render targets can
+/// skip the state changes and batch the draws.
+///
+/// Images are added first, then packed all at once so that the
+/// largest ones are placed first, which wastes less space. The
+/// handle returned for each image gives the texture and texture
+/// rectangle to use with `sf::Sprite`.
+///
+/// Searching for free space takes time with thousands of images.
+/// The resulting layout can be saved with `saveLayoutToFile` and
+/// restored at the next startup with `loadLayoutFromFile`, so
+/// that packing just copies the images to their known position.
+///
+/// Usage example:
+/// \code
+/// sf::TextureAtlas atlas;
+/// if (!atlas.loadLayoutFromFile("sprites.layout"))
+///     std::cout << "Packing sprites for the first time" << std::endl;
+///
+/// std::vector<sf::TextureAtlas::Handle> handles;
+/// for (const std::filesystem::path& path : spritePaths)
+///     handles.push_back(atlas.add(sf::Image(path)));
+///
+/// if (!atlas.pack())
+///     return -1;
+///
+/// (void)atlas.saveLayoutToFile("sprites.layout");
+///
+/// sf::Sprite sprite(atlas.getTexture(handles[0]), atlas.getTextureRect(handles[0]));
+/// \endcode
+///
+/// \see `sf::Texture`, `sf::Sprite`
+///
+////////////////////////////////////////////////////////////
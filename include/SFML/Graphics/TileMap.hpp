@@ -0,0 +1,327 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class RenderTarget;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Grid of tiles from a tileset, drawn chunk by chunk from static vertex buffers
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TileMap : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Index of the empty tile, which draws nothing
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr unsigned int EmptyTile = std::numeric_limits<unsigned int>::max();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty tile map
+    ///
+    /// All the tiles are initialized to `EmptyTile`.
+    ///
+    /// \param tileset    Texture containing the tiles
+    /// \param tileSize   Size of a tile in the tileset and in the map, in pixels
+    /// \param mapSize    Size of the map, in tiles
+    /// \param layerCount Number of layers, drawn in increasing order
+    /// \param chunkSize  Size of a chunk, in tiles
+    ///
+    /// \see `setTile`
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(const Texture& tileset,
+            Vector2u       tileSize,
+            Vector2u       mapSize,
+            std::size_t    layerCount = 1,
+            Vector2u       chunkSize  = {32, 32});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(const Texture&& tileset,
+            Vector2u        tileSize,
+            Vector2u        mapSize,
+            std::size_t     layerCount = 1,
+            Vector2u        chunkSize  = {32, 32}) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a tile of the map
+    ///
+    /// Tiles are numbered from left to right then top to bottom
+    /// in the tileset. Only the chunk containing the tile is
+    /// rebuilt, the next time it is drawn.
+    ///
+    /// \param layer    Index of the layer
+    /// \param position Position of the tile in the map, in tiles
+    /// \param tile     Index of the tile in the tileset, or `EmptyTile`
+    ///
+    /// \see `getTile`, `setTiles`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTile(std::size_t layer, Vector2u position, unsigned int tile);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change all the tiles of a layer
+    ///
+    /// \param layer Index of the layer
+    /// \param tiles Indices of the tiles, row by row; the array must contain `mapSize.x * mapSize.y` elements
+    ///
+    /// \see `setTile`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTiles(std::size_t layer, const unsigned int* tiles);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a tile of the map
+    ///
+    /// \param layer    Index of the layer
+    /// \param position Position of the tile in the map, in tiles
+    ///
+    /// \return Index of the tile in the tileset, or `EmptyTile`
+    ///
+    /// \see `setTile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getTile(std::size_t layer, Vector2u position) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the tileset of the map
+    ///
+    /// The tileset must stay alive as long as the map uses it.
+    /// All the chunks are rebuilt the next time they are drawn.
+    ///
+    /// \param tileset New tileset
+    ///
+    /// \see `getTileset`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTileset(const Texture& tileset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTileset(const Texture&& tileset) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the tileset of the map
+    ///
+    /// \return Reference to the tileset
+    ///
+    /// \see `setTileset`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTileset() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a tile
+    ///
+    /// \return Size of a tile, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getTileSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the map
+    ///
+    /// \return Size of the map, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getMapSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a chunk
+    ///
+    /// \return Size of a chunk, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getChunkSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of layers
+    ///
+    /// \return Number of layers
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getLayerCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the map
+    ///
+    /// The returned rectangle is in local coordinates, which means
+    /// that it ignores the transformations (translation, rotation,
+    /// scale, ...) that are applied to the entity.
+    ///
+    /// \return Local bounding rectangle of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the map
+    ///
+    /// The returned rectangle is in global coordinates, which means
+    /// that it takes into account the transformations (translation,
+    /// rotation, scale, ...) that are applied to the entity.
+    ///
+    /// \return Global bounding rectangle of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getGlobalBounds() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the visible chunks to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounding rectangle of a chunk
+    ///
+    /// \param index Index of the chunk in a layer
+    ///
+    /// \return Bounding rectangle of the chunk, in local coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getChunkBounds(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rebuild the vertices of a chunk from its tiles
+    ///
+    /// \param layer Index of the layer
+    /// \param index Index of the chunk in the layer
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateChunk(std::size_t layer, std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Geometry of the tiles of a layer within a chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        std::optional<VertexBuffer> buffer;        //!< Static vertex buffer holding the tiles, created on first draw
+        std::vector<Vertex>         vertices;      //!< Tiles kept in client memory when vertex buffers can't be used
+        std::size_t                 vertexCount{}; //!< Number of vertices of the non-empty tiles
+        bool                        dirty{true};   //!< Must the vertices be rebuilt before drawing?
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Texture*              m_tileset;    //!< Texture containing the tiles
+    Vector2u                    m_tileSize;   //!< Size of a tile, in pixels
+    Vector2u                    m_mapSize;    //!< Size of the map, in tiles
+    Vector2u                    m_chunkSize;  //!< Size of a chunk, in tiles
+    Vector2u                    m_chunkCount; //!< Number of chunks in each direction
+    std::size_t                 m_layerCount; //!< Number of layers
+    std::vector<unsigned int>   m_tiles;      //!< Tiles of all the layers, layer by layer then row by row
+    mutable std::vector<Chunk>  m_chunks;     //!< Chunks of all the layers, layer by layer then row by row
+    mutable std::vector<Vertex> m_vertices;   //!< Temporary storage used when rebuilding a chunk
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TileMap
+/// \ingroup graphics
+///
+/// `sf::TileMap` draws a grid of tiles taken from a tileset, a
+/// texture in which the tiles are laid out in rows, like a
+/// spritesheet. It can hold several layers of tiles, drawn on
+/// top of each other, which all share the tileset so that the
+/// whole map is drawn with a single texture.
+///
+/// The map is divided into chunks of a fixed number of tiles.
+/// Each chunk of each layer is stored in its own static
+/// `sf::VertexBuffer`, so drawing the map doesn't send any vertex
+/// to the graphics card: the vertices of a chunk are only uploaded
+/// when one of its tiles has changed, and only for that chunk.
+/// Chunks which are outside the view of the render target are
+/// skipped, and aren't rebuilt until they become visible; they are
+/// counted as one culled draw call per layer in the frame
+/// statistics of the render target. When vertex buffers aren't
+/// available, the chunks are drawn from client memory instead.
+///
+/// Small chunks make edits and culling cheaper but need more draw
+/// calls, larger chunks the opposite. The default of 32x32 tiles
+/// suits most maps.
+///
+/// The tileset must stay alive as long as the map uses it, like
+/// the texture of a `sf::Sprite`. Since `sf::TileMap` inherits
+/// `sf::Transformable`, the whole map can be moved, rotated and
+/// scaled.
+///
+/// Usage example:
+/// \code
+/// const sf::Texture tileset("tileset.png");
+///
+/// // A 256x256 map of 16x16 pixels tiles, with a ground and a decoration layer
+/// sf::TileMap map(tileset, {16, 16}, {256, 256}, 2);
+/// map.setTiles(0, level.ground.data());
+/// map.setTiles(1, level.decorations.data());
+///
+/// // Later, when the player digs a hole
+/// map.setTile(0, {12, 34}, holeTile);
+///
+/// window.draw(map);
+/// \endcode
+///
+/// \see `sf::VertexBuffer`, `sf::Texture`, `sf::Transformable`
+///
+////////////////////////////////////////////////////////////
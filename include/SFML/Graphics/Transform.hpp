@@ -35,10 +35,13 @@
 
 #include <array>
 
+#include <cstddef>
+
 
 namespace sf
 {
 class Angle;
+struct Vertex;
 
 ////////////////////////////////////////////////////////////
 /// \brief 3x3 transform matrix
@@ -131,6 +134,75 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] constexpr FloatRect transformRect(const FloatRect& rectangle) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform an array of points
+    ///
+    /// This is equivalent to calling `transformPoint` on each
+    /// point, but several points are transformed at once with
+    /// vector instructions where the CPU supports them.
+    ///
+    /// \p result may be equal to \p points to transform the
+    /// points in place, otherwise the arrays must not overlap.
+    ///
+    /// \param points Array of points to transform
+    /// \param count  Number of points in the array
+    /// \param result Array receiving the transformed points
+    ///
+    ////////////////////////////////////////////////////////////
+    SFML_GRAPHICS_API void transformPoints(const Vector2f* points, std::size_t count, Vector2f* result) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform the positions of an array of vertices
+    ///
+    /// The colors and texture coordinates are copied unchanged.
+    /// \p result may be equal to \p vertices to transform the
+    /// vertices in place, otherwise the arrays must not overlap.
+    ///
+    /// \param vertices Array of vertices to transform
+    /// \param count    Number of vertices in the array
+    /// \param result   Array receiving the transformed vertices
+    ///
+    /// \see `transformPoints`
+    ///
+    ////////////////////////////////////////////////////////////
+    SFML_GRAPHICS_API void transformVertices(const Vertex* vertices, std::size_t count, Vertex* result) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the bounding rectangle of an array of transformed points
+    ///
+    /// The points are transformed and bounded in a single pass.
+    /// If \p result is not null, the transformed points are also
+    /// written to it, like `transformPoints` does.
+    ///
+    /// \param points Array of points to transform
+    /// \param count  Number of points in the array
+    /// \param result Array receiving the transformed points, can be null
+    ///
+    /// \return Bounding rectangle of the transformed points, empty if \p count is 0
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SFML_GRAPHICS_API FloatRect getTransformedBounds(const Vector2f* points,
+                                                                   std::size_t     count,
+                                                                   Vector2f*       result = nullptr) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the bounding rectangle of an array of transformed vertices
+    ///
+    /// The positions are transformed and bounded in a single
+    /// pass. If \p result is not null, the transformed vertices
+    /// are also written to it, like `transformVertices` does.
+    ///
+    /// \param vertices Array of vertices to transform
+    /// \param count    Number of vertices in the array
+    /// \param result   Array receiving the transformed vertices, can be null
+    ///
+    /// \return Bounding rectangle of the transformed positions, empty if \p count is 0
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SFML_GRAPHICS_API FloatRect getTransformedBounds(const Vertex* vertices,
+                                                                   std::size_t   count,
+                                                                   Vertex*       result = nullptr) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Combine the current transform with another one
     ///
@@ -386,6 +458,10 @@ constexpr Transform& operator*=(Transform& left, const Transform& right);
 /// // use the result to transform stuff...
 /// sf::Vector2f point = transform.transformPoint({10, 20});
 /// sf::FloatRect rect = transform.transformRect(sf::FloatRect({0, 0}, {10, 100}));
+///
+/// // transform many points at once
+/// std::vector<sf::Vector2f> points = ...;
+/// transform.transformPoints(points.data(), points.size(), points.data());
 /// \endcode
 ///
 /// \see `sf::Transformable`, `sf::RenderStates`
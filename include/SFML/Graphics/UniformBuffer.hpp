@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Buffer of uniform values shared by several shaders
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API UniformBuffer : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty uniform buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UniformBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(UniformBuffer&& source) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(UniformBuffer&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the uniform buffer
+    ///
+    /// Creates the uniform buffer and allocates enough graphics
+    /// memory to hold `size` bytes. Any previously allocated
+    /// memory is freed in the process.
+    ///
+    /// In order to deallocate previously allocated memory pass 0
+    /// as `size`. Don't forget to recreate with a non-zero value
+    /// when graphics memory should be allocated again.
+    ///
+    /// \param size Size of the buffer, in bytes
+    ///
+    /// \return `true` if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of bytes
+    ///
+    /// The data must follow the layout of the uniform block in
+    /// the shaders, typically `std140`. Updating the whole
+    /// buffer lets the driver discard its previous contents
+    /// instead of waiting for the draw calls still using them.
+    ///
+    /// \param data   Pointer to the bytes to copy
+    /// \param size   Number of bytes to copy
+    /// \param offset Offset in the buffer to copy to, in bytes
+    ///
+    /// \return `true` if the update was successful, `false` if the range exceeds the size of the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* data, std::size_t size, std::size_t offset = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the buffer
+    ///
+    /// \return Size of the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the uniform buffer.
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the uniform buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports uniform buffers
+    ///
+    /// This function should always be called before using
+    /// the uniform buffer features. If it returns `false`, then
+    /// any attempt to use `sf::UniformBuffer` will fail.
+    ///
+    /// \return `true` if uniform buffers are supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_buffer{}; //!< Internal buffer identifier
+    std::size_t  m_size{};   //!< Size of the buffer, in bytes
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UniformBuffer
+/// \ingroup graphics
+///
+/// `sf::UniformBuffer` stores the values of a GLSL uniform
+/// block in graphics memory. Unlike the uniforms set with
+/// `sf::Shader::setUniform`, which belong to a single program,
+/// a uniform buffer can be attached to any number of shaders:
+/// data common to many materials, like the camera or the time,
+/// is uploaded once per frame and read by all of them.
+///
+/// The layout of the data is described by the uniform block in
+/// GLSL. The `std140` layout is recommended, since its offsets
+/// are the same on every driver; beware that it aligns `vec3`
+/// and `vec4` members, as well as array elements, on 16 bytes.
+///
+/// Uniform buffers require OpenGL 3.1, `isAvailable` tells
+/// whether the system supports them.
+///
+/// Usage example:
+/// \code
+/// // layout(std140) uniform Frame { vec4 tint; float time; };
+/// struct Frame
+/// {
+///     sf::Glsl::Vec4 tint;
+///     float time;
+/// };
+///
+/// sf::UniformBuffer frameBuffer;
+/// if (!frameBuffer.create(sizeof(Frame)))
+///     return -1;
+///
+/// shader1.setUniformBlock("Frame", frameBuffer);
+/// shader2.setUniformBlock("Frame", frameBuffer);
+///
+/// while (window.isOpen())
+/// {
+///     const Frame frame{sf::Glsl::Vec4(sf::Color::White), clock.getElapsedTime().asSeconds()};
+///     (void)frameBuffer.update(&frame, sizeof(frame));
+///
+///     window.draw(sprite1, &shader1);
+///     window.draw(sprite2, &shader2);
+///     ...
+/// }
+/// \endcode
+///
+/// \see `sf::Shader`
+///
+////////////////////////////////////////////////////////////
@@ -35,6 +35,8 @@
 
 #include <SFML/Window/GlResource.hpp>
 
+#include <memory>
+
 #include <cstddef>
 
 
@@ -59,6 +61,14 @@ public:
     /// usage to Static. For everything else Dynamic should be a
     /// good compromise.
     ///
+    /// Stream buffers are ring-buffered when the system supports
+    /// it: each update writes to the next of several segments,
+    /// so that it doesn't have to wait for the GPU to finish
+    /// drawing the previous contents. The GPU progress is tracked
+    /// in the context which is active during the update, so such
+    /// buffers must be updated while the context of the render
+    /// target that draws them is active.
+    ///
     ////////////////////////////////////////////////////////////
     enum class Usage
     {
@@ -67,13 +77,24 @@ public:
         Static   //!< Rarely changing data
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Range of vertices to write in a batched update
+    ///
+    ////////////////////////////////////////////////////////////
+    struct UpdateRange
+    {
+        const Vertex* vertices{};    //!< Array of vertices to copy to the buffer
+        std::size_t   vertexCount{}; //!< Number of vertices to copy
+        std::size_t   offset{};      //!< Offset in the buffer to copy to, in vertices
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
     /// Creates an empty vertex buffer.
     ///
     ////////////////////////////////////////////////////////////
-    VertexBuffer() = default;
+    VertexBuffer();
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct a `VertexBuffer` with a specific `PrimitiveType`
@@ -200,6 +221,26 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool update(const Vertex* vertices, std::size_t vertexCount, unsigned int offset);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update several parts of the buffer at once
+    ///
+    /// All the ranges are written with a single bind of the
+    /// buffer. When the buffer is ring-buffered, they all land
+    /// in the same segment and the vertices which aren't covered
+    /// by any range keep their previous value.
+    ///
+    /// Unlike the other overloads, this function never resizes
+    /// the buffer: the update fails if a range exceeds the size
+    /// of the currently created buffer or has no vertices.
+    ///
+    /// \param ranges     Array of ranges to write
+    /// \param rangeCount Number of ranges in the array
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const UpdateRange* ranges, std::size_t rangeCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy the contents of another buffer into this buffer
     ///
@@ -240,6 +281,20 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] unsigned int getNativeHandle() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the offset of the segment holding the latest data
+    ///
+    /// Ring-buffered Stream buffers allocate several segments of
+    /// `getVertexCount()` vertices and move to the next one with
+    /// each update. `sf::RenderTarget` draws from the current
+    /// segment automatically; this offset is only needed to source
+    /// the buffer from your own OpenGL code.
+    ///
+    /// \return Index of the first vertex of the current segment in the underlying buffer, 0 if not ring-buffered
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSegmentOffset() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the type of primitives to draw
     ///
@@ -321,7 +376,21 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static bool isAvailable();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports ring-buffered Stream buffers
+    ///
+    /// This requires fence sync objects, buffer copies and
+    /// buffer range mapping. If it returns `false`, Stream
+    /// buffers are updated in place like the other usages.
+    ///
+    /// \return `true` if Stream buffers are ring-buffered, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isStreamRingAvailable();
+
 private:
+    struct StreamRing;
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the vertex buffer to a render target
     ///
@@ -331,13 +400,36 @@ private:
     ////////////////////////////////////////////////////////////
     void draw(RenderTarget& target, RenderStates states) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Allocate the storage of the buffer
+    ///
+    /// The storage is split into segments if the buffer is
+    /// ring-buffered. The buffer must be bound.
+    ///
+    /// \param vertexCount Number of vertices worth of memory to allocate per segment
+    ///
+    ////////////////////////////////////////////////////////////
+    void allocate(std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write ranges of vertices to the buffer
+    ///
+    /// The ranges must fit in the buffer, which must be bound.
+    ///
+    /// \param ranges     Array of ranges to write
+    /// \param rangeCount Number of ranges in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void write(const UpdateRange* ranges, std::size_t rangeCount);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int  m_buffer{};                             //!< Internal buffer identifier
-    std::size_t   m_size{};                               //!< Size in Vertices of the currently allocated buffer
-    PrimitiveType m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
-    Usage         m_usage{Usage::Stream};                 //!< How this vertex buffer is to be used
+    unsigned int                m_buffer{};                             //!< Internal buffer identifier
+    std::size_t                 m_size{};                               //!< Size in Vertices of the allocated buffer
+    PrimitiveType               m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
+    Usage                       m_usage{Usage::Stream};                 //!< How this vertex buffer is to be used
+    std::unique_ptr<StreamRing> m_streamRing;                           //!< Segments of a ring-buffered Stream buffer
 };
 
 ////////////////////////////////////////////////////////////
@@ -395,6 +487,29 @@ SFML_GRAPHICS_API void swap(VertexBuffer& left, VertexBuffer& right) noexcept;
 /// pending data transfers complete before the vertex buffer is sourced
 /// by the rendering pipeline.
 ///
+/// Buffers with the Stream usage are meant to be rewritten every frame.
+/// When the system supports it, they hold several segments of
+/// `getVertexCount()` vertices in graphics memory and each update writes
+/// to the next one, so that the CPU never waits for the GPU to finish
+/// drawing the previous contents. Several ranges can be written in one
+/// update with the `UpdateRange` overload, the rest of the segment keeps
+/// the previous data. The segments are released by fences inserted in
+/// the context which is active during the update: update such buffers
+/// from the thread drawing them, while its render target is active
+/// (which is the case after drawing to it), otherwise a segment may be
+/// overwritten before the GPU is done drawing it.
+///
+/// \code
+/// sf::VertexBuffer particles(sf::PrimitiveType::Points, sf::VertexBuffer::Usage::Stream);
+/// particles.create(1000);
+/// ...
+/// // Every frame, only the particles which moved are written
+/// const std::array<sf::VertexBuffer::UpdateRange, 2> ranges = {{{moved.data(), 100, 0},
+///                                                                {spawned.data(), 20, 980}}};
+/// particles.update(ranges.data(), ranges.size());
+/// window.draw(particles);
+/// \endcode
+///
 /// It inherits `sf::Drawable`, but unlike other drawables it
 /// is not transformable.
 ///
@@ -0,0 +1,279 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Loads resources on a pool of worker threads
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API AssetLoader
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the loader and start its worker threads
+    ///
+    /// \param threadCount Number of worker threads, 0 to use one per hardware thread
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit AssetLoader(unsigned int threadCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Waits for the tasks which are running. The tasks which
+    /// haven't started and the finalizers which haven't been
+    /// run are abandoned, their futures report a broken promise.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~AssetLoader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    AssetLoader(const AssetLoader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a resource on a worker thread
+    ///
+    /// The function is called on one of the worker threads. Its
+    /// result, or the exception that it throws, is given to the
+    /// returned future.
+    ///
+    /// \param function Function which loads and returns the resource
+    ///
+    /// \return Future receiving the resource
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Function>
+    [[nodiscard]] std::future<std::invoke_result_t<Function&>> load(Function function);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a resource on a worker thread and finish it on the updating thread
+    ///
+    /// The function is called on one of the worker threads, then
+    /// its result is passed to the finalizer during a later call
+    /// to `update` or `wait`, on the thread calling them. This is
+    /// meant for the steps which require an active OpenGL context,
+    /// like creating a texture from a decoded image.
+    ///
+    /// The future receives the result of the finalizer, or the
+    /// exception thrown by either function. When the function
+    /// throws, the finalizer isn't called.
+    ///
+    /// \param function  Function which loads and returns the data
+    /// \param finalizer Function which creates the resource from the data
+    ///
+    /// \return Future receiving the resource
+    ///
+    /// \see `update`
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Function, typename Finalizer>
+    [[nodiscard]] std::future<std::invoke_result_t<Finalizer&, std::invoke_result_t<Function&>&&>> load(
+        Function  function,
+        Finalizer finalizer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run the finalizers of the resources decoded so far
+    ///
+    /// This function must be called regularly, typically once
+    /// per frame on the thread which owns the OpenGL context.
+    /// With a time limit, it returns once the limit is exceeded
+    /// so that the loading screen stays responsive; at least
+    /// one finalizer is run per call if any is ready.
+    ///
+    /// \param timeLimit Maximum time to spend, `Time::Zero` to run all the ready finalizers
+    ///
+    /// \return Number of finalizers which were run
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t update(Time timeLimit = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until all the resources are loaded
+    ///
+    /// The finalizers are run on the calling thread while
+    /// waiting, like `update` would.
+    ///
+    ////////////////////////////////////////////////////////////
+    void wait();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of resources requested so far
+    ///
+    /// \return Number of calls to `load`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getTaskCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of resources which are ready
+    ///
+    /// A resource is ready once its future holds a value or an
+    /// exception, failed loads are counted too.
+    ///
+    /// \return Number of resources ready
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCompletedCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the progress of the loading
+    ///
+    /// \return Ratio of resources ready, in range [0, 1], 1 if nothing was requested
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getProgress() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of worker threads
+    ///
+    /// \return Number of worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getThreadCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a task for the worker threads
+    ///
+    /// \param task Task to run
+    ///
+    ////////////////////////////////////////////////////////////
+    void enqueue(std::function<void()> task);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a finalizer for the updating thread
+    ///
+    /// \param finalizer Finalizer to run
+    ///
+    ////////////////////////////////////////////////////////////
+    void enqueueFinalizer(std::function<void()> finalizer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Count a resource as ready
+    ///
+    ////////////////////////////////////////////////////////////
+    void complete();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function run by the worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    void run();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    mutable std::mutex                m_mutex;            //!< Mutex protecting the queues and counters
+    std::condition_variable           m_taskCondition;    //!< Signaled when a task is queued or the loader stops
+    std::condition_variable           m_updateCondition;  //!< Signaled when a finalizer is queued or a task ends
+    std::deque<std::function<void()>> m_tasks;            //!< Tasks waiting for a worker thread
+    std::deque<std::function<void()>> m_finalizers;       //!< Finalizers waiting for the updating thread
+    std::size_t                       m_taskCount{};      //!< Number of resources requested
+    std::size_t                       m_completedCount{}; //!< Number of resources ready
+    bool                              m_stopping{};       //!< Are the worker threads asked to stop?
+    std::vector<std::thread>          m_threads;          //!< Worker threads
+};
+
+} // namespace sf
+
+#include <SFML/System/AssetLoader.inl>
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::AssetLoader
+/// \ingroup system
+///
+/// `sf::AssetLoader` decodes resources on a pool of worker
+/// threads, so that a loading screen uses all the cores of the
+/// machine instead of loading files one after another on the
+/// main thread.
+///
+/// Each call to `load` returns a `std::future` which receives
+/// the resource, or the exception thrown while loading it. The
+/// constructors of `sf::Image`, `sf::Font` and `sf::SoundBuffer`
+/// which take a path throw on failure and only touch the object
+/// being created, so they can run on the worker threads.
+///
+/// OpenGL resources must be created on a thread with an active
+/// context. The second overload of `load` splits the work in two:
+/// the decoding runs on a worker thread, then the finalizer runs
+/// on the thread calling `update`, typically the main thread,
+/// which uploads the decoded data. `getProgress` tells how much
+/// of the requested work is done.
+///
+/// Usage example:
+/// \code
+/// sf::AssetLoader loader;
+///
+/// std::future<sf::Texture> texture = loader.load([] { return sf::Image("background.png"); },
+///                                                [](sf::Image&& image) { return sf::Texture(image); });
+/// std::future<sf::Font> font = loader.load([] { return sf::Font("arial.ttf"); });
+/// std::future<sf::SoundBuffer> buffer = loader.load([] { return sf::SoundBuffer("music.ogg"); });
+///
+/// while (loader.getProgress() < 1.f)
+/// {
+///     // Upload the textures for at most 5 milliseconds per frame
+///     loader.update(sf::milliseconds(5));
+///
+///     // Draw the progress bar
+///     ...
+/// }
+///
+/// const sf::Texture backgroundTexture = texture.get();
+/// \endcode
+///
+/// \see `sf::Image`, `sf::Font`, `sf::SoundBuffer`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/AssetLoader.hpp> // NOLINT(misc-header-include-cycle)
+
+#include <exception>
+#include <memory>
+#include <optional>
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+template <typename Function>
+std::future<std::invoke_result_t<Function&>> AssetLoader::load(Function function)
+{
+    // std::function requires copyable targets, the task is shared instead of copied
+    auto task   = std::make_shared<std::packaged_task<std::invoke_result_t<Function&>()>>(std::move(function));
+    auto future = task->get_future();
+
+    enqueue(
+        [this, task]
+        {
+            (*task)();
+            complete();
+        });
+
+    return future;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Function, typename Finalizer>
+std::future<std::invoke_result_t<Finalizer&, std::invoke_result_t<Function&>&&>> AssetLoader::load(Function function,
+                                                                                                  Finalizer finalizer)
+{
+    using Data   = std::invoke_result_t<Function&>;
+    using Result = std::invoke_result_t<Finalizer&, Data&&>;
+    static_assert(!std::is_void_v<Data>, "The loading function must return the data passed to the finalizer");
+
+    struct LoadState
+    {
+        Function             function;
+        Finalizer            finalizer;
+        std::promise<Result> promise;
+        std::optional<Data>  data;
+    };
+
+    auto state  = std::make_shared<LoadState>(LoadState{std::move(function), std::move(finalizer), {}, {}});
+    auto future = state->promise.get_future();
+
+    enqueue(
+        [this, state]
+        {
+            try
+            {
+                state->data.emplace(state->function());
+            }
+            catch (...)
+            {
+                state->promise.set_exception(std::current_exception());
+                complete();
+                return;
+            }
+
+            enqueueFinalizer(
+                [this, state]
+                {
+                    try
+                    {
+                        if constexpr (std::is_void_v<Result>)
+                        {
+                            state->finalizer(std::move(*state->data));
+                            state->promise.set_value();
+                        }
+                        else
+                        {
+                            state->promise.set_value(state->finalizer(std::move(*state->data)));
+                        }
+                    }
+                    catch (...)
+                    {
+                        state->promise.set_exception(std::current_exception());
+                    }
+
+                    state->data.reset();
+                    complete();
+                });
+        });
+
+    return future;
+}
+
+} // namespace sf
@@ -94,12 +94,15 @@ struct ContextSettings
 /// context should follow the core or compatibility profile
 /// of all newer (>= 3.2) OpenGL specifications. For versions
 /// 3.0 and 3.1 there is only the core profile. By default
-/// a compatibility context is created. You only need to specify
-/// the core flag if you want a core profile context to use with
-/// your own OpenGL rendering.
-/// <b>Warning: The graphics module will not function if you
-/// request a core profile context. Make sure the attributes are
-/// set to Default if you want to use the graphics module.</b>
+/// a compatibility context is created. When the core flag is
+/// set, the render targets of the graphics module render through
+/// a shader pipeline (vertex array object, streaming vertex buffer
+/// and built-in shader) instead of the fixed-function pipeline.
+/// Custom shaders used with such targets must then read their
+/// inputs from the `sf_position`, `sf_color` and `sf_texCoords`
+/// attributes and the `sf_modelViewProjection` and
+/// `sf_textureMatrix` uniforms instead of the deprecated
+/// built-in GLSL variables.
 ///
 /// Setting the debug attribute flag will request a context with
 /// additional debugging features enabled. Depending on the
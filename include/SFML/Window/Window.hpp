@@ -338,6 +338,17 @@ public:
     ////////////////////////////////////////////////////////////
     void display();
 
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called before the window is displayed
+    ///
+    /// This function is called by `display()` so that derived
+    /// classes can finish rendering the current frame before
+    /// it is shown on screen.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onDisplay();
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Perform some common internal initializations
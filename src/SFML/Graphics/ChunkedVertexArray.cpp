@@ -0,0 +1,242 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ChunkedVertexArray.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ChunkedVertexArrayImpl
+{
+////////////////////////////////////////////////////////////
+sf::FloatRect merge(const sf::FloatRect& a, const sf::FloatRect& b)
+{
+    const sf::Vector2f min(std::min(a.position.x, b.position.x), std::min(a.position.y, b.position.y));
+    const sf::Vector2f max(std::max(a.position.x + a.size.x, b.position.x + b.size.x),
+                           std::max(a.position.y + a.size.y, b.position.y + b.size.y));
+    return {min, max - min};
+}
+
+
+////////////////////////////////////////////////////////////
+sf::PrimitiveType getListType(sf::PrimitiveType type)
+{
+    switch (type)
+    {
+        case sf::PrimitiveType::LineStrip:
+            return sf::PrimitiveType::Lines;
+        case sf::PrimitiveType::TriangleStrip:
+        case sf::PrimitiveType::TriangleFan:
+            return sf::PrimitiveType::Triangles;
+        default:
+            return type;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t getPrimitiveSize(sf::PrimitiveType listType)
+{
+    switch (listType)
+    {
+        case sf::PrimitiveType::Lines:
+            return 2;
+        case sf::PrimitiveType::Triangles:
+            return 3;
+        default:
+            return 1;
+    }
+}
+} // namespace ChunkedVertexArrayImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+ChunkedVertexArray::ChunkedVertexArray(PrimitiveType type, Vector2f chunkSize) :
+m_primitiveType(type),
+m_chunkSize(chunkSize)
+{
+    assert(chunkSize.x > 0.f && chunkSize.y > 0.f && "Chunk size must be positive");
+}
+
+
+////////////////////////////////////////////////////////////
+void ChunkedVertexArray::append(const Vertex* vertices, std::size_t vertexCount)
+{
+    if (!vertices)
+        return;
+
+    std::array<const Vertex*, 3> primitive{};
+
+    switch (m_primitiveType)
+    {
+        case PrimitiveType::LineStrip:
+            for (std::size_t i = 1; i < vertexCount; ++i)
+            {
+                primitive[0] = &vertices[i - 1];
+                primitive[1] = &vertices[i];
+                addPrimitive(primitive.data(), 2);
+            }
+            break;
+
+        case PrimitiveType::TriangleStrip:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                primitive[0] = &vertices[i - 2];
+                primitive[1] = &vertices[i - 1];
+                primitive[2] = &vertices[i];
+                addPrimitive(primitive.data(), 3);
+            }
+            break;
+
+        case PrimitiveType::TriangleFan:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                primitive[0] = &vertices[0];
+                primitive[1] = &vertices[i - 1];
+                primitive[2] = &vertices[i];
+                addPrimitive(primitive.data(), 3);
+            }
+            break;
+
+        default:
+        {
+            const std::size_t size = ChunkedVertexArrayImpl::getPrimitiveSize(m_primitiveType);
+            for (std::size_t i = 0; i + size <= vertexCount; i += size)
+            {
+                for (std::size_t j = 0; j < size; ++j)
+                    primitive[j] = &vertices[i + j];
+                addPrimitive(primitive.data(), size);
+            }
+            break;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ChunkedVertexArray::clear()
+{
+    m_chunks.clear();
+    m_vertexCount = 0;
+    m_bounds      = {};
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ChunkedVertexArray::getVertexCount() const
+{
+    return m_vertexCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ChunkedVertexArray::getChunkCount() const
+{
+    return m_chunks.size();
+}
+
+
+////////////////////////////////////////////////////////////
+PrimitiveType ChunkedVertexArray::getPrimitiveType() const
+{
+    return m_primitiveType;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f ChunkedVertexArray::getChunkSize() const
+{
+    return m_chunkSize;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect ChunkedVertexArray::getBounds() const
+{
+    return m_bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+void ChunkedVertexArray::draw(RenderTarget& target, RenderStates states) const
+{
+    const PrimitiveType listType = ChunkedVertexArrayImpl::getListType(m_primitiveType);
+
+    for (const auto& [key, chunk] : m_chunks)
+    {
+        // Skip the chunks outside the view without reading their vertices
+        if (target.cull(chunk.bounds, states))
+            continue;
+
+        target.draw(chunk.vertices.data(), chunk.vertices.size(), listType, states);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ChunkedVertexArray::addPrimitive(const Vertex* const* vertices, std::size_t vertexCount)
+{
+    Vector2f center;
+    Vector2f min    = vertices[0]->position;
+    Vector2f max    = vertices[0]->position;
+    for (std::size_t i = 0; i < vertexCount; ++i)
+    {
+        const Vector2f position = vertices[i]->position;
+        center += position;
+        min.x = std::min(min.x, position.x);
+        min.y = std::min(min.y, position.y);
+        max.x = std::max(max.x, position.x);
+        max.y = std::max(max.y, position.y);
+    }
+    center /= static_cast<float>(vertexCount);
+
+    const std::pair key(static_cast<int>(std::floor(center.y / m_chunkSize.y)),
+                        static_cast<int>(std::floor(center.x / m_chunkSize.x)));
+    const FloatRect bounds(min, max - min);
+
+    const auto [iterator, inserted] = m_chunks.try_emplace(key);
+    Chunk& chunk                    = iterator->second;
+    chunk.bounds                    = inserted ? bounds : ChunkedVertexArrayImpl::merge(chunk.bounds, bounds);
+    for (std::size_t i = 0; i < vertexCount; ++i)
+        chunk.vertices.push_back(*vertices[i]);
+
+    m_bounds = (m_vertexCount == 0) ? bounds : ChunkedVertexArrayImpl::merge(m_bounds, bounds);
+    m_vertexCount += vertexCount;
+}
+
+} // namespace sf
@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CommandList.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/VertexBatching.hpp>
+
+#include <algorithm>
+#include <functional>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void CommandList::setView(const View& view)
+{
+    m_views.push_back(view);
+    m_currentView = m_views.size() - 1;
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::setLayer(int layer)
+{
+    m_currentLayer = layer;
+}
+
+
+////////////////////////////////////////////////////////////
+int CommandList::getLayer() const
+{
+    return m_currentLayer;
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::draw(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0))
+        return;
+
+    Command command;
+    command.states      = states;
+    command.firstVertex = m_vertices.size();
+    command.view        = m_currentView;
+    command.layer       = m_currentLayer;
+
+    if (states.shader)
+    {
+        // The shader may depend on the transform and the primitive type, keep them as they are
+        command.type = type;
+        m_vertices.insert(m_vertices.end(), vertices, vertices + vertexCount);
+    }
+    else
+    {
+        // Pre-transformed lists can be merged with the neighboring draws
+        command.type             = priv::getListPrimitiveType(type);
+        command.states.transform = Transform::Identity;
+        priv::appendListVertices(m_vertices, vertices, vertexCount, type, states.transform);
+    }
+
+    command.vertexCount = m_vertices.size() - command.firstVertex;
+    if (command.vertexCount > 0)
+        addCommand(command);
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::draw(const VertexArray& vertexArray, const RenderStates& states)
+{
+    if (vertexArray.getVertexCount() > 0)
+        draw(&vertexArray[0], vertexArray.getVertexCount(), vertexArray.getPrimitiveType(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::append(const CommandList& commandList)
+{
+    // Appending a list to itself would read the containers while they grow
+    if (&commandList == this)
+    {
+        const CommandList copy(commandList);
+        append(copy);
+        return;
+    }
+
+    const std::size_t vertexOffset = m_vertices.size();
+    const std::size_t viewOffset   = m_views.size();
+
+    m_vertices.insert(m_vertices.end(), commandList.m_vertices.begin(), commandList.m_vertices.end());
+    m_views.insert(m_views.end(), commandList.m_views.begin(), commandList.m_views.end());
+
+    for (Command command : commandList.m_commands)
+    {
+        command.firstVertex += vertexOffset;
+        if (command.view != noView)
+            command.view += viewOffset;
+
+        addCommand(command);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::sort()
+{
+    std::vector<Command> commands;
+    commands.swap(m_commands);
+
+    const auto less = [](const Command& a, const Command& b)
+    {
+        if (a.layer != b.layer)
+            return a.layer < b.layer;
+
+        if (a.states.shader != b.states.shader)
+            return std::less<>()(a.states.shader, b.states.shader);
+
+        if (a.states.texture != b.states.texture)
+            return std::less<>()(a.states.texture, b.states.texture);
+
+        return a.type < b.type;
+    };
+
+    // Draws are only reordered between two view changes
+    for (auto begin = commands.begin(); begin != commands.end();)
+    {
+        const auto end = std::find_if(begin,
+                                      commands.end(),
+                                      [view = begin->view](const Command& command) { return command.view != view; });
+        std::stable_sort(begin, end, less);
+        begin = end;
+    }
+
+    // Rebuild the vertices in the new order so that the commands can be merged again
+    std::vector<Vertex> vertices;
+    vertices.reserve(m_vertices.size());
+
+    for (Command command : commands)
+    {
+        const auto first = m_vertices.begin() + static_cast<std::ptrdiff_t>(command.firstVertex);
+        command.firstVertex = vertices.size();
+        vertices.insert(vertices.end(), first, first + static_cast<std::ptrdiff_t>(command.vertexCount));
+        addCommand(command);
+    }
+
+    m_vertices.swap(vertices);
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::clear()
+{
+    m_commands.clear();
+    m_vertices.clear();
+    m_views.clear();
+    m_currentView  = noView;
+    m_currentLayer = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CommandList::getCommandCount() const
+{
+    return m_commands.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t CommandList::getVertexCount() const
+{
+    return m_vertices.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::submit(RenderTarget& target) const
+{
+    const View  initialView = target.getView();
+    std::size_t currentView = noView;
+
+    for (const Command& command : m_commands)
+    {
+        // The render target already skips the states which don't change, only the view needs to be tracked here
+        if (command.view != currentView)
+        {
+            target.setView(command.view == noView ? initialView : m_views[command.view]);
+            currentView = command.view;
+        }
+
+        target.draw(m_vertices.data() + command.firstVertex, command.vertexCount, command.type, command.states);
+    }
+
+    if (currentView != noView)
+        target.setView(initialView);
+}
+
+
+////////////////////////////////////////////////////////////
+void CommandList::addCommand(const Command& command)
+{
+    if (!m_commands.empty())
+    {
+        Command& last = m_commands.back();
+
+        // Shaded draws keep their own transform and uniforms, they are never merged
+        const bool mergeable = !last.states.shader && !command.states.shader && (last.view == command.view) &&
+                               (last.layer == command.layer) && (last.type == command.type) &&
+                               (last.states.texture == command.states.texture) &&
+                               (last.states.coordinateType == command.states.coordinateType) &&
+                               (last.states.blendMode == command.states.blendMode) &&
+                               (last.states.stencilMode == command.states.stencilMode) &&
+                               (last.firstVertex + last.vertexCount == command.firstVertex);
+
+        if (mergeable)
+        {
+            last.vertexCount += command.vertexCount;
+            return;
+        }
+    }
+
+    m_commands.push_back(command);
+}
+
+} // namespace sf
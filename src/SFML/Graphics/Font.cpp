@@ -34,6 +34,7 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/MemoryInputStream.hpp>
 #include <SFML/System/Utils.hpp>
 
@@ -43,17 +44,38 @@
 #include FT_OUTLINE_H
 #include FT_BITMAP_H
 #include FT_STROKER_H
+#include FT_MODULE_H
 
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <ostream>
+#include <set>
+#include <thread>
 #include <utility>
+#include <vector>
 
+#include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstring>
 
+// Signed distance field rendering appeared in FreeType 2.11
+#if (FREETYPE_MAJOR > 2) || ((FREETYPE_MAJOR == 2) && (FREETYPE_MINOR >= 11))
+#define SFML_FREETYPE_HAS_SDF
+#endif
+
 
 namespace
 {
+// Character size at which distance field glyphs are rasterized
+constexpr unsigned int distanceFieldSize = 64;
+
+// Maximum distance to the outline stored in distance field glyphs, in pixels at the reference size
+constexpr int distanceFieldSpread = 8;
+
 // FreeType callbacks that operate on a sf::InputStream
 unsigned long read(FT_Stream rec, unsigned long offset, unsigned char* buffer, unsigned long count)
 {
@@ -87,6 +109,168 @@ std::uint64_t combine(float outlineThickness, bool bold, std::uint32_t index)
     return (std::uint64_t{reinterpret<std::uint32_t>(outlineThickness)} << 32) | (std::uint64_t{bold} << 31) | index;
 }
 
+// Glyph returned while the actual glyph is being loaded asynchronously
+constexpr sf::Glyph pendingGlyph{};
+
+// Padding left around characters, so that filtering doesn't pollute them with pixels from neighbors
+constexpr int glyphPadding = 2;
+
+// Configure a FreeType library instance for our needs
+void configureLibrary([[maybe_unused]] FT_Library library)
+{
+#ifdef SFML_FREETYPE_HAS_SDF
+    // Make sure distance field glyphs cover the range expected by Font::getDistanceFieldOffset
+    const FT_Int spread = distanceFieldSpread;
+    FT_Property_Set(library, "sdf", "spread", &spread);
+#endif
+}
+
+// Rasterize a glyph of the current size of the face into RGBA pixels surrounded by a
+// transparent padding, and fill its metrics; return the size of the pixels (zero if empty)
+sf::Vector2u rasterizeGlyph(FT_Library                 library,
+                            FT_Face                    face,
+                            FT_Stroker                 stroker,
+                            std::uint32_t              id,
+                            bool                       bold,
+                            float                      outlineThickness,
+                            [[maybe_unused]] bool      distanceField,
+                            sf::Glyph&                 glyph,
+                            std::vector<std::uint8_t>& pixelBuffer)
+{
+    // Load the glyph corresponding to the code point
+    FT_Int32 flags = FT_LOAD_TARGET_NORMAL;
+    if (outlineThickness != 0)
+        flags |= FT_LOAD_NO_BITMAP;
+    if (FT_Load_Glyph(face, id, flags) != 0)
+        return {};
+
+    // Retrieve the glyph
+    FT_Glyph glyphDesc = nullptr;
+    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+        return {};
+
+    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
+    const FT_Pos weight  = 1 << 6;
+    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
+    if (outline)
+    {
+        if (bold)
+        {
+            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
+            FT_Outline_Embolden(&outlineGlyph->outline, weight);
+        }
+
+        if (outlineThickness != 0)
+        {
+            FT_Stroker_Set(stroker,
+                           static_cast<FT_Fixed>(outlineThickness * float{1 << 6}),
+                           FT_STROKER_LINECAP_ROUND,
+                           FT_STROKER_LINEJOIN_ROUND,
+                           0);
+            FT_Glyph_Stroke(&glyphDesc, stroker, true);
+        }
+    }
+
+    // Convert the glyph to a bitmap (i.e. rasterize it)
+    // Warning! After this line, do not read any data from glyphDesc directly, use
+    // bitmapGlyph.root to access the FT_Glyph data.
+#ifdef SFML_FREETYPE_HAS_SDF
+    const FT_Render_Mode renderMode = (outline && distanceField) ? FT_RENDER_MODE_SDF : FT_RENDER_MODE_NORMAL;
+#else
+    const FT_Render_Mode renderMode = FT_RENDER_MODE_NORMAL;
+#endif
+    if ((FT_Glyph_To_Bitmap(&glyphDesc, renderMode, nullptr, 1) != 0) && (renderMode != FT_RENDER_MODE_NORMAL))
+        FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
+    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
+    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+
+    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
+    if (!outline)
+    {
+        if (bold)
+            FT_Bitmap_Embolden(library, &bitmap, weight, weight);
+
+        if (outlineThickness != 0)
+            sf::err() << "Failed to outline glyph (no fallback available)" << std::endl;
+    }
+
+    // Compute the glyph's advance offset
+    glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
+    if (bold)
+        glyph.advance += static_cast<float>(weight) / float{1 << 6};
+
+    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
+    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
+
+    sf::Vector2u size(bitmap.width, bitmap.rows);
+
+    if ((size.x > 0) && (size.y > 0))
+    {
+        const unsigned int padding = glyphPadding;
+
+        size += 2u * sf::Vector2u(padding, padding);
+
+        // Compute the glyph's bounding box
+        glyph.bounds.position = sf::Vector2f(sf::Vector2i(bitmapGlyph->left, -bitmapGlyph->top));
+        glyph.bounds.size     = sf::Vector2f(sf::Vector2u(bitmap.width, bitmap.rows));
+
+        // Resize the pixel buffer to the new size and fill it with transparent white pixels
+        pixelBuffer.resize(std::size_t{size.x} * std::size_t{size.y} * 4);
+
+        std::uint8_t* current = pixelBuffer.data();
+        std::uint8_t* end     = current + size.x * size.y * 4;
+
+        while (current != end)
+        {
+            (*current++) = 255;
+            (*current++) = 255;
+            (*current++) = 255;
+            (*current++) = 0;
+        }
+
+        // Extract the glyph's pixels from the bitmap
+        const std::uint8_t* pixels = bitmap.buffer;
+        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        {
+            // Pixels are 1 bit monochrome values
+            for (unsigned int y = padding; y < size.y - padding; ++y)
+            {
+                for (unsigned int x = padding; x < size.x - padding; ++x)
+                {
+                    // The color channels remain white, just fill the alpha channel
+                    const std::size_t index    = x + y * size.x;
+                    const bool        isSet    = (pixels[(x - padding) / 8] & (1 << (7 - ((x - padding) % 8)))) != 0;
+                    pixelBuffer[index * 4 + 3] = isSet ? 255 : 0;
+                }
+                pixels += bitmap.pitch;
+            }
+        }
+        else
+        {
+            // Pixels are 8 bit gray levels
+            for (unsigned int y = padding; y < size.y - padding; ++y)
+            {
+                for (unsigned int x = padding; x < size.x - padding; ++x)
+                {
+                    // The color channels remain white, just fill the alpha channel
+                    const std::size_t index     = x + y * size.x;
+                    pixelBuffer[index * 4 + 3] = pixels[x - padding];
+                }
+                pixels += bitmap.pitch;
+            }
+        }
+    }
+    else
+    {
+        size = {};
+    }
+
+    // Delete the FT glyph
+    FT_Done_Glyph(glyphDesc);
+
+    return size;
+}
+
 // Thread-safe unique identifier generator
 std::uint64_t getUniqueId() noexcept
 {
@@ -131,6 +315,207 @@ struct Font::FontHandles
 };
 
 
+////////////////////////////////////////////////////////////
+struct Font::AsyncLoader
+{
+    struct Request
+    {
+        unsigned int  characterSize{};    //< Character size of the page of the glyph
+        std::uint64_t key{};              //< Key of the glyph in its page
+        std::uint32_t id{};               //< Glyph ID
+        bool          bold{};             //< Load the bold version of the glyph?
+        float         outlineThickness{}; //< Thickness of the outline of the glyph
+    };
+
+    struct Result
+    {
+        unsigned int              characterSize{}; //< Character size of the page of the glyph
+        std::uint64_t             key{};           //< Key of the glyph in its page
+        Glyph                     glyph;           //< Metrics of the glyph
+        Vector2u                  size;            //< Size of the pixels, padding included
+        std::vector<std::uint8_t> pixels;          //< RGBA pixels of the glyph
+    };
+
+    AsyncLoader(std::vector<std::byte>&& data, bool theDistanceField) :
+        fontData(std::move(data)),
+        distanceField(theDistanceField),
+        thread(&AsyncLoader::run, this)
+    {
+    }
+
+    ~AsyncLoader()
+    {
+        {
+            const std::lock_guard lock(mutex);
+            stop = true;
+        }
+
+        condition.notify_one();
+        thread.join();
+    }
+
+    // clang-format off
+    AsyncLoader(const AsyncLoader&)            = delete;
+    AsyncLoader& operator=(const AsyncLoader&) = delete;
+
+    AsyncLoader(AsyncLoader&&)            = delete;
+    AsyncLoader& operator=(AsyncLoader&&) = delete;
+    // clang-format on
+
+    void push(const Request& request)
+    {
+        {
+            const std::lock_guard lock(mutex);
+            requests.push_back(request);
+        }
+
+        condition.notify_one();
+    }
+
+    std::vector<Result> takeResults()
+    {
+        std::vector<Result> taken;
+
+        // Avoid locking the mutex when there is nothing to take
+        if (!hasResults.load(std::memory_order_acquire))
+            return taken;
+
+        const std::lock_guard lock(mutex);
+        taken.swap(results);
+        hasResults.store(false, std::memory_order_relaxed);
+        return taken;
+    }
+
+    void run()
+    {
+        // FreeType faces cannot be used by several threads at the same
+        // time, so the worker thread opens its own from the font data
+        FT_Library library{};
+        FT_Face    face{};
+        FT_Stroker stroker{};
+
+        if (FT_Init_FreeType(&library) == 0)
+        {
+            configureLibrary(library);
+
+            if (FT_New_Memory_Face(library,
+                                   reinterpret_cast<const FT_Byte*>(fontData.data()),
+                                   static_cast<FT_Long>(fontData.size()),
+                                   0,
+                                   &face) != 0)
+                face = nullptr;
+
+            if (FT_Stroker_New(library, &stroker) != 0)
+                stroker = nullptr;
+        }
+
+        if (!face || !stroker)
+            err() << "Failed to open the font for asynchronous glyph loading" << std::endl;
+
+        for (;;)
+        {
+            Request request;
+
+            {
+                std::unique_lock lock(mutex);
+                condition.wait(lock, [this] { return stop || !requests.empty(); });
+
+                if (stop)
+                    break;
+
+                request = requests.front();
+                requests.pop_front();
+            }
+
+            // Glyphs which cannot be loaded are reported as empty glyphs
+            Result result{request.characterSize, request.key, {}, {}, {}};
+
+            if (face && stroker &&
+                ((face->size->metrics.x_ppem == request.characterSize) ||
+                 (FT_Set_Pixel_Sizes(face, 0, request.characterSize) == FT_Err_Ok)))
+            {
+                result.size = rasterizeGlyph(library,
+                                             face,
+                                             stroker,
+                                             request.id,
+                                             request.bold,
+                                             request.outlineThickness,
+                                             distanceField,
+                                             result.glyph,
+                                             result.pixels);
+            }
+
+            {
+                const std::lock_guard lock(mutex);
+                results.push_back(std::move(result));
+                hasResults.store(true, std::memory_order_release);
+            }
+        }
+
+        FT_Stroker_Done(stroker);
+        FT_Done_Face(face);
+        FT_Done_FreeType(library);
+    }
+
+    const std::vector<std::byte> fontData;      //< Copy of the font data, used by the worker thread
+    const bool                   distanceField; //< Render glyphs as signed distance fields?
+    std::mutex                   mutex;         //< Mutex protecting the requests and results
+    std::condition_variable      condition;     //< Condition signaling new requests to the worker thread
+    std::deque<Request>          requests;      //< Glyphs waiting to be loaded
+    std::vector<Result>          results;       //< Glyphs loaded but not added to the font yet
+    bool                         stop{};        //< Should the worker thread stop?
+    std::atomic<bool>            hasResults{};  //< Are there results waiting to be taken?
+    std::set<std::pair<unsigned int, std::uint64_t>> requested; //< Glyphs requested and not added yet (main thread only)
+    std::thread thread; //< Worker thread, must be initialized last
+};
+
+
+////////////////////////////////////////////////////////////
+Font::Font() = default;
+
+
+////////////////////////////////////////////////////////////
+Font::~Font() = default;
+
+
+////////////////////////////////////////////////////////////
+Font::Font(const Font& copy) :
+    m_fontHandles(copy.m_fontHandles),
+    m_isSmooth(copy.m_isSmooth),
+    m_isDistanceField(copy.m_isDistanceField),
+    m_isAsync(copy.m_isAsync),
+    m_info(copy.m_info),
+    m_pages(copy.m_pages),
+    m_scaledGlyphs(copy.m_scaledGlyphs),
+    m_stream(copy.m_stream),
+    m_glyphGeneration(copy.m_glyphGeneration)
+{
+    // Glyphs pending in the copied font will be requested again by this one
+    restartAsyncLoader();
+}
+
+
+////////////////////////////////////////////////////////////
+Font& Font::operator=(const Font& right)
+{
+    if (this != &right)
+    {
+        Font copy(right);
+        *this = std::move(copy);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Font::Font(Font&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+Font& Font::operator=(Font&&) noexcept = default;
+
+
 ////////////////////////////////////////////////////////////
 Font::Font(const std::filesystem::path& filename)
 {
@@ -163,6 +548,22 @@ bool Font::openFromFile(const std::filesystem::path& filename)
     // Cleanup the previous resources
     cleanup();
 
+#ifndef SFML_SYSTEM_ANDROID
+    // Map the file in memory when possible, so that FreeType reads it in place
+    if (const auto mappedFile = std::make_shared<MappedFileInputStream>();
+        mappedFile->open(filename) && mappedFile->getData())
+    {
+        if (openFromStreamImpl(*mappedFile, "file", mappedFile->getData()))
+        {
+            m_stream = mappedFile;
+            return true;
+        }
+
+        err() << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+#endif
+
     // Create the input stream and open the file
 #ifndef SFML_SYSTEM_ANDROID
     const auto stream = std::make_shared<FileInputStream>();
@@ -208,7 +609,7 @@ bool Font::openFromMemory(const void* data, std::size_t sizeInBytes)
     const auto memoryStream = std::make_shared<MemoryInputStream>(data, sizeInBytes);
 
     // Open the font, and if succesful save the stream to keep it alive
-    if (openFromStreamImpl(*memoryStream, "memory"))
+    if (openFromStreamImpl(*memoryStream, "memory", data))
     {
         m_stream = memoryStream;
         return true;
@@ -242,6 +643,44 @@ const Font::Info& Font::getInfo() const
 
 ////////////////////////////////////////////////////////////
 const Glyph& Font::getGlyphById(std::uint32_t id, unsigned int characterSize, bool bold, float outlineThickness) const
+{
+    // Add the glyphs which finished loading in the background
+    commitLoadedGlyphs();
+
+    if (!isDistanceFieldActive())
+        return getPageGlyph(id, characterSize, bold, outlineThickness);
+
+    // Distance field glyphs are rasterized once at the reference size and only have their
+    // metrics scaled to other sizes; outlines are rendered from the distance field itself
+    GlyphTable&         glyphs = m_scaledGlyphs[characterSize];
+    const std::uint64_t key    = combine(0.f, bold, id);
+
+    if (const auto it = glyphs.find(key); it != glyphs.end())
+        return it->second;
+
+    const Glyph& referenceGlyph = getPageGlyph(id, distanceFieldSize, bold, 0.f);
+    if (isGlyphPending(referenceGlyph))
+        return referenceGlyph;
+
+    Glyph glyph = referenceGlyph;
+
+    // Loading the glyph may have changed the current size, which is relied on while shaping text
+    if (characterSize != distanceFieldSize)
+        (void)setCurrentSize(characterSize);
+
+    const float scale = static_cast<float>(characterSize) / static_cast<float>(distanceFieldSize);
+    glyph.advance *= scale;
+    glyph.lsbDelta = static_cast<int>(std::lround(static_cast<float>(glyph.lsbDelta) * scale));
+    glyph.rsbDelta = static_cast<int>(std::lround(static_cast<float>(glyph.rsbDelta) * scale));
+    glyph.bounds.position *= scale;
+    glyph.bounds.size *= scale;
+
+    return glyphs.try_emplace(key, glyph).first->second;
+}
+
+
+////////////////////////////////////////////////////////////
+const Glyph& Font::getPageGlyph(std::uint32_t id, unsigned int characterSize, bool bold, float outlineThickness) const
 {
     // Get the page corresponding to the character size
     GlyphTable& glyphs = loadPage(characterSize).glyphs;
@@ -256,7 +695,11 @@ const Glyph& Font::getGlyphById(std::uint32_t id, unsigned int characterSize, bo
         return it->second;
     }
 
-    // Not found: we have to load it
+    // Not found: let the worker thread load it if asynchronous loading is enabled
+    if (requestGlyph(id, characterSize, bold, outlineThickness, key))
+        return pendingGlyph;
+
+    // Otherwise we have to load it now
     const Glyph glyph = loadGlyph(id, characterSize, bold, outlineThickness);
     return glyphs.try_emplace(key, glyph).first->second;
 }
@@ -272,6 +715,44 @@ const Glyph& Font::getGlyph(char32_t codePoint, unsigned int characterSize, bool
 }
 
 
+////////////////////////////////////////////////////////////
+void Font::preloadGlyphs(const String& characters, unsigned int characterSize, bool bold, float outlineThickness) const
+{
+    for (const char32_t codePoint : characters)
+        (void)getGlyph(codePoint, characterSize, bold, outlineThickness);
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::setAsyncLoadingEnabled(bool enabled)
+{
+    if (enabled != m_isAsync)
+    {
+        // Keep the glyphs already loaded in the background
+        commitLoadedGlyphs();
+
+        m_isAsync = enabled;
+        restartAsyncLoader();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isAsyncLoadingEnabled() const
+{
+    return m_isAsync;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Font::getPendingGlyphCount() const
+{
+    commitLoadedGlyphs();
+
+    return m_asyncLoader ? m_asyncLoader->requested.size() : 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Font::hasGlyph(char32_t codePoint) const
 {
@@ -409,11 +890,65 @@ float Font::getUnderlineThickness(unsigned int characterSize) const
 
 
 ////////////////////////////////////////////////////////////
-const Texture& Font::getTexture(unsigned int characterSize) const
+const Texture& Font::getTexture(unsigned int characterSize, std::size_t index) const
 {
-    return loadPage(characterSize).texture;
+    const Page& page = loadPage(characterSize);
+    assert(index < page.textures.size() && "Index is out of bounds");
+    return page.textures[index].texture;
 }
 
+
+////////////////////////////////////////////////////////////
+std::size_t Font::getTextureCount(unsigned int characterSize) const
+{
+    return loadPage(characterSize).textures.size();
+}
+
+
+////////////////////////////////////////////////////////////
+Font::AtlasStatistics Font::getAtlasStatistics(unsigned int characterSize) const
+{
+    AtlasStatistics statistics;
+
+    const auto it = m_pages.find(characterSize);
+    if (it == m_pages.end())
+        return statistics;
+
+    for (const PageTexture& pageTexture : it->second.textures)
+    {
+        const Vector2u size = pageTexture.texture.getSize();
+
+        ++statistics.textureCount;
+        statistics.glyphCount += pageTexture.glyphCount;
+        statistics.textureArea += std::uint64_t{size.x} * std::uint64_t{size.y};
+        statistics.usedArea += pageTexture.usedArea;
+        statistics.wastedArea += pageTexture.wastedArea;
+    }
+
+    return statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+Font::AtlasStatistics Font::getAtlasStatistics() const
+{
+    AtlasStatistics statistics;
+
+    for (const auto& [characterSize, page] : m_pages)
+    {
+        const AtlasStatistics pageStatistics = getAtlasStatistics(characterSize);
+
+        statistics.textureCount += pageStatistics.textureCount;
+        statistics.glyphCount += pageStatistics.glyphCount;
+        statistics.textureArea += pageStatistics.textureArea;
+        statistics.usedArea += pageStatistics.usedArea;
+        statistics.wastedArea += pageStatistics.wastedArea;
+    }
+
+    return statistics;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Font::setSmooth(bool smooth)
 {
@@ -421,9 +956,13 @@ void Font::setSmooth(bool smooth)
     {
         m_isSmooth = smooth;
 
+        // Distance fields must always be filtered
+        const bool filter = m_isSmooth || isDistanceFieldActive();
+
         for (auto& [key, page] : m_pages)
         {
-            page.texture.setSmooth(m_isSmooth);
+            for (PageTexture& pageTexture : page.textures)
+                pageTexture.texture.setSmooth(filter);
         }
     }
 }
@@ -435,14 +974,45 @@ bool Font::isSmooth() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Font::setDistanceFieldEnabled(bool enabled)
+{
+#ifndef SFML_FREETYPE_HAS_SDF
+    if (enabled)
+        err() << "Signed distance field glyphs require FreeType 2.11 or later" << std::endl;
+#endif
+
+    if (enabled != m_isDistanceField)
+    {
+        m_isDistanceField = enabled;
+
+        // Glyphs loaded in the previous mode are useless now
+        m_pages.clear();
+        m_scaledGlyphs.clear();
+        restartAsyncLoader();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isDistanceFieldEnabled() const
+{
+    return m_isDistanceField;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Font::cleanup()
 {
+    // Stop loading glyphs of the previous font
+    m_asyncLoader.reset();
+
     // Drop ownership of shared FreeType pointers
     m_fontHandles.reset();
 
     // Reset members
     m_pages.clear();
+    m_scaledGlyphs.clear();
     std::vector<std::uint8_t>().swap(m_pixelBuffer);
 
     // Drop the file stream if we held one due to openFromFile or openFromMemory
@@ -451,7 +1021,7 @@ void Font::cleanup()
 
 
 ////////////////////////////////////////////////////////////
-bool Font::openFromStreamImpl(InputStream& stream, std::string_view type)
+bool Font::openFromStreamImpl(InputStream& stream, std::string_view type, const void* data)
 {
     // Cleanup the previous resources
     cleanup();
@@ -467,12 +1037,16 @@ bool Font::openFromStreamImpl(InputStream& stream, std::string_view type)
         return false;
     }
 
+    configureLibrary(fontHandles->library);
+
     // Prepare a wrapper for our stream, that we'll pass to FreeType callbacks
-    fontHandles->streamRec.base               = nullptr;
+    // (FreeType accesses streams without a read callback directly in memory)
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    fontHandles->streamRec.base               = static_cast<unsigned char*>(const_cast<void*>(data));
     fontHandles->streamRec.size               = static_cast<unsigned long>(stream.getSize().value());
     fontHandles->streamRec.pos                = 0;
     fontHandles->streamRec.descriptor.pointer = &stream;
-    fontHandles->streamRec.read               = &read;
+    fontHandles->streamRec.read               = data ? nullptr : &read;
     fontHandles->streamRec.close              = &close;
 
     // Setup the FreeType callbacks that will read our stream
@@ -513,6 +1087,8 @@ bool Font::openFromStreamImpl(InputStream& stream, std::string_view type)
     m_info.hasKerning         = FT_HAS_KERNING(face);
     m_info.hasVerticalMetrics = FT_HAS_VERTICAL(face);
 
+    restartAsyncLoader();
+
     return true;
 }
 
@@ -520,168 +1096,152 @@ bool Font::openFromStreamImpl(InputStream& stream, std::string_view type)
 ////////////////////////////////////////////////////////////
 Font::Page& Font::loadPage(unsigned int characterSize) const
 {
+    // All character sizes share the same page in distance field mode
+    if (isDistanceFieldActive())
+        return m_pages.try_emplace(distanceFieldSize, true).first->second;
+
     return m_pages.try_emplace(characterSize, m_isSmooth).first->second;
 }
 
 
 ////////////////////////////////////////////////////////////
-Glyph Font::loadGlyph(std::uint32_t id, unsigned int characterSize, bool bold, float outlineThickness) const
+bool Font::requestGlyph(std::uint32_t id,
+                        unsigned int  characterSize,
+                        bool          bold,
+                        float         outlineThickness,
+                        std::uint64_t key) const
 {
-    // The glyph to return
-    Glyph glyph;
+    if (!m_asyncLoader)
+        return false;
 
-    // Stop if no font is loaded
-    if (!m_fontHandles)
-        return glyph;
+    // Only request glyphs once, they are added to the page when loaded
+    if (m_asyncLoader->requested.emplace(characterSize, key).second)
+        m_asyncLoader->push({characterSize, key, id, bold, outlineThickness});
 
-    // Get our FT_Face
-    FT_Face face = m_fontHandles->face;
-    if (!face)
-        return glyph;
+    return true;
+}
 
-    // Set the character size
-    if (!setCurrentSize(characterSize))
-        return glyph;
 
-    // Load the glyph corresponding to the code point
-    FT_Int32 flags = FT_LOAD_TARGET_NORMAL;
-    if (outlineThickness != 0)
-        flags |= FT_LOAD_NO_BITMAP;
-    if (FT_Load_Glyph(face, id, flags) != 0)
-        return glyph;
+////////////////////////////////////////////////////////////
+void Font::commitLoadedGlyphs() const
+{
+    if (!m_asyncLoader)
+        return;
 
-    // Retrieve the glyph
-    FT_Glyph glyphDesc = nullptr;
-    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
-        return glyph;
+    std::vector<AsyncLoader::Result> results = m_asyncLoader->takeResults();
+    if (results.empty())
+        return;
 
-    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
-    const FT_Pos weight  = 1 << 6;
-    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
-    if (outline)
+    // Write all the loaded glyphs to the textures at once
+    for (AsyncLoader::Result& result : results)
     {
-        if (bold)
-        {
-            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
-            FT_Outline_Embolden(&outlineGlyph->outline, weight);
-        }
+        Page& page = loadPage(result.characterSize);
 
-        if (outlineThickness != 0)
-        {
-            FT_Stroker stroker = m_fontHandles->stroker;
+        if ((result.size.x > 0) && (result.size.y > 0))
+            writeGlyph(page, result.glyph, result.size, result.pixels.data());
 
-            FT_Stroker_Set(stroker,
-                           static_cast<FT_Fixed>(outlineThickness * float{1 << 6}),
-                           FT_STROKER_LINECAP_ROUND,
-                           FT_STROKER_LINEJOIN_ROUND,
-                           0);
-            FT_Glyph_Stroke(&glyphDesc, stroker, true);
-        }
+        page.glyphs.try_emplace(result.key, result.glyph);
+        m_asyncLoader->requested.erase({result.characterSize, result.key});
     }
 
-    // Convert the glyph to a bitmap (i.e. rasterize it)
-    // Warning! After this line, do not read any data from glyphDesc directly, use
-    // bitmapGlyph.root to access the FT_Glyph data.
-    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
-    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
-    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+    ++m_glyphGeneration;
+}
 
-    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
-    if (!outline)
-    {
-        if (bold)
-            FT_Bitmap_Embolden(m_fontHandles->library, &bitmap, weight, weight);
 
-        if (outlineThickness != 0)
-            err() << "Failed to outline glyph (no fallback available)" << std::endl;
+////////////////////////////////////////////////////////////
+void Font::restartAsyncLoader()
+{
+    // Glyphs requested from the previous loader will be requested again
+    m_asyncLoader.reset();
+
+    if (!m_isAsync || !m_fontHandles)
+        return;
+
+    // Read the whole font for the worker thread, since the stream cannot be shared
+    auto*                  stream = static_cast<InputStream*>(m_fontHandles->streamRec.descriptor.pointer);
+    std::vector<std::byte> data(m_fontHandles->streamRec.size);
+    if (!stream->seek(0).has_value() || (stream->read(data.data(), data.size()) != data.size()))
+    {
+        err() << "Failed to read font data for asynchronous glyph loading, glyphs will be loaded synchronously"
+              << std::endl;
+        return;
     }
 
-    // Compute the glyph's advance offset
-    glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
-    if (bold)
-        glyph.advance += static_cast<float>(weight) / float{1 << 6};
+    m_asyncLoader = std::make_unique<AsyncLoader>(std::move(data), isDistanceFieldActive());
+}
 
-    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
-    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
 
-    Vector2u size(bitmap.width, bitmap.rows);
+////////////////////////////////////////////////////////////
+bool Font::isGlyphPending(const Glyph& glyph) const
+{
+    return &glyph == &pendingGlyph;
+}
 
-    if ((size.x > 0) && (size.y > 0))
-    {
-        // Leave a small padding around characters, so that filtering doesn't
-        // pollute them with pixels from neighbors
-        const unsigned int padding = 2;
 
-        size += 2u * Vector2u(padding, padding);
+////////////////////////////////////////////////////////////
+std::uint64_t Font::getGlyphGeneration() const
+{
+    commitLoadedGlyphs();
 
-        // Get the glyphs page corresponding to the character size
-        Page& page = loadPage(characterSize);
+    return m_glyphGeneration;
+}
 
-        // Find a good position for the new glyph into the texture
-        glyph.textureRect = findGlyphRect(page, size);
 
-        // Make sure the texture data is positioned in the center
-        // of the allocated texture rectangle
-        glyph.textureRect.position += Vector2i(padding, padding);
-        glyph.textureRect.size -= 2 * Vector2i(padding, padding);
+////////////////////////////////////////////////////////////
+bool Font::isDistanceFieldActive() const
+{
+#ifdef SFML_FREETYPE_HAS_SDF
+    return m_isDistanceField && m_fontHandles && m_fontHandles->face && FT_IS_SCALABLE(m_fontHandles->face);
+#else
+    return false;
+#endif
+}
 
-        // Compute the glyph's bounding box
-        glyph.bounds.position = Vector2f(Vector2i(bitmapGlyph->left, -bitmapGlyph->top));
-        glyph.bounds.size     = Vector2f(Vector2u(bitmap.width, bitmap.rows));
 
-        // Resize the pixel buffer to the new size and fill it with transparent white pixels
-        m_pixelBuffer.resize(std::size_t{size.x} * std::size_t{size.y} * 4);
+////////////////////////////////////////////////////////////
+float Font::getDistanceFieldOffset(float distance, unsigned int characterSize) const
+{
+    if (characterSize == 0)
+        return 0.f;
 
-        std::uint8_t* current = m_pixelBuffer.data();
-        std::uint8_t* end     = current + size.x * size.y * 4;
+    // Distance fields map [-spread, spread] pixels at the reference size to [0, 1]
+    const float scale             = static_cast<float>(distanceFieldSize) / static_cast<float>(characterSize);
+    const float referenceDistance = distance * scale;
+    return referenceDistance / static_cast<float>(2 * distanceFieldSpread);
+}
 
-        while (current != end)
-        {
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 0;
-        }
 
-        // Extract the glyph's pixels from the bitmap
-        const std::uint8_t* pixels = bitmap.buffer;
-        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
-        {
-            // Pixels are 1 bit monochrome values
-            for (unsigned int y = padding; y < size.y - padding; ++y)
-            {
-                for (unsigned int x = padding; x < size.x - padding; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = x + y * size.x;
-                    m_pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
-                }
-                pixels += bitmap.pitch;
-            }
-        }
-        else
-        {
-            // Pixels are 8 bit gray levels
-            for (unsigned int y = padding; y < size.y - padding; ++y)
-            {
-                for (unsigned int x = padding; x < size.x - padding; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index      = x + y * size.x;
-                    m_pixelBuffer[index * 4 + 3] = pixels[x - padding];
-                }
-                pixels += bitmap.pitch;
-            }
-        }
+////////////////////////////////////////////////////////////
+Glyph Font::loadGlyph(std::uint32_t id, unsigned int characterSize, bool bold, float outlineThickness) const
+{
+    // The glyph to return
+    Glyph glyph;
 
-        // Write the pixels to the texture
-        const auto dest       = Vector2u(glyph.textureRect.position) - Vector2u(padding, padding);
-        const auto updateSize = Vector2u(glyph.textureRect.size) + 2u * Vector2u(padding, padding);
-        page.texture.update(m_pixelBuffer.data(), updateSize, dest);
-    }
+    // Stop if no font is loaded
+    if (!m_fontHandles)
+        return glyph;
 
-    // Delete the FT glyph
-    FT_Done_Glyph(glyphDesc);
+    // Get our FT_Face
+    FT_Face face = m_fontHandles->face;
+    if (!face)
+        return glyph;
+
+    // Set the character size
+    if (!setCurrentSize(characterSize))
+        return glyph;
+
+    const Vector2u size = rasterizeGlyph(m_fontHandles->library,
+                                         face,
+                                         m_fontHandles->stroker,
+                                         id,
+                                         bold,
+                                         outlineThickness,
+                                         isDistanceFieldActive(),
+                                         glyph,
+                                         m_pixelBuffer);
+
+    if ((size.x > 0) && (size.y > 0))
+        writeGlyph(loadPage(characterSize), glyph, size, m_pixelBuffer.data());
 
     // Done :)
     return glyph;
@@ -689,76 +1249,65 @@ Glyph Font::loadGlyph(std::uint32_t id, unsigned int characterSize, bool bold, f
 
 
 ////////////////////////////////////////////////////////////
-IntRect Font::findGlyphRect(Page& page, Vector2u size) const
+void Font::writeGlyph(Page& page, Glyph& glyph, Vector2u size, const std::uint8_t* pixels) const
 {
-    // Find the line that fits well the glyph
-    Row*  row       = nullptr;
-    float bestRatio = 0;
-    for (auto it = page.rows.begin(); it != page.rows.end() && !row; ++it)
-    {
-        const float ratio = static_cast<float>(size.y) / static_cast<float>(it->height);
-
-        // Ignore rows that are either too small or too high
-        if ((ratio < 0.7f) || (ratio > 1.f))
-            continue;
+    // Find a good position for the new glyph into the page textures
+    glyph.textureRect = findGlyphRect(page, size, glyph.textureIndex);
+
+    // Make sure the texture data is positioned in the center
+    // of the allocated texture rectangle
+    glyph.textureRect.position += Vector2i(glyphPadding, glyphPadding);
+    glyph.textureRect.size -= 2 * Vector2i(glyphPadding, glyphPadding);
+
+    // Write the pixels to the texture
+    const auto dest       = Vector2u(glyph.textureRect.position) - Vector2u(glyphPadding, glyphPadding);
+    const auto updateSize = Vector2u(glyph.textureRect.size) + 2u * Vector2u(glyphPadding, glyphPadding);
+    page.textures[glyph.textureIndex].texture.update(pixels, updateSize, dest);
+}
 
-        // Check if there's enough horizontal space left in the row
-        if (size.x > page.texture.getSize().x - it->width)
-            continue;
 
-        // Make sure that this new row is the best found so far
-        if (ratio < bestRatio)
-            continue;
+////////////////////////////////////////////////////////////
+IntRect Font::findGlyphRect(Page& page, Vector2u size, unsigned int& textureIndex) const
+{
+    textureIndex = 0;
 
-        // The current row passed all the tests: we can select it
-        row       = &*it;
-        bestRatio = ratio;
+    // Try the textures from the most recent one: older textures are full
+    // and only have room left for small glyphs
+    for (std::size_t i = page.textures.size(); i-- > 0;)
+    {
+        if (const auto position = page.textures[i].insert(size))
+        {
+            textureIndex = static_cast<unsigned int>(i);
+            return {Vector2i(*position), Vector2i(size)};
+        }
     }
 
-    // If we didn't find a matching row, create a new one (10% taller than the glyph)
-    if (!row)
+    // Not enough space: make the most recent texture bigger if possible
+    PageTexture* pageTexture = &page.textures.back();
+    while (pageTexture->grow())
     {
-        const unsigned int rowHeight = size.y + size.y / 10;
-        while ((page.nextRow + rowHeight >= page.texture.getSize().y) || (size.x >= page.texture.getSize().x))
+        if (const auto position = pageTexture->insert(size))
         {
-            // Not enough space: resize the texture if possible
-            const Vector2u textureSize = page.texture.getSize();
-            if ((textureSize.x * 2 <= Texture::getMaximumSize()) && (textureSize.y * 2 <= Texture::getMaximumSize()))
-            {
-                // Make the texture 2 times bigger
-                Texture newTexture;
-                if (!newTexture.resize(textureSize * 2u))
-                {
-                    err() << "Failed to create new page texture" << std::endl;
-                    return {{0, 0}, {2, 2}};
-                }
-
-                newTexture.setSmooth(m_isSmooth);
-                newTexture.update(page.texture);
-                page.texture.swap(newTexture);
-            }
-            else
-            {
-                // Oops, we've reached the maximum texture size...
-                err() << "Failed to add a new character to the font: the maximum texture size has been reached"
-                      << std::endl;
-                return {{0, 0}, {2, 2}};
-            }
+            textureIndex = static_cast<unsigned int>(page.textures.size() - 1);
+            return {Vector2i(*position), Vector2i(size)};
         }
-
-        // We can now create the new row
-        page.rows.emplace_back(page.nextRow, rowHeight);
-        page.nextRow += rowHeight;
-        row = &page.rows.back();
     }
 
-    // Find the glyph's rectangle on the selected row
-    IntRect rect(Rect<unsigned int>({row->width, row->top}, size));
-
-    // Update the row information
-    row->width += size.x;
+    // The maximum texture size has been reached: start a new texture
+    pageTexture = &page.textures.emplace_back(m_isSmooth);
+    do
+    {
+        if (const auto position = pageTexture->insert(size))
+        {
+            textureIndex = static_cast<unsigned int>(page.textures.size() - 1);
+            return {Vector2i(*position), Vector2i(size)};
+        }
+    } while (pageTexture->grow());
 
-    return rect;
+    // Oops, the glyph doesn't even fit into an empty texture of the maximum size...
+    page.textures.pop_back();
+    err() << "Failed to add a new character to the font: the maximum texture size has been reached" << std::endl;
+    return {{0, 0}, {2, 2}};
 }
 
 
@@ -805,6 +1354,13 @@ bool Font::setCurrentSize(unsigned int characterSize) const
 
 ////////////////////////////////////////////////////////////
 Font::Page::Page(bool smooth)
+{
+    textures.emplace_back(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+Font::PageTexture::PageTexture(bool smooth)
 {
     // Make sure that the texture is initialized by default
     Image image({128, 128}, Color::Transparent);
@@ -821,6 +1377,127 @@ Font::Page::Page(bool smooth)
     }
 
     texture.setSmooth(smooth);
+
+    // The skyline starts below the white square, leaving a one pixel gap
+    skyline.push_back({0, 3, texture.getSize().x});
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Vector2u> Font::PageTexture::insert(Vector2u size)
+{
+    const Vector2u textureSize = texture.getSize();
+
+    // Find the position where the glyph's bottom edge is the lowest,
+    // preferring the one wasting the least space below the glyph
+    std::optional<std::size_t> bestIndex;
+    unsigned int               bestY     = 0;
+    std::uint64_t              bestWaste = 0;
+
+    for (std::size_t i = 0; i < skyline.size(); ++i)
+    {
+        const unsigned int x = skyline[i].x;
+        if (x + size.x > textureSize.x)
+            break;
+
+        // The glyph rests on the highest segment it spans
+        unsigned int y = 0;
+        for (std::size_t j = i; (j < skyline.size()) && (skyline[j].x < x + size.x); ++j)
+            y = std::max(y, skyline[j].y);
+
+        if (y + size.y > textureSize.y)
+            continue;
+
+        if (bestIndex && (y > bestY))
+            continue;
+
+        // Compute the area trapped between the skyline and the glyph
+        std::uint64_t waste = 0;
+        for (std::size_t j = i; (j < skyline.size()) && (skyline[j].x < x + size.x); ++j)
+        {
+            const unsigned int spanned = std::min(skyline[j].x + skyline[j].width, x + size.x) - skyline[j].x;
+            waste += std::uint64_t{y - skyline[j].y} * spanned;
+        }
+
+        if (bestIndex && (y == bestY) && (waste >= bestWaste))
+            continue;
+
+        bestIndex = i;
+        bestY     = y;
+        bestWaste = waste;
+    }
+
+    if (!bestIndex)
+        return std::nullopt;
+
+    // Insert the new segment on top of the glyph
+    const SkylineNode node{skyline[*bestIndex].x, bestY + size.y, size.x};
+    skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(*bestIndex), node);
+
+    // Shrink or remove the segments now covered by the new one
+    const unsigned int right = node.x + node.width;
+    for (std::size_t i = *bestIndex + 1; (i < skyline.size()) && (skyline[i].x < right);)
+    {
+        SkylineNode& covered = skyline[i];
+        if (covered.x + covered.width <= right)
+        {
+            skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+            continue;
+        }
+
+        covered.width -= right - covered.x;
+        covered.x = right;
+        break;
+    }
+
+    // Merge neighbor segments of the same height
+    for (std::size_t i = 0; i + 1 < skyline.size();)
+    {
+        if (skyline[i].y == skyline[i + 1].y)
+        {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    ++glyphCount;
+    usedArea += std::uint64_t{size.x} * std::uint64_t{size.y};
+    wastedArea += bestWaste;
+
+    return Vector2u(node.x, bestY);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::PageTexture::grow()
+{
+    const Vector2u textureSize = texture.getSize();
+    if ((textureSize.x * 2 > Texture::getMaximumSize()) || (textureSize.y * 2 > Texture::getMaximumSize()))
+        return false;
+
+    // Make the texture 2 times bigger
+    Texture newTexture;
+    if (!newTexture.resize(textureSize * 2u))
+    {
+        err() << "Failed to create new page texture" << std::endl;
+        return false;
+    }
+
+    newTexture.setSmooth(texture.isSmooth());
+    newTexture.update(texture);
+    texture.swap(newTexture);
+
+    // Extend the skyline over the new columns
+    if (skyline.back().y == 0)
+        skyline.back().width += textureSize.x;
+    else
+        skyline.push_back({textureSize.x, 0, textureSize.x});
+
+    return true;
 }
 
 
@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
 
 #include <SFML/Window/Context.hpp>
@@ -41,6 +42,8 @@
 
 #include <ostream>
 
+#include <cstdint>
+
 #if !defined(GL_MAJOR_VERSION)
 #define GL_MAJOR_VERSION 0x821B
 #endif
@@ -80,6 +83,15 @@ void extensionSanityCheck()
     check(GLEXT_framebuffer_blit_dependencies);
     check(GLEXT_framebuffer_multisample_dependencies);
     check(GLEXT_copy_buffer_dependencies);
+    check(GLEXT_timer_query_dependencies);
+    check(GLEXT_draw_instanced_dependencies);
+    check(GLEXT_instanced_arrays_dependencies);
+    check(GLEXT_vertex_array_object_dependencies);
+    check(GLEXT_map_buffer_range_dependencies);
+    check(GLEXT_sync_dependencies);
+    check(GLEXT_uniform_buffer_object_dependencies);
+    check(GLEXT_get_program_binary_dependencies);
+    check(GLEXT_texture_compression_dependencies);
 #endif
 }
 } // namespace
@@ -141,4 +153,41 @@ void ensureExtensionsInit()
     }
 }
 
+
+////////////////////////////////////////////////////////////
+bool isCoreProfileActive()
+{
+#ifdef SFML_OPENGL_ES
+    return false;
+#else
+    // Context IDs are never reused, so the last queried context can be cached per thread
+    struct ProfileCache
+    {
+        std::uint64_t contextId{};
+        bool          core{};
+    };
+    thread_local ProfileCache profileCache;
+
+    const std::uint64_t contextId = Context::getActiveContextId();
+
+    if (contextId != profileCache.contextId)
+    {
+        profileCache.contextId = contextId;
+        profileCache.core      = false;
+
+        // Profiles only exist since OpenGL 3.2
+        // The version string is parsed since querying GL_MAJOR_VERSION fails on older contexts
+        const GLubyte* version = glCheck(glGetString(GL_VERSION));
+        if (version && ((version[0] > '3') || ((version[0] == '3') && (version[2] >= '2'))))
+        {
+            int profileMask = 0;
+            glCheck(glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &profileMask));
+            profileCache.core = (profileMask & GL_CONTEXT_CORE_PROFILE_BIT) != 0;
+        }
+    }
+
+    return profileCache.core;
+#endif
+}
+
 } // namespace sf::priv
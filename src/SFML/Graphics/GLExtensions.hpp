@@ -65,20 +65,24 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 // Core since 1.1
 // 1.1 does not support GL_STREAM_DRAW so we just define it to GL_DYNAMIC_DRAW
-#define GLEXT_vertex_buffer_object ::sf::priv::SF_GL_OES_vertex_buffer_object
-#define GLEXT_glBindBuffer         glBindBuffer
-#define GLEXT_glBufferData         glBufferData
-#define GLEXT_glBufferSubData      glBufferSubData
-#define GLEXT_glDeleteBuffers      glDeleteBuffers
-#define GLEXT_glGenBuffers         glGenBuffers
-#define GLEXT_GL_ARRAY_BUFFER      GL_ARRAY_BUFFER
-#define GLEXT_GL_DYNAMIC_DRAW      GL_DYNAMIC_DRAW
-#define GLEXT_GL_STATIC_DRAW       GL_STATIC_DRAW
-#define GLEXT_GL_STREAM_DRAW       GL_DYNAMIC_DRAW
+#define GLEXT_vertex_buffer_object    ::sf::priv::SF_GL_OES_vertex_buffer_object
+#define GLEXT_glBindBuffer            glBindBuffer
+#define GLEXT_glBufferData            glBufferData
+#define GLEXT_glBufferSubData         glBufferSubData
+#define GLEXT_glDeleteBuffers         glDeleteBuffers
+#define GLEXT_glGenBuffers            glGenBuffers
+#define GLEXT_GL_ARRAY_BUFFER         GL_ARRAY_BUFFER
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER GL_ELEMENT_ARRAY_BUFFER
+#define GLEXT_GL_DYNAMIC_DRAW         GL_DYNAMIC_DRAW
+#define GLEXT_GL_STATIC_DRAW          GL_STATIC_DRAW
+#define GLEXT_GL_STREAM_DRAW          GL_DYNAMIC_DRAW
 
 #define GLEXT_vertex_buffer_object_dependencies \
     ::sf::priv::SF_GL_OES_vertex_buffer_object, glBindBuffer, glBufferData, glBufferSubData, glDeleteBuffers, glGenBuffers
 
+// OES_element_index_uint, 32-bit indices are optional
+#define GLEXT_element_index_uint SF_GLAD_GL_OES_element_index_uint
+
 // The following extensions are listed chronologically
 // Extension macro first, followed by tokens then
 // functions according to the corresponding specification
@@ -183,6 +187,136 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 #define GLEXT_EXT_blend_minmax_dependencies SF_GLAD_GL_EXT_blend_minmax, glBlendEquationEXT
 
+// Core since 3.0 - EXT_disjoint_timer_query
+#define GLEXT_timer_query false
+#define GLEXT_glGenQueries \
+    glGenQueries // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDeleteQueries \
+    glDeleteQueries // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glQueryCounter \
+    glQueryCounter // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetQueryObjectiv \
+    glGetQueryObjectiv // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetQueryObjectui64v \
+    glGetQueryObjectui64v // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_TIMESTAMP              0
+#define GLEXT_GL_QUERY_RESULT           0
+#define GLEXT_GL_QUERY_RESULT_AVAILABLE 0
+
+// Core since 3.0 - EXT_draw_instanced / EXT_instanced_arrays
+#define GLEXT_draw_instanced   false
+#define GLEXT_instanced_arrays false
+#define GLEXT_glDrawArraysInstanced \
+    glDrawArraysInstanced // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glVertexAttribDivisor \
+    glVertexAttribDivisor // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glVertexAttribPointer \
+    glVertexAttribPointer // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glEnableVertexAttribArray \
+    glEnableVertexAttribArray // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDisableVertexAttribArray \
+    glDisableVertexAttribArray // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetAttribLocation \
+    glGetAttribLocation // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - OES_vertex_array_object
+#define GLEXT_vertex_array_object false
+#define GLEXT_glGenVertexArrays \
+    glGenVertexArrays // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDeleteVertexArrays \
+    glDeleteVertexArrays // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glBindVertexArray \
+    glBindVertexArray // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - EXT_map_buffer_range
+#define GLEXT_map_buffer_range false
+#define GLEXT_glMapBufferRange \
+    glMapBufferRange // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_MAP_WRITE_BIT             0
+#define GLEXT_GL_MAP_INVALIDATE_RANGE_BIT  0
+#define GLEXT_GL_MAP_INVALIDATE_BUFFER_BIT 0
+#define GLEXT_GL_MAP_UNSYNCHRONIZED_BIT    0
+
+// Core since 3.0 - NV_pixel_buffer_object
+#define GLEXT_pixel_buffer_object false
+#define GLEXT_glMapBuffer \
+    glMapBuffer // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glUnmapBuffer \
+    glUnmapBuffer // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_PIXEL_PACK_BUFFER   0
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER 0
+#define GLEXT_GL_READ_ONLY           0
+#define GLEXT_GL_WRITE_ONLY          0
+#define GLEXT_GL_STREAM_READ         0
+
+// Core since 3.0 - APPLE_sync
+#define GLEXT_sync false
+#define GLEXT_glFenceSync \
+    glFenceSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glClientWaitSync \
+    glClientWaitSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDeleteSync \
+    glDeleteSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE 0
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT    0
+#define GLEXT_GL_ALREADY_SIGNALED           0
+#define GLEXT_GL_CONDITION_SATISFIED        0
+#define GLEXT_GL_WAIT_FAILED                0
+
+// Core since 3.0
+#define GLEXT_uniform_buffer_object false
+#define GLEXT_glGetUniformBlockIndex \
+    glGetUniformBlockIndex // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glUniformBlockBinding \
+    glUniformBlockBinding // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glBindBufferBase \
+    glBindBufferBase // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_UNIFORM_BUFFER                  0
+#define GLEXT_GL_INVALID_INDEX                   0
+#define GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS     0
+#define GLEXT_GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT 0
+
+// Core since 3.0 - OES_get_program_binary
+#define GLEXT_get_program_binary false
+#define GLEXT_glGetProgramBinary \
+    glGetProgramBinary // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glProgramBinary \
+    glProgramBinary // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glProgramParameteri \
+    glProgramParameteri // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetProgramiv \
+    glGetProgramiv // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0
+#define GLEXT_GL_PROGRAM_BINARY_LENGTH           0
+#define GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS      0
+#define GLEXT_GL_PROGRAM_BINARY_FORMATS          0
+
+// Core since 3.0 - primitive restart with a fixed index
+#define GLEXT_primitive_restart                false
+#define GLEXT_GL_PRIMITIVE_RESTART_FIXED_INDEX 0
+
+// Core since 1.0 - compressed formats are only available through ES 3.0 or extensions which are not loaded
+#define GLEXT_texture_compression                 false
+#define GLEXT_glCompressedTexImage2D              glCompressedTexImage2D
+#define GLEXT_texture_compression_s3tc            false
+#define GLEXT_texture_compression_rgtc            false
+#define GLEXT_texture_compression_bptc            false
+#define GLEXT_texture_compression_etc2            false
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT1        0
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT3        0
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT5        0
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1  0
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3  0
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5  0
+#define GLEXT_GL_COMPRESSED_RED_RGTC1             0
+#define GLEXT_GL_COMPRESSED_RG_RGTC2              0
+#define GLEXT_GL_COMPRESSED_RGBA_BPTC_UNORM       0
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM 0
+#define GLEXT_GL_COMPRESSED_RGB8_ETC2             0
+#define GLEXT_GL_COMPRESSED_SRGB8_ETC2            0
+#define GLEXT_GL_COMPRESSED_RGBA8_ETC2_EAC        0
+#define GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC 0
+
 #else
 
 // SFML requires at a bare minimum OpenGL 1.1 capability
@@ -234,6 +368,7 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 // Core since 1.5 - ARB_vertex_buffer_object
 #define GLEXT_vertex_buffer_object             SF_GLAD_GL_ARB_vertex_buffer_object
 #define GLEXT_GL_ARRAY_BUFFER                  GL_ARRAY_BUFFER_ARB
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER          GL_ELEMENT_ARRAY_BUFFER_ARB
 #define GLEXT_GL_DYNAMIC_DRAW                  GL_DYNAMIC_DRAW_ARB
 #define GLEXT_GL_READ_ONLY                     GL_READ_ONLY_ARB
 #define GLEXT_GL_STATIC_DRAW                   GL_STATIC_DRAW_ARB
@@ -251,6 +386,9 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
     SF_GLAD_GL_ARB_vertex_buffer_object, glBindBufferARB, glBufferDataARB, glBufferSubDataARB, glDeleteBuffersARB, \
         glGenBuffersARB, glMapBufferARB, glUnmapBufferARB
 
+// Core since 1.1 - 32-bit indices are always supported
+#define GLEXT_element_index_uint true
+
 // Core since 2.0 - ARB_shading_language_100
 #define GLEXT_shading_language_100     SF_GLAD_GL_ARB_shading_language_100
 
@@ -275,9 +413,12 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_glUniform4i              glUniform4iARB
 #define GLEXT_glUniform1fv             glUniform1fvARB
 #define GLEXT_glUniform2fv             glUniform2fvARB
-#define GLEXT_glUniform2iv             glUniform2ivARB
 #define GLEXT_glUniform3fv             glUniform3fvARB
 #define GLEXT_glUniform4fv             glUniform4fvARB
+#define GLEXT_glUniform1iv             glUniform1ivARB
+#define GLEXT_glUniform2iv             glUniform2ivARB
+#define GLEXT_glUniform3iv             glUniform3ivARB
+#define GLEXT_glUniform4iv             glUniform4ivARB
 #define GLEXT_glUniformMatrix3fv       glUniformMatrix3fvARB
 #define GLEXT_glUniformMatrix4fv       glUniformMatrix4fvARB
 #define GLEXT_glGetObjectParameteriv   glGetObjectParameterivARB
@@ -292,8 +433,9 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
     SF_GLAD_GL_ARB_shader_objects, glDeleteObjectARB, glGetHandleARB, glCreateShaderObjectARB, glShaderSourceARB,       \
         glCompileShaderARB, glCreateProgramObjectARB, glAttachObjectARB, glLinkProgramARB, glUseProgramObjectARB,       \
         glUniform1fARB, glUniform2fARB, glUniform3fARB, glUniform4fARB, glUniform1iARB, glUniform2iARB, glUniform3iARB, \
-        glUniform4iARB, glUniform1fvARB, glUniform2fvARB, glUniform2ivARB, glUniform3fvARB, glUniform4fvARB,            \
-        glUniformMatrix3fvARB, glUniformMatrix4fvARB, glGetObjectParameterivARB, glGetInfoLogARB, glGetUniformLocationARB
+        glUniform4iARB, glUniform1fvARB, glUniform2fvARB, glUniform3fvARB, glUniform4fvARB, glUniform1ivARB,            \
+        glUniform2ivARB, glUniform3ivARB, glUniform4ivARB, glUniformMatrix3fvARB, glUniformMatrix4fvARB,                \
+        glGetObjectParameterivARB, glGetInfoLogARB, glGetUniformLocationARB
 
 // Core since 2.0 - ARB_vertex_shader
 #define GLEXT_vertex_shader                       SF_GLAD_GL_ARB_vertex_shader
@@ -382,6 +524,144 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_geometry_shader4         SF_GLAD_GL_ARB_geometry_shader4
 #define GLEXT_GL_GEOMETRY_SHADER       GL_GEOMETRY_SHADER_ARB
 
+// Core since 3.3 - ARB_timer_query
+// The query object entry points it relies on are core since 1.5
+#define GLEXT_timer_query               SF_GLAD_GL_ARB_timer_query
+#define GLEXT_glGenQueries              glGenQueries
+#define GLEXT_glDeleteQueries           glDeleteQueries
+#define GLEXT_glQueryCounter            glQueryCounter
+#define GLEXT_glGetQueryObjectiv        glGetQueryObjectiv
+#define GLEXT_glGetQueryObjectui64v     glGetQueryObjectui64v
+#define GLEXT_GL_TIMESTAMP              GL_TIMESTAMP
+#define GLEXT_GL_QUERY_RESULT           GL_QUERY_RESULT
+#define GLEXT_GL_QUERY_RESULT_AVAILABLE GL_QUERY_RESULT_AVAILABLE
+
+#define GLEXT_timer_query_dependencies                                                                \
+    SF_GLAD_GL_ARB_timer_query, glGenQueries, glDeleteQueries, glQueryCounter, glGetQueryObjectiv, \
+        glGetQueryObjectui64v
+
+// Core since 3.1 - ARB_draw_instanced
+#define GLEXT_draw_instanced        SF_GLAD_GL_ARB_draw_instanced
+#define GLEXT_glDrawArraysInstanced glDrawArraysInstancedARB
+
+#define GLEXT_draw_instanced_dependencies SF_GLAD_GL_ARB_draw_instanced, glDrawArraysInstancedARB
+
+// Core since 3.3 - ARB_instanced_arrays
+// The generic vertex attribute entry points are provided by ARB_vertex_shader
+#define GLEXT_instanced_arrays           SF_GLAD_GL_ARB_instanced_arrays
+#define GLEXT_glVertexAttribDivisor      glVertexAttribDivisorARB
+#define GLEXT_glVertexAttribPointer      glVertexAttribPointerARB
+#define GLEXT_glEnableVertexAttribArray  glEnableVertexAttribArrayARB
+#define GLEXT_glDisableVertexAttribArray glDisableVertexAttribArrayARB
+#define GLEXT_glGetAttribLocation        glGetAttribLocationARB
+
+#define GLEXT_instanced_arrays_dependencies                                                                       \
+    SF_GLAD_GL_ARB_instanced_arrays, glVertexAttribDivisorARB, glVertexAttribPointerARB, glEnableVertexAttribArrayARB, \
+        glDisableVertexAttribArrayARB, glGetAttribLocationARB
+
+// Core since 3.0 - ARB_vertex_array_object
+#define GLEXT_vertex_array_object  SF_GLAD_GL_ARB_vertex_array_object
+#define GLEXT_glGenVertexArrays    glGenVertexArrays
+#define GLEXT_glDeleteVertexArrays glDeleteVertexArrays
+#define GLEXT_glBindVertexArray    glBindVertexArray
+
+#define GLEXT_vertex_array_object_dependencies \
+    SF_GLAD_GL_ARB_vertex_array_object, glGenVertexArrays, glDeleteVertexArrays, glBindVertexArray
+
+// Core since 3.0 - ARB_map_buffer_range
+#define GLEXT_map_buffer_range             SF_GLAD_GL_ARB_map_buffer_range
+#define GLEXT_glMapBufferRange             glMapBufferRange
+#define GLEXT_GL_MAP_WRITE_BIT             GL_MAP_WRITE_BIT
+#define GLEXT_GL_MAP_INVALIDATE_RANGE_BIT  GL_MAP_INVALIDATE_RANGE_BIT
+#define GLEXT_GL_MAP_INVALIDATE_BUFFER_BIT GL_MAP_INVALIDATE_BUFFER_BIT
+#define GLEXT_GL_MAP_UNSYNCHRONIZED_BIT    GL_MAP_UNSYNCHRONIZED_BIT
+
+#define GLEXT_map_buffer_range_dependencies SF_GLAD_GL_ARB_map_buffer_range, glMapBufferRange
+
+// Core since 2.1 - ARB_pixel_buffer_object
+// The buffer object entry points it relies on are provided by ARB_vertex_buffer_object
+#define GLEXT_pixel_buffer_object    SF_GLAD_GL_ARB_pixel_buffer_object
+#define GLEXT_GL_PIXEL_PACK_BUFFER   GL_PIXEL_PACK_BUFFER_ARB
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER GL_PIXEL_UNPACK_BUFFER_ARB
+#define GLEXT_GL_STREAM_READ         GL_STREAM_READ_ARB
+
+// Core since 3.2 - ARB_sync
+#define GLEXT_sync                          SF_GLAD_GL_ARB_sync
+#define GLEXT_glFenceSync                   glFenceSync
+#define GLEXT_glClientWaitSync              glClientWaitSync
+#define GLEXT_glDeleteSync                  glDeleteSync
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT    GL_SYNC_FLUSH_COMMANDS_BIT
+#define GLEXT_GL_ALREADY_SIGNALED           GL_ALREADY_SIGNALED
+#define GLEXT_GL_CONDITION_SATISFIED        GL_CONDITION_SATISFIED
+#define GLEXT_GL_WAIT_FAILED                GL_WAIT_FAILED
+
+#define GLEXT_sync_dependencies SF_GLAD_GL_ARB_sync, glFenceSync, glClientWaitSync, glDeleteSync
+
+// Core since 3.1 - ARB_uniform_buffer_object
+// The buffer object entry points it relies on are provided by ARB_vertex_buffer_object
+#define GLEXT_uniform_buffer_object              SF_GLAD_GL_ARB_uniform_buffer_object
+#define GLEXT_glGetUniformBlockIndex             glGetUniformBlockIndex
+#define GLEXT_glUniformBlockBinding              glUniformBlockBinding
+#define GLEXT_glBindBufferBase                   glBindBufferBase
+#define GLEXT_GL_UNIFORM_BUFFER                  GL_UNIFORM_BUFFER
+#define GLEXT_GL_INVALID_INDEX                   GL_INVALID_INDEX
+#define GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS     GL_MAX_UNIFORM_BUFFER_BINDINGS
+#define GLEXT_GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+
+#define GLEXT_uniform_buffer_object_dependencies \
+    SF_GLAD_GL_ARB_uniform_buffer_object, glGetUniformBlockIndex, glUniformBlockBinding, glBindBufferBase
+
+// Core since 4.1 - ARB_get_program_binary
+// glGetProgramiv is core since 2.0, the extension requires 3.0
+#define GLEXT_get_program_binary                 SF_GLAD_GL_ARB_get_program_binary
+#define GLEXT_glGetProgramBinary                 glGetProgramBinary
+#define GLEXT_glProgramBinary                    glProgramBinary
+#define GLEXT_glProgramParameteri                glProgramParameteri
+#define GLEXT_glGetProgramiv                     glGetProgramiv
+#define GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GLEXT_GL_PROGRAM_BINARY_LENGTH           GL_PROGRAM_BINARY_LENGTH
+#define GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS      GL_NUM_PROGRAM_BINARY_FORMATS
+#define GLEXT_GL_PROGRAM_BINARY_FORMATS          GL_PROGRAM_BINARY_FORMATS
+
+#define GLEXT_get_program_binary_dependencies \
+    SF_GLAD_GL_ARB_get_program_binary, glGetProgramBinary, glProgramBinary, glProgramParameteri, glGetProgramiv
+
+// Core since 1.3 - ARB_texture_compression
+#define GLEXT_texture_compression    SF_GLAD_GL_ARB_texture_compression
+#define GLEXT_glCompressedTexImage2D glCompressedTexImage2DARB
+#define GLEXT_GL_TEXTURE_COMPRESSED  GL_TEXTURE_COMPRESSED_ARB
+
+#define GLEXT_texture_compression_dependencies SF_GLAD_GL_ARB_texture_compression, glCompressedTexImage2DARB
+
+// EXT_texture_compression_s3tc, the sRGB variants are provided by EXT_texture_sRGB
+#define GLEXT_texture_compression_s3tc           SF_GLAD_GL_EXT_texture_compression_s3tc
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT1       GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT3       GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT5       GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1 GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3 GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5 GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
+
+// Core since 3.0 - ARB_texture_compression_rgtc
+#define GLEXT_texture_compression_rgtc SF_GLAD_GL_ARB_texture_compression_rgtc
+#define GLEXT_GL_COMPRESSED_RED_RGTC1  GL_COMPRESSED_RED_RGTC1
+#define GLEXT_GL_COMPRESSED_RG_RGTC2   GL_COMPRESSED_RG_RGTC2
+
+// Core since 4.2 - ARB_texture_compression_bptc
+#define GLEXT_texture_compression_bptc            SF_GLAD_GL_ARB_texture_compression_bptc
+#define GLEXT_GL_COMPRESSED_RGBA_BPTC_UNORM       GL_COMPRESSED_RGBA_BPTC_UNORM_ARB
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM_ARB
+
+// Core since 4.3 - ARB_ES3_compatibility
+#define GLEXT_texture_compression_etc2            SF_GLAD_GL_ARB_ES3_compatibility
+#define GLEXT_GL_COMPRESSED_RGB8_ETC2             GL_COMPRESSED_RGB8_ETC2
+#define GLEXT_GL_COMPRESSED_SRGB8_ETC2            GL_COMPRESSED_SRGB8_ETC2
+#define GLEXT_GL_COMPRESSED_RGBA8_ETC2_EAC        GL_COMPRESSED_RGBA8_ETC2_EAC
+#define GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC
+#define GLEXT_primitive_restart                   SF_GLAD_GL_ARB_ES3_compatibility
+#define GLEXT_GL_PRIMITIVE_RESTART_FIXED_INDEX    GL_PRIMITIVE_RESTART_FIXED_INDEX
+
 #endif
 
 // OpenGL Versions
@@ -414,4 +694,16 @@ namespace sf::priv
 ////////////////////////////////////////////////////////////
 void ensureExtensionsInit();
 
+////////////////////////////////////////////////////////////
+/// \brief Check whether the active context uses the core profile
+///
+/// Core profile contexts don't provide the fixed-function
+/// pipeline (matrix stacks, client-side vertex arrays).
+/// The result is cached per context.
+///
+/// \return `true` if the active context is a core profile context
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isCoreProfileActive();
+
 } // namespace sf::priv
@@ -26,10 +26,12 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/ImageKernels.hpp>
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/Utils.hpp>
 #ifdef SFML_SYSTEM_ANDROID
 #include <SFML/System/Android/Activity.hpp>
@@ -117,6 +119,36 @@ bool isQoiMagicNumber(std::string_view buffer)
 
     return buffer[0] == 'q' && buffer[1] == 'o' && buffer[2] == 'i' && buffer[3] == 'f';
 }
+
+// Decode a QOI image, or any format supported by stb_image, from memory
+bool decodeFromMemory(const void* data, std::size_t size, sf::Image& image)
+{
+    // Check if the buffer contains a QOI image
+    if (isQoiMagicNumber(std::string_view(static_cast<const char*>(data), size)))
+    {
+        qoi_desc formatDesc = {};
+        if (const auto ptr = MallocPtr(qoi_decode(data, static_cast<int>(size), &formatDesc, 4)))
+        {
+            image.resize({formatDesc.width, formatDesc.height}, static_cast<const std::uint8_t*>(ptr.get()));
+            return true;
+        }
+    }
+
+    // If we can't load it as a QOI file, we fall back to using STBI
+    // Load the image and get a pointer to the pixels in memory
+    sf::Vector2i imageSize;
+    int          channels = 0;
+    const auto*  buffer   = static_cast<const unsigned char*>(data);
+    const int    length   = static_cast<int>(size);
+    if (const auto ptr = StbPtr(
+            stbi_load_from_memory(buffer, length, &imageSize.x, &imageSize.y, &channels, STBI_rgb_alpha)))
+    {
+        image.resize(sf::Vector2u(imageSize), ptr.get());
+        return true;
+    }
+
+    return false;
+}
 } // namespace
 
 
@@ -236,6 +268,20 @@ bool Image::loadFromFile(const std::filesystem::path& filename)
 
 #endif
 
+    // Decode directly from the file mapped in memory when possible, without copying it
+    MappedFileInputStream mappedFile;
+    if (mappedFile.open(filename) && mappedFile.getData())
+    {
+        if (decodeFromMemory(mappedFile.getData(), mappedFile.getSize().value(), *this))
+            return true;
+
+        // Error, failed to load the image
+        err() << "Failed to load image\n"
+              << formatDebugPathInfo(filename) << "\nReason: " << stbi_failure_reason() << std::endl;
+
+        return false;
+    }
+
     // Set up the stb_image callbacks for the std::ifstream
     const auto readStdIfStream = [](void* user, char* data, int size)
     {
@@ -318,30 +364,8 @@ bool Image::loadFromMemory(const void* data, std::size_t size)
     // Check input parameters
     if (data && size)
     {
-        // Check if the buffer contains a QOI image
-        const auto* qoiMagicNumBuffer = static_cast<const char*>(data);
-        if (isQoiMagicNumber(std::string_view(qoiMagicNumBuffer, size)))
-        {
-            qoi_desc formatDesc = {};
-            if (const auto ptr = MallocPtr(qoi_decode(data, static_cast<int>(size), &formatDesc, 4)))
-            {
-                const Vector2u imageSize = {formatDesc.width, formatDesc.height};
-                resize(imageSize, static_cast<const uint8_t*>(ptr.get()));
-                return true;
-            }
-        }
-
-        // If we can't load it as a QOI file, we fall back to using STBI
-        // Load the image and get a pointer to the pixels in memory
-        Vector2i    imageSize;
-        int         channels = 0;
-        const auto* buffer   = static_cast<const unsigned char*>(data);
-        if (const auto ptr = StbPtr(
-                stbi_load_from_memory(buffer, static_cast<int>(size), &imageSize.x, &imageSize.y, &channels, STBI_rgb_alpha)))
-        {
-            resize(Vector2u(imageSize), ptr.get());
+        if (decodeFromMemory(data, size, *this))
             return true;
-        }
 
         // Error, failed to load the image
         err() << "Failed to load image from memory. Reason: " << stbi_failure_reason() << std::endl;
@@ -568,14 +592,13 @@ void Image::createMaskFromColor(Color color, std::uint8_t alpha)
     if (!m_pixels.empty())
     {
         // Replace the alpha of the pixels that match the transparent color
-        std::uint8_t* ptr = m_pixels.data();
-        std::uint8_t* end = ptr + m_pixels.size();
-        while (ptr != end)
-        {
-            if ((ptr[0] == color.r) && (ptr[1] == color.g) && (ptr[2] == color.b) && (ptr[3] == color.a))
-                ptr[3] = alpha;
-            ptr += 4;
-        }
+        priv::forEachRowRange(m_size.y,
+                              m_size.x,
+                              [this, color, alpha](std::size_t begin, std::size_t end)
+                              {
+                                  std::uint8_t* pixels = m_pixels.data() + begin * m_size.x * 4;
+                                  priv::maskPixels(pixels, (end - begin) * m_size.x, color, alpha);
+                              });
     }
 }
 
@@ -625,33 +648,17 @@ bool Image::copy(const Image& source, Vector2u dest, const IntRect& sourceRect,
     // Copy the pixels
     if (applyAlpha)
     {
-        // Interpolation using alpha values, pixel by pixel (slower)
-        for (unsigned int i = 0; i < dstSize.y; ++i)
-        {
-            for (unsigned int j = 0; j < dstSize.x; ++j)
-            {
-                // Get a direct pointer to the components of the current pixel
-                const std::uint8_t* src = srcPixels + j * 4;
-                std::uint8_t*       dst = dstPixels + j * 4;
-
-                // Interpolate RGBA components using the alpha values of the destination and source pixels
-                const std::uint8_t srcAlpha = src[3];
-                const std::uint8_t dstAlpha = dst[3];
-                const auto outAlpha = static_cast<std::uint8_t>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
-
-                dst[3] = outAlpha;
-
-                if (outAlpha)
-                    for (int k = 0; k < 3; k++)
-                        dst[k] = static_cast<std::uint8_t>((src[k] * srcAlpha + dst[k] * (outAlpha - srcAlpha)) / outAlpha);
-                else
-                    for (int k = 0; k < 3; k++)
-                        dst[k] = src[k];
-            }
-
-            srcPixels += srcStride;
-            dstPixels += dstStride;
-        }
+        // Interpolation using alpha values, row by row (slower)
+        priv::forEachRowRange(dstSize.y,
+                              dstSize.x,
+                              [=](std::size_t begin, std::size_t end)
+                              {
+                                  for (std::size_t i = begin; i < end; ++i)
+                                  {
+                                      const std::uint8_t* src = srcPixels + i * srcStride;
+                                      priv::blendPixels(src, dstPixels + i * dstStride, dstSize.x);
+                                  }
+                              });
     }
     else
     {
@@ -713,44 +720,107 @@ void Image::flipHorizontally()
 {
     if (!m_pixels.empty())
     {
-        const std::size_t rowSize = m_size.x * 4;
+        priv::forEachRowRange(m_size.y,
+                              m_size.x,
+                              [this](std::size_t begin, std::size_t end)
+                              {
+                                  const std::size_t rowSize = std::size_t{m_size.x} * 4;
+                                  for (std::size_t y = begin; y < end; ++y)
+                                      priv::reversePixels(m_pixels.data() + y * rowSize, m_size.x);
+                              });
+    }
+}
 
-        for (std::size_t y = 0; y < m_size.y; ++y)
-        {
-            auto left = m_pixels.begin() + static_cast<std::vector<std::uint8_t>::iterator::difference_type>(y * rowSize);
-            auto right = m_pixels.begin() +
-                         static_cast<std::vector<std::uint8_t>::iterator::difference_type>((y + 1) * rowSize - 4);
 
-            for (std::size_t x = 0; x < m_size.x / 2; ++x)
-            {
-                std::swap_ranges(left, left + 4, right);
+////////////////////////////////////////////////////////////
+void Image::flipVertically()
+{
+    if (!m_pixels.empty())
+    {
+        // Each thread exchanges a range of rows of the top half with the matching rows of the bottom half
+        priv::forEachRowRange(m_size.y / 2,
+                              m_size.x,
+                              [this](std::size_t begin, std::size_t end)
+                              {
+                                  const std::size_t rowSize = std::size_t{m_size.x} * 4;
+                                  for (std::size_t y = begin; y < end; ++y)
+                                      priv::swapPixels(m_pixels.data() + y * rowSize,
+                                                       m_pixels.data() + (m_size.y - 1 - y) * rowSize,
+                                                       m_size.x);
+                              });
+    }
+}
 
-                left += 4;
-                right -= 4;
-            }
-        }
+
+////////////////////////////////////////////////////////////
+void Image::fill(Color color, const IntRect& area)
+{
+    // Use the whole image if the area is empty, otherwise clip it to the image
+    const IntRect                bounds({0, 0}, Vector2i(m_size));
+    const std::optional<IntRect> rect = ((area.size.x == 0) || (area.size.y == 0)) ? bounds
+                                                                                   : bounds.findIntersection(area);
+    if (m_pixels.empty() || !rect)
+        return;
+
+    priv::forEachRowRange(static_cast<std::size_t>(rect->size.y),
+                          static_cast<std::size_t>(rect->size.x),
+                          [this, color, &rect](std::size_t begin, std::size_t end)
+                          {
+                              const auto left = static_cast<std::size_t>(rect->position.x);
+                              const auto top  = static_cast<std::size_t>(rect->position.y);
+                              for (std::size_t y = top + begin; y < top + end; ++y)
+                                  priv::fillPixels(&m_pixels[(y * m_size.x + left) * 4],
+                                                   static_cast<std::size_t>(rect->size.x),
+                                                   color);
+                          });
+}
+
+
+////////////////////////////////////////////////////////////
+void Image::premultiplyAlpha()
+{
+    if (!m_pixels.empty())
+    {
+        priv::forEachRowRange(m_size.y,
+                              m_size.x,
+                              [this](std::size_t begin, std::size_t end)
+                              {
+                                  std::uint8_t* pixels = m_pixels.data() + begin * m_size.x * 4;
+                                  priv::premultiplyPixels(pixels, (end - begin) * m_size.x);
+                              });
     }
 }
 
 
 ////////////////////////////////////////////////////////////
-void Image::flipVertically()
+void Image::unpremultiplyAlpha()
 {
     if (!m_pixels.empty())
     {
-        const auto rowSize = static_cast<std::vector<std::uint8_t>::iterator::difference_type>(m_size.x * 4);
+        priv::forEachRowRange(m_size.y,
+                              m_size.x,
+                              [this](std::size_t begin, std::size_t end)
+                              {
+                                  std::uint8_t* pixels = m_pixels.data() + begin * m_size.x * 4;
+                                  priv::unpremultiplyPixels(pixels, (end - begin) * m_size.x);
+                              });
+    }
+}
 
-        auto top    = m_pixels.begin();
-        auto bottom = m_pixels.end() - rowSize;
 
-        for (std::size_t y = 0; y < m_size.y / 2; ++y)
-        {
-            std::swap_ranges(top, top + rowSize, bottom);
+////////////////////////////////////////////////////////////
+bool Image::resample(Vector2u size, ResamplingFilter filter)
+{
+    if (m_pixels.empty() || (size.x == 0) || (size.y == 0))
+        return false;
 
-            top += rowSize;
-            bottom -= rowSize;
-        }
-    }
+    std::vector<std::uint8_t> newPixels(std::size_t{size.x} * std::size_t{size.y} * 4);
+    priv::resamplePixels(m_pixels.data(), m_size, newPixels.data(), size, filter);
+
+    m_pixels = std::move(newPixels);
+    m_size   = size;
+
+    return true;
 }
 
 } // namespace sf
@@ -0,0 +1,657 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ImageKernels.hpp>
+
+#include <algorithm>
+#include <array>
+#include <thread>
+#include <vector>
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SFML_IMAGE_KERNELS_SSE2
+#include <emmintrin.h>
+#elif (defined(__aarch64__) && defined(__ARM_NEON) && !defined(__ARM_BIG_ENDIAN)) || defined(_M_ARM64)
+#define SFML_IMAGE_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ImageKernelsImpl
+{
+////////////////////////////////////////////////////////////
+// Vector operations on 4 pixels, each one stored in a 32-bit lane
+// with the red component in the lowest byte
+////////////////////////////////////////////////////////////
+#if defined(SFML_IMAGE_KERNELS_SSE2)
+
+#define SFML_IMAGE_KERNELS_SIMD
+
+using VecU = __m128i;
+using VecF = __m128;
+
+// clang-format off
+VecU load(const std::uint8_t* pixels)    { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels)); }
+void store(std::uint8_t* pixels, VecU v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels), v); }
+VecU splat(std::uint32_t value)          { return _mm_set1_epi32(static_cast<int>(value)); }
+VecF splat(float value)                  { return _mm_set1_ps(value); }
+VecU bitAnd(VecU a, VecU b)              { return _mm_and_si128(a, b); }
+VecU bitOr(VecU a, VecU b)               { return _mm_or_si128(a, b); }
+VecU select(VecU mask, VecU a, VecU b)   { return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b)); }
+VecU equal(VecU a, VecU b)               { return _mm_cmpeq_epi32(a, b); }
+VecU reverse(VecU v)                     { return _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3)); }
+VecF toFloat(VecU v)                     { return _mm_cvtepi32_ps(v); }
+VecU toUint(VecF v)                      { return _mm_cvttps_epi32(v); }
+VecF add(VecF a, VecF b)                 { return _mm_add_ps(a, b); }
+VecF sub(VecF a, VecF b)                 { return _mm_sub_ps(a, b); }
+VecF mul(VecF a, VecF b)                 { return _mm_mul_ps(a, b); }
+VecF div(VecF a, VecF b)                 { return _mm_div_ps(a, b); }
+VecF min(VecF a, VecF b)                 { return _mm_min_ps(a, b); }
+VecF max(VecF a, VecF b)                 { return _mm_max_ps(a, b); }
+template <int N> VecU shiftLeft(VecU v)  { return _mm_slli_epi32(v, N); }
+template <int N> VecU shiftRight(VecU v) { return _mm_srli_epi32(v, N); }
+// clang-format on
+
+#elif defined(SFML_IMAGE_KERNELS_NEON)
+
+#define SFML_IMAGE_KERNELS_SIMD
+
+using VecU = uint32x4_t;
+using VecF = float32x4_t;
+
+// clang-format off
+VecU load(const std::uint8_t* pixels)    { return vreinterpretq_u32_u8(vld1q_u8(pixels)); }
+void store(std::uint8_t* pixels, VecU v) { vst1q_u8(pixels, vreinterpretq_u8_u32(v)); }
+VecU splat(std::uint32_t value)          { return vdupq_n_u32(value); }
+VecF splat(float value)                  { return vdupq_n_f32(value); }
+VecU bitAnd(VecU a, VecU b)              { return vandq_u32(a, b); }
+VecU bitOr(VecU a, VecU b)               { return vorrq_u32(a, b); }
+VecU select(VecU mask, VecU a, VecU b)   { return vbslq_u32(mask, a, b); }
+VecU equal(VecU a, VecU b)               { return vceqq_u32(a, b); }
+VecU reverse(VecU v)                     { v = vrev64q_u32(v); return vcombine_u32(vget_high_u32(v), vget_low_u32(v)); }
+VecF toFloat(VecU v)                     { return vcvtq_f32_u32(v); }
+VecU toUint(VecF v)                      { return vcvtq_u32_f32(v); }
+VecF add(VecF a, VecF b)                 { return vaddq_f32(a, b); }
+VecF sub(VecF a, VecF b)                 { return vsubq_f32(a, b); }
+VecF mul(VecF a, VecF b)                 { return vmulq_f32(a, b); }
+VecF div(VecF a, VecF b)                 { return vdivq_f32(a, b); }
+VecF min(VecF a, VecF b)                 { return vminq_f32(a, b); }
+VecF max(VecF a, VecF b)                 { return vmaxq_f32(a, b); }
+template <int N> VecU shiftLeft(VecU v)  { if constexpr (N == 0) return v; else return vshlq_n_u32(v, N); }
+template <int N> VecU shiftRight(VecU v) { if constexpr (N == 0) return v; else return vshrq_n_u32(v, N); }
+// clang-format on
+
+#endif
+
+#ifdef SFML_IMAGE_KERNELS_SIMD
+
+// Number of pixels processed at once
+constexpr std::size_t lanes = 4;
+
+////////////////////////////////////////////////////////////
+std::uint32_t packColor(sf::Color color)
+{
+    // The byte order in memory is RGBA whatever the endianness
+    const std::array<std::uint8_t, 4> bytes = {color.r, color.g, color.b, color.a};
+    std::uint32_t                     value = 0;
+    std::memcpy(&value, bytes.data(), sizeof(value));
+    return value;
+}
+
+
+////////////////////////////////////////////////////////////
+template <int Shift>
+VecF getComponent(VecU pixels)
+{
+    return toFloat(bitAnd(shiftRight<Shift>(pixels), splat(std::uint32_t{0xFF})));
+}
+
+
+////////////////////////////////////////////////////////////
+template <int Shift>
+VecU blendComponent(VecU source, VecU destination, VecF sourceAlpha, VecF destinationWeight, VecF divisor)
+{
+    // All the intermediate values are integers below 2^24 and the quotients are
+    // at most 255, so that truncating the float quotients gives the integer ones
+    const VecF blended = add(mul(getComponent<Shift>(source), sourceAlpha),
+                             mul(getComponent<Shift>(destination), destinationWeight));
+    return shiftLeft<Shift>(toUint(div(blended, divisor)));
+}
+
+
+////////////////////////////////////////////////////////////
+template <int Shift>
+VecU premultiplyComponent(VecU pixels, VecF alpha)
+{
+    return shiftLeft<Shift>(toUint(div(add(mul(getComponent<Shift>(pixels), alpha), splat(127.f)), splat(255.f))));
+}
+
+
+////////////////////////////////////////////////////////////
+template <int Shift>
+VecU unpremultiplyComponent(VecU pixels, VecF halfAlpha, VecF divisor)
+{
+    const VecF unpremultiplied = div(add(mul(getComponent<Shift>(pixels), splat(255.f)), halfAlpha), divisor);
+    return shiftLeft<Shift>(toUint(min(unpremultiplied, splat(255.f))));
+}
+
+#endif
+
+
+////////////////////////////////////////////////////////////
+// Scalar versions, used for the last pixels of the runs
+////////////////////////////////////////////////////////////
+void blendPixel(const std::uint8_t* src, std::uint8_t* dst)
+{
+    // Interpolate RGBA components using the alpha values of the destination and source pixels
+    const std::uint8_t srcAlpha = src[3];
+    const std::uint8_t dstAlpha = dst[3];
+    const auto         outAlpha = static_cast<std::uint8_t>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
+
+    dst[3] = outAlpha;
+
+    if (outAlpha)
+        for (int k = 0; k < 3; k++)
+            dst[k] = static_cast<std::uint8_t>((src[k] * srcAlpha + dst[k] * (outAlpha - srcAlpha)) / outAlpha);
+    else
+        for (int k = 0; k < 3; k++)
+            dst[k] = src[k];
+}
+
+
+////////////////////////////////////////////////////////////
+void premultiplyPixel(std::uint8_t* pixel)
+{
+    for (int k = 0; k < 3; ++k)
+        pixel[k] = static_cast<std::uint8_t>((pixel[k] * pixel[3] + 127) / 255);
+}
+
+
+////////////////////////////////////////////////////////////
+void unpremultiplyPixel(std::uint8_t* pixel)
+{
+    const int alpha = pixel[3];
+    for (int k = 0; k < 3; ++k)
+        pixel[k] = alpha ? static_cast<std::uint8_t>(std::min((pixel[k] * 255 + alpha / 2) / alpha, 255)) : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+// Resampling
+////////////////////////////////////////////////////////////
+
+// Contributions of the source pixels to each destination pixel, along one axis
+struct FilterTaps
+{
+    std::size_t              size{}; // Number of source pixels contributing to each destination pixel
+    std::vector<std::size_t> first;  // First contributing source pixel, for each destination pixel
+    std::vector<float>       weights; // Weights of the contributing pixels, `size` per destination pixel
+};
+
+
+////////////////////////////////////////////////////////////
+double getFilterRadius(sf::Image::ResamplingFilter filter)
+{
+    switch (filter)
+    {
+        case sf::Image::ResamplingFilter::Box:
+            return 0.5;
+        case sf::Image::ResamplingFilter::Bilinear:
+            return 1.0;
+        case sf::Image::ResamplingFilter::Lanczos:
+            return 3.0;
+    }
+
+    return 1.0;
+}
+
+
+////////////////////////////////////////////////////////////
+double evaluateFilter(sf::Image::ResamplingFilter filter, double x)
+{
+    switch (filter)
+    {
+        case sf::Image::ResamplingFilter::Box:
+            return ((x >= -0.5) && (x < 0.5)) ? 1.0 : 0.0;
+        case sf::Image::ResamplingFilter::Bilinear:
+            return std::max(1.0 - std::abs(x), 0.0);
+        case sf::Image::ResamplingFilter::Lanczos:
+        {
+            if (x == 0.0)
+                return 1.0;
+            if (std::abs(x) >= 3.0)
+                return 0.0;
+            const double px = 3.14159265358979323846 * x;
+            return 3.0 * std::sin(px) * std::sin(px / 3.0) / (px * px);
+        }
+    }
+
+    return 0.0;
+}
+
+
+////////////////////////////////////////////////////////////
+FilterTaps computeFilterTaps(std::size_t                 sourceLength,
+                             std::size_t                 destinationLength,
+                             sf::Image::ResamplingFilter filter)
+{
+    // When downscaling, the filter is stretched so that every source pixel contributes
+    const double scale   = static_cast<double>(sourceLength) / static_cast<double>(destinationLength);
+    const double stretch = std::max(scale, 1.0);
+    const double radius  = getFilterRadius(filter) * stretch;
+
+    FilterTaps taps;
+    taps.size = std::min(sourceLength, static_cast<std::size_t>(std::ceil(radius * 2)) + 1);
+    taps.first.resize(destinationLength);
+    taps.weights.resize(destinationLength * taps.size);
+
+    for (std::size_t i = 0; i < destinationLength; ++i)
+    {
+        // Center of the destination pixel, in source coordinates
+        const double center = (static_cast<double>(i) + 0.5) * scale;
+        const auto   first  = static_cast<std::size_t>(std::max(std::floor(center - radius), 0.0));
+        taps.first[i]       = std::min(first, sourceLength - taps.size);
+
+        float* weights = &taps.weights[i * taps.size];
+        double total   = 0;
+        for (std::size_t k = 0; k < taps.size; ++k)
+        {
+            const double position = static_cast<double>(taps.first[i] + k) + 0.5;
+            const double weight   = evaluateFilter(filter, (position - center) / stretch);
+            weights[k]            = static_cast<float>(weight);
+            total += weight;
+        }
+
+        // Normalize the weights, so that the pixels on the edges keep their brightness
+        if (total > 0)
+        {
+            const auto floatTotal = static_cast<float>(total);
+            for (std::size_t k = 0; k < taps.size; ++k)
+                weights[k] /= floatTotal;
+        }
+        else
+        {
+            weights[std::min(static_cast<std::size_t>(center) - taps.first[i], taps.size - 1)] = 1.f;
+        }
+    }
+
+    return taps;
+}
+
+
+////////////////////////////////////////////////////////////
+void resampleRows(const std::uint8_t* source,
+                  std::size_t         sourceWidth,
+                  float*              rows,
+                  std::size_t         destinationWidth,
+                  const FilterTaps&   taps,
+                  std::size_t         begin,
+                  std::size_t         end)
+{
+    std::vector<float> premultiplied(sourceWidth * 4);
+
+    for (std::size_t y = begin; y < end; ++y)
+    {
+        const std::uint8_t* src = source + y * sourceWidth * 4;
+        for (std::size_t x = 0; x < sourceWidth; ++x)
+        {
+            const float alpha = src[x * 4 + 3];
+            for (std::size_t c = 0; c < 3; ++c)
+                premultiplied[x * 4 + c] = src[x * 4 + c] * alpha / 255.f;
+            premultiplied[x * 4 + 3] = alpha;
+        }
+
+        float* row = rows + y * destinationWidth * 4;
+        for (std::size_t x = 0; x < destinationWidth; ++x)
+        {
+            const float* weights = &taps.weights[x * taps.size];
+            const float* pixels  = &premultiplied[taps.first[x] * 4];
+
+            std::array<float, 4> sum{};
+            for (std::size_t k = 0; k < taps.size; ++k)
+                for (std::size_t c = 0; c < 4; ++c)
+                    sum[c] += pixels[k * 4 + c] * weights[k];
+
+            std::copy(sum.begin(), sum.end(), row + x * 4);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void resampleColumns(const float*      rows,
+                     std::uint8_t*     destination,
+                     std::size_t       destinationWidth,
+                     const FilterTaps& taps,
+                     std::size_t       begin,
+                     std::size_t       end)
+{
+    const std::size_t  rowLength = destinationWidth * 4;
+    std::vector<float> sum(rowLength);
+
+    for (std::size_t y = begin; y < end; ++y)
+    {
+        std::fill(sum.begin(), sum.end(), 0.f);
+        for (std::size_t k = 0; k < taps.size; ++k)
+        {
+            const float  weight = taps.weights[y * taps.size + k];
+            const float* row    = rows + (taps.first[y] + k) * rowLength;
+            for (std::size_t i = 0; i < rowLength; ++i)
+                sum[i] += row[i] * weight;
+        }
+
+        std::uint8_t* dst = destination + y * rowLength;
+        for (std::size_t x = 0; x < destinationWidth; ++x)
+        {
+            // Components may overshoot with the Lanczos filter
+            const float alpha = std::clamp(sum[x * 4 + 3], 0.f, 255.f);
+            const float scale = (alpha >= 0.5f) ? 255.f / alpha : 0.f;
+            for (std::size_t c = 0; c < 3; ++c)
+                dst[x * 4 + c] = static_cast<std::uint8_t>(std::clamp(sum[x * 4 + c] * scale, 0.f, 255.f) + 0.5f);
+            dst[x * 4 + 3] = static_cast<std::uint8_t>(alpha + 0.5f);
+        }
+    }
+}
+} // namespace ImageKernelsImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void blendPixels(const std::uint8_t* source, std::uint8_t* destination, std::size_t count)
+{
+    using namespace ImageKernelsImpl;
+
+    std::size_t i = 0;
+
+#ifdef SFML_IMAGE_KERNELS_SIMD
+    const VecF one      = splat(1.f);
+    const VecF maxAlpha = splat(255.f);
+    const VecU zero     = splat(std::uint32_t{0});
+
+    for (; i + lanes <= count; i += lanes)
+    {
+        const VecU src = load(source + i * 4);
+        const VecU dst = load(destination + i * 4);
+
+        const VecF srcAlpha = toFloat(shiftRight<24>(src));
+        const VecF dstAlpha = toFloat(shiftRight<24>(dst));
+        const VecF outAlpha = sub(add(srcAlpha, dstAlpha), toFloat(toUint(div(mul(srcAlpha, dstAlpha), maxAlpha))));
+        const VecF dstWeight = sub(outAlpha, srcAlpha);
+        const VecF divisor   = max(outAlpha, one);
+
+        const VecU outAlphaBits = toUint(outAlpha);
+        VecU       result       = shiftLeft<24>(outAlphaBits);
+        result = bitOr(result, blendComponent<0>(src, dst, srcAlpha, dstWeight, divisor));
+        result = bitOr(result, blendComponent<8>(src, dst, srcAlpha, dstWeight, divisor));
+        result = bitOr(result, blendComponent<16>(src, dst, srcAlpha, dstWeight, divisor));
+
+        // Fully transparent results take the colors of the source (whose alpha is 0 too)
+        store(destination + i * 4, select(equal(outAlphaBits, zero), src, result));
+    }
+#endif
+
+    for (; i < count; ++i)
+        blendPixel(source + i * 4, destination + i * 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void maskPixels(std::uint8_t* pixels, std::size_t count, Color color, std::uint8_t alpha)
+{
+    using namespace ImageKernelsImpl;
+
+    std::size_t i = 0;
+
+#ifdef SFML_IMAGE_KERNELS_SIMD
+    const VecU key       = splat(packColor(color));
+    const VecU alphaMask = splat(packColor(Color(0, 0, 0, 255)));
+    const VecU newAlpha  = splat(packColor(Color(0, 0, 0, alpha)));
+
+    for (; i + lanes <= count; i += lanes)
+    {
+        const VecU value = load(pixels + i * 4);
+        const VecU mask  = bitAnd(equal(value, key), alphaMask);
+        store(pixels + i * 4, select(mask, newAlpha, value));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        std::uint8_t* pixel = pixels + i * 4;
+        if ((pixel[0] == color.r) && (pixel[1] == color.g) && (pixel[2] == color.b) && (pixel[3] == color.a))
+            pixel[3] = alpha;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void reversePixels(std::uint8_t* pixels, std::size_t count)
+{
+    using namespace ImageKernelsImpl;
+
+    std::uint8_t* left  = pixels;
+    std::uint8_t* right = pixels + count * 4;
+
+#ifdef SFML_IMAGE_KERNELS_SIMD
+    // Exchange blocks of pixels from both ends, reversing them
+    while (right - left >= static_cast<std::ptrdiff_t>(lanes * 8))
+    {
+        right -= lanes * 4;
+        const VecU leftBlock  = load(left);
+        const VecU rightBlock = load(right);
+        store(left, reverse(rightBlock));
+        store(right, reverse(leftBlock));
+        left += lanes * 4;
+    }
+#endif
+
+    while (right - left >= 8)
+    {
+        right -= 4;
+        std::swap_ranges(left, left + 4, right);
+        left += 4;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void swapPixels(std::uint8_t* first, std::uint8_t* second, std::size_t count)
+{
+    using namespace ImageKernelsImpl;
+
+    std::size_t i = 0;
+
+#ifdef SFML_IMAGE_KERNELS_SIMD
+    for (; i + lanes <= count; i += lanes)
+    {
+        const VecU a = load(first + i * 4);
+        const VecU b = load(second + i * 4);
+        store(first + i * 4, b);
+        store(second + i * 4, a);
+    }
+#endif
+
+    std::swap_ranges(first + i * 4, first + count * 4, second + i * 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void fillPixels(std::uint8_t* pixels, std::size_t count, Color color)
+{
+    using namespace ImageKernelsImpl;
+
+    std::size_t i = 0;
+
+#ifdef SFML_IMAGE_KERNELS_SIMD
+    const VecU value = splat(packColor(color));
+    for (; i + lanes <= count; i += lanes)
+        store(pixels + i * 4, value);
+#endif
+
+    for (; i < count; ++i)
+    {
+        std::uint8_t* pixel = pixels + i * 4;
+        pixel[0]            = color.r;
+        pixel[1]            = color.g;
+        pixel[2]            = color.b;
+        pixel[3]            = color.a;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void premultiplyPixels(std::uint8_t* pixels, std::size_t count)
+{
+    using namespace ImageKernelsImpl;
+
+    std::size_t i = 0;
+
+#ifdef SFML_IMAGE_KERNELS_SIMD
+    const VecU alphaMask = splat(packColor(Color(0, 0, 0, 255)));
+
+    for (; i + lanes <= count; i += lanes)
+    {
+        const VecU value = load(pixels + i * 4);
+        const VecF alpha = toFloat(shiftRight<24>(value));
+
+        VecU result = bitAnd(value, alphaMask);
+        result      = bitOr(result, premultiplyComponent<0>(value, alpha));
+        result      = bitOr(result, premultiplyComponent<8>(value, alpha));
+        result      = bitOr(result, premultiplyComponent<16>(value, alpha));
+        store(pixels + i * 4, result);
+    }
+#endif
+
+    for (; i < count; ++i)
+        premultiplyPixel(pixels + i * 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void unpremultiplyPixels(std::uint8_t* pixels, std::size_t count)
+{
+    using namespace ImageKernelsImpl;
+
+    std::size_t i = 0;
+
+#ifdef SFML_IMAGE_KERNELS_SIMD
+    const VecU alphaMask = splat(packColor(Color(0, 0, 0, 255)));
+    const VecU zero      = splat(std::uint32_t{0});
+
+    for (; i + lanes <= count; i += lanes)
+    {
+        const VecU value     = load(pixels + i * 4);
+        const VecU alphaBits = shiftRight<24>(value);
+        const VecF halfAlpha = toFloat(shiftRight<1>(alphaBits));
+        const VecF divisor   = max(toFloat(alphaBits), splat(1.f));
+
+        VecU result = bitAnd(value, alphaMask);
+        result      = bitOr(result, unpremultiplyComponent<0>(value, halfAlpha, divisor));
+        result      = bitOr(result, unpremultiplyComponent<8>(value, halfAlpha, divisor));
+        result      = bitOr(result, unpremultiplyComponent<16>(value, halfAlpha, divisor));
+
+        // Fully transparent pixels have no color
+        store(pixels + i * 4, select(equal(alphaBits, zero), zero, result));
+    }
+#endif
+
+    for (; i < count; ++i)
+        unpremultiplyPixel(pixels + i * 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void resamplePixels(const std::uint8_t*     source,
+                    Vector2u                sourceSize,
+                    std::uint8_t*           destination,
+                    Vector2u                destinationSize,
+                    Image::ResamplingFilter filter)
+{
+    using namespace ImageKernelsImpl;
+
+    const FilterTaps horizontalTaps = computeFilterTaps(sourceSize.x, destinationSize.x, filter);
+    const FilterTaps verticalTaps   = computeFilterTaps(sourceSize.y, destinationSize.y, filter);
+
+    // First pass: resample the rows, to premultiplied float components
+    std::vector<float> rows(std::size_t{destinationSize.x} * sourceSize.y * 4);
+    forEachRowRange(sourceSize.y,
+                    sourceSize.x + destinationSize.x * horizontalTaps.size,
+                    [&](std::size_t begin, std::size_t end)
+                    {
+                        resampleRows(source, sourceSize.x, rows.data(), destinationSize.x, horizontalTaps, begin, end);
+                    });
+
+    // Second pass: resample the columns and go back to 8-bit straight alpha
+    forEachRowRange(destinationSize.y,
+                    destinationSize.x * verticalTaps.size,
+                    [&](std::size_t begin, std::size_t end)
+                    { resampleColumns(rows.data(), destination, destinationSize.x, verticalTaps, begin, end); });
+}
+
+
+////////////////////////////////////////////////////////////
+void forEachRowRange(std::size_t                                         rowCount,
+                     std::size_t                                         rowLength,
+                     const std::function<void(std::size_t, std::size_t)>& function)
+{
+    // Threads are created for each call, they only pay off when each one has enough pixels
+    // to process for the creation and join (tens of microseconds) to be negligible
+    constexpr std::size_t minPixelsPerThread = 1024 * 1024;
+
+    const std::size_t threadCount = std::min({std::size_t{std::max(std::thread::hardware_concurrency(), 1u)},
+                                              rowCount,
+                                              rowCount * rowLength / minPixelsPerThread});
+
+    if (threadCount <= 1)
+    {
+        function(0, rowCount);
+        return;
+    }
+
+    const auto getRangeStart = [rowCount, threadCount](std::size_t index) { return rowCount * index / threadCount; };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (std::size_t i = 1; i < threadCount; ++i)
+        threads.emplace_back(function, getRangeStart(i), getRangeStart(i + 1));
+
+    function(0, getRangeStart(1));
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+} // namespace sf::priv
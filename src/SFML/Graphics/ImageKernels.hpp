@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <functional>
+
+#include <cstddef>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+// Pixel kernels used by sf::Image
+//
+// All the kernels work on runs of RGBA pixels. They use SSE2
+// on x86 and NEON on 64-bit ARM, with a scalar fallback for
+// the other architectures and the end of the runs. The results
+// are identical whatever the implementation.
+////////////////////////////////////////////////////////////
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Blend pixels over others with the over operator
+///
+/// \param source      Pixels to blend
+/// \param destination Pixels to blend onto
+/// \param count       Number of pixels
+///
+////////////////////////////////////////////////////////////
+void blendPixels(const std::uint8_t* source, std::uint8_t* destination, std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Change the alpha of the pixels matching a color
+///
+/// \param pixels Pixels to modify
+/// \param count  Number of pixels
+/// \param color  Color to match, alpha included
+/// \param alpha  Alpha to assign to matching pixels
+///
+////////////////////////////////////////////////////////////
+void maskPixels(std::uint8_t* pixels, std::size_t count, Color color, std::uint8_t alpha);
+
+////////////////////////////////////////////////////////////
+/// \brief Reverse the order of pixels
+///
+/// \param pixels Pixels to reverse
+/// \param count  Number of pixels
+///
+////////////////////////////////////////////////////////////
+void reversePixels(std::uint8_t* pixels, std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Exchange two runs of pixels
+///
+/// \param first  First run of pixels
+/// \param second Second run of pixels, must not overlap the first one
+/// \param count  Number of pixels of each run
+///
+////////////////////////////////////////////////////////////
+void swapPixels(std::uint8_t* first, std::uint8_t* second, std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Set pixels to a color
+///
+/// \param pixels Pixels to fill
+/// \param count  Number of pixels
+/// \param color  Color to assign
+///
+////////////////////////////////////////////////////////////
+void fillPixels(std::uint8_t* pixels, std::size_t count, Color color);
+
+////////////////////////////////////////////////////////////
+/// \brief Multiply the color components of pixels by their alpha
+///
+/// \param pixels Pixels to modify
+/// \param count  Number of pixels
+///
+////////////////////////////////////////////////////////////
+void premultiplyPixels(std::uint8_t* pixels, std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Divide the color components of pixels by their alpha
+///
+/// \param pixels Pixels to modify
+/// \param count  Number of pixels
+///
+////////////////////////////////////////////////////////////
+void unpremultiplyPixels(std::uint8_t* pixels, std::size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Resample pixels to another size
+///
+/// The filter is applied separately on both axes, to colors
+/// premultiplied by their alpha.
+///
+/// \param source          Source pixels
+/// \param sourceSize      Size of the source, in pixels
+/// \param destination     Destination pixels
+/// \param destinationSize Size of the destination, in pixels
+/// \param filter          Filter used to compute the destination pixels
+///
+////////////////////////////////////////////////////////////
+void resamplePixels(const std::uint8_t*     source,
+                    Vector2u                sourceSize,
+                    std::uint8_t*           destination,
+                    Vector2u                destinationSize,
+                    Image::ResamplingFilter filter);
+
+////////////////////////////////////////////////////////////
+/// \brief Process the rows of an image, on several threads for large images
+///
+/// The rows are split in contiguous ranges, one per thread.
+/// The threads are created for each call, so images of less
+/// than a few megapixels are processed on the calling thread.
+///
+/// \param rowCount  Number of rows
+/// \param rowLength Number of pixels of each row
+/// \param function  Function processing the rows in [begin, end)
+///
+////////////////////////////////////////////////////////////
+void forEachRowRange(std::size_t                                         rowCount,
+                     std::size_t                                         rowLength,
+                     const std::function<void(std::size_t, std::size_t)>& function);
+
+} // namespace sf::priv
@@ -0,0 +1,301 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <ostream>
+#include <utility>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace IndexBufferImpl
+{
+GLenum usageToGlEnum(sf::IndexBuffer::Usage usage)
+{
+    switch (usage)
+    {
+        case sf::IndexBuffer::Usage::Static:
+            return GLEXT_GL_STATIC_DRAW;
+        case sf::IndexBuffer::Usage::Dynamic:
+            return GLEXT_GL_DYNAMIC_DRAW;
+        default:
+            return GLEXT_GL_STREAM_DRAW;
+    }
+}
+
+std::size_t getIndexSize(sf::IndexBuffer::Format format)
+{
+    return format == sf::IndexBuffer::Format::UInt32 ? sizeof(std::uint32_t) : sizeof(std::uint16_t);
+}
+} // namespace IndexBufferImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+IndexBuffer::IndexBuffer(Usage usage) : m_usage(usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::~IndexBuffer()
+{
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::IndexBuffer(IndexBuffer&& source) noexcept :
+    m_buffer(std::exchange(source.m_buffer, 0u)),
+    m_size(std::exchange(source.m_size, 0u)),
+    m_format(source.m_format),
+    m_usage(source.m_usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer& IndexBuffer::operator=(IndexBuffer&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+        return *this;
+
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+
+    m_buffer = std::exchange(right.m_buffer, 0u);
+    m_size   = std::exchange(right.m_size, 0u);
+    m_format = right.m_format;
+    m_usage  = right.m_usage;
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::create(std::size_t indexCount, Format format)
+{
+    if (!isAvailable())
+        return false;
+
+    if ((format == Format::UInt32) && !isUInt32Available())
+    {
+        err() << "Could not create index buffer, 32-bit indices are not supported" << std::endl;
+        return false;
+    }
+
+    const TransientContextLock contextLock;
+
+    if (!m_buffer)
+        glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not create index buffer, generation failed" << std::endl;
+        return false;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_buffer));
+    glCheck(GLEXT_glBufferData(GLEXT_GL_ELEMENT_ARRAY_BUFFER,
+                               static_cast<GLsizeiptrARB>(IndexBufferImpl::getIndexSize(format) * indexCount),
+                               nullptr,
+                               IndexBufferImpl::usageToGlEnum(m_usage)));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0));
+
+    m_size   = indexCount;
+    m_format = format;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t IndexBuffer::getIndexCount() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::Format IndexBuffer::getFormat() const
+{
+    return m_format;
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::update(const std::uint16_t* indices, std::size_t indexCount, std::size_t offset)
+{
+    if (m_format != Format::UInt16)
+        return false;
+
+    return write(indices, indexCount, offset);
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::update(const std::uint32_t* indices, std::size_t indexCount, std::size_t offset)
+{
+    if (m_format != Format::UInt32)
+        return false;
+
+    return write(indices, indexCount, offset);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int IndexBuffer::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void IndexBuffer::setUsage(Usage usage)
+{
+    m_usage = usage;
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::Usage IndexBuffer::getUsage() const
+{
+    return m_usage;
+}
+
+
+////////////////////////////////////////////////////////////
+void IndexBuffer::bind(const IndexBuffer* indexBuffer)
+{
+    if (!isAvailable())
+        return;
+
+    const TransientContextLock lock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, indexBuffer ? indexBuffer->m_buffer : 0));
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::isAvailable()
+{
+    return VertexBuffer::isAvailable();
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::isUInt32Available()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_element_index_uint != 0;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::isPrimitiveRestartAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_primitive_restart != 0;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::write(const void* indices, std::size_t indexCount, std::size_t offset)
+{
+    // Sanity checks
+    if (!m_buffer)
+        return false;
+
+    if (!indices)
+        return false;
+
+    if (offset && (offset + indexCount > m_size))
+        return false;
+
+    const std::size_t indexSize = IndexBufferImpl::getIndexSize(m_format);
+
+    const TransientContextLock contextLock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_buffer));
+
+    // Check if we need to resize or orphan the buffer
+    if (indexCount >= m_size)
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ELEMENT_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(indexSize * indexCount),
+                                   nullptr,
+                                   IndexBufferImpl::usageToGlEnum(m_usage)));
+
+        m_size = indexCount;
+    }
+
+    glCheck(GLEXT_glBufferSubData(GLEXT_GL_ELEMENT_ARRAY_BUFFER,
+                                  static_cast<GLintptrARB>(indexSize * offset),
+                                  static_cast<GLsizeiptrARB>(indexSize * indexCount),
+                                  indices));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0));
+
+    return true;
+}
+
+} // namespace sf
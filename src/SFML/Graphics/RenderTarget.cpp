@@ -28,9 +28,12 @@
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/ShaderPipeline.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexBatching.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
 
 #include <SFML/Window/Context.hpp>
@@ -39,9 +42,13 @@
 #include <SFML/System/Err.hpp>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <ostream>
 #include <unordered_map>
+#include <vector>
 
 #include <cassert>
 #include <cmath>
@@ -53,36 +60,73 @@ namespace
 // A nested named namespace is used here to allow unity builds of SFML.
 namespace RenderTargetImpl
 {
-// Mutex to protect ID generation and our context-RenderTarget-map
-std::recursive_mutex& getMutex()
+// Thread-safe unique identifier, used for identifying RenderTargets
+// when tracking the currently active RenderTarget within a given context
+std::uint64_t getUniqueId() noexcept
 {
-    static std::recursive_mutex mutex;
-    return mutex;
-}
+    static std::atomic<std::uint64_t> id(1); // start at 1, zero is "no RenderTarget"
 
-// Unique identifier, used for identifying RenderTargets when
-// tracking the currently active RenderTarget within a given context
-std::uint64_t getUniqueId()
-{
-    const std::lock_guard lock(getMutex());
-    static std::uint64_t  id = 1; // start at 1, zero is "no RenderTarget"
-    return id++;
+    return id.fetch_add(1);
 }
 
-// Map to help us detect whether a different RenderTarget
-// has been activated within a single context
-using ContextRenderTargetMap = std::unordered_map<std::uint64_t, std::uint64_t>;
-ContextRenderTargetMap& getContextRenderTargetMap()
+// ID of the RenderTarget active in a context, zero if none
+using ActiveRenderTargetSlot = std::atomic<std::uint64_t>;
+
+// Get the slot tracking the active RenderTarget of the current context
+// A context is only ever current on one thread at a time, so the slot
+// itself is never contended; the mutex is only taken the first time
+// a thread sees a given context, to look it up in the shared registry
+// Slots are never removed so that the cached pointers stay valid,
+// their number is bounded by the number of contexts ever created
+ActiveRenderTargetSlot& getActiveRenderTargetSlot()
 {
-    static ContextRenderTargetMap contextRenderTargetMap;
-    return contextRenderTargetMap;
+    struct SlotCache
+    {
+        std::uint64_t           contextId{};
+        ActiveRenderTargetSlot* slot{};
+    };
+    thread_local SlotCache slotCache;
+
+    const std::uint64_t contextId = sf::Context::getActiveContextId();
+
+    if (!slotCache.slot || (slotCache.contextId != contextId))
+    {
+        struct SlotRegistry
+        {
+            std::mutex                                                 mutex;
+            std::unordered_map<std::uint64_t, ActiveRenderTargetSlot> slots;
+        };
+        static SlotRegistry   slotRegistry;
+        const std::lock_guard lock(slotRegistry.mutex);
+
+        // Nodes of an unordered_map are never relocated, so the pointer remains valid
+        slotCache.contextId = contextId;
+        slotCache.slot      = &slotRegistry.slots[contextId];
+    }
+
+    return *slotCache.slot;
 }
 
 // Check if a RenderTarget with the given ID is active in the current context
 bool isActive(std::uint64_t id)
 {
-    const auto it = getContextRenderTargetMap().find(sf::Context::getActiveContextId());
-    return (it != getContextRenderTargetMap().end()) && (it->second == id);
+    return getActiveRenderTargetSlot().load(std::memory_order_relaxed) == id;
+}
+
+// Check if bounds in normalized device coordinates overlap the visible area, which spans [-1, 1] on both axes
+bool intersectsClipArea(const sf::FloatRect& bounds)
+{
+    // Inclusive comparisons keep degenerate bounds, like the ones of a horizontal line
+    return (bounds.position.x <= 1.f) && (bounds.position.x + bounds.size.x >= -1.f) && (bounds.position.y <= 1.f) &&
+           (bounds.position.y + bounds.size.y >= -1.f);
+}
+
+// Convert an sf::PrimitiveType to the corresponding OpenGL constant.
+GLenum primitiveTypeToGlConstant(sf::PrimitiveType type)
+{
+    static constexpr sf::priv::EnumArray<sf::PrimitiveType, GLenum, 6> modes =
+        {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
+    return modes[type];
 }
 
 // Convert an sf::BlendMode::Factor constant to the corresponding OpenGL constant.
@@ -197,9 +241,112 @@ std::uint32_t stencilFunctionToGlConstant(sf::StencilComparison comparison)
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+struct RenderTarget::GpuTimer
+{
+    // Number of frames that can be in flight before timing results are read back
+    static constexpr std::size_t frameCount = 3;
+
+    ////////////////////////////////////////////////////////////
+    GpuTimer() : contextId(Context::getActiveContextId())
+    {
+        glCheck(GLEXT_glGenQueries(static_cast<GLsizei>(queries.size()), queries.data()));
+    }
+
+    ////////////////////////////////////////////////////////////
+    ~GpuTimer()
+    {
+        // Query objects are not shared between contexts, they can only be deleted
+        // from the context that created them (otherwise they die with that context)
+        if (Context::getActiveContextId() == contextId)
+            glCheck(GLEXT_glDeleteQueries(static_cast<GLsizei>(queries.size()), queries.data()));
+    }
+
+    ////////////////////////////////////////////////////////////
+    GpuTimer(const GpuTimer&)            = delete;
+    GpuTimer& operator=(const GpuTimer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    void beginFrame()
+    {
+        // Skip timing this frame if the ring is full or if we are in a foreign context
+        if (frameStarted || pending[current] || (Context::getActiveContextId() != contextId))
+            return;
+
+        glCheck(GLEXT_glQueryCounter(queries[current * 2], GLEXT_GL_TIMESTAMP));
+        frameStarted = true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void endFrame()
+    {
+        if (Context::getActiveContextId() != contextId)
+            return;
+
+        if (frameStarted)
+        {
+            glCheck(GLEXT_glQueryCounter(queries[current * 2 + 1], GLEXT_GL_TIMESTAMP));
+            pending[current] = true;
+            current          = (current + 1) % frameCount;
+            frameStarted     = false;
+        }
+
+        // Collect the results that are already available, oldest first, without ever waiting for the GPU
+        for (std::size_t i = 0; i < frameCount; ++i)
+        {
+            const std::size_t frame = (current + i) % frameCount;
+            if (!pending[frame])
+                continue;
+
+            GLint available = GL_FALSE;
+            glCheck(GLEXT_glGetQueryObjectiv(queries[frame * 2 + 1], GLEXT_GL_QUERY_RESULT_AVAILABLE, &available));
+            if (available == GL_FALSE)
+                break;
+
+            GLuint64 begin = 0;
+            GLuint64 end   = 0;
+            glCheck(GLEXT_glGetQueryObjectui64v(queries[frame * 2], GLEXT_GL_QUERY_RESULT, &begin));
+            glCheck(GLEXT_glGetQueryObjectui64v(queries[frame * 2 + 1], GLEXT_GL_QUERY_RESULT, &end));
+
+            lastGpuTime    = microseconds(static_cast<std::int64_t>((end - begin) / 1000));
+            pending[frame] = false;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::uint64_t                      contextId;      //!< Context owning the query objects
+    std::array<GLuint, frameCount * 2> queries{};      //!< Begin/end timestamp queries of each frame
+    std::array<bool, frameCount>       pending{};      //!< Which frames are waiting for their results
+    std::size_t                        current{};      //!< Frame being recorded
+    bool                               frameStarted{}; //!< Was the begin timestamp of the current frame issued?
+    Time                               lastGpuTime;    //!< GPU time of the most recent frame with available results
+};
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::RenderTarget() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::~RenderTarget() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::RenderTarget(RenderTarget&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget& RenderTarget::operator=(RenderTarget&&) noexcept = default;
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(Color color)
 {
+    // Pending draw calls were issued before the clear
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -209,6 +356,9 @@ void RenderTarget::clear(Color color)
         if (!m_cache.enable || m_cache.viewChanged)
             applyCurrentView();
 
+        if (m_gpuTimer)
+            m_gpuTimer->beginFrame();
+
         glCheck(glClearColor(color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f));
         glCheck(glClear(GL_COLOR_BUFFER_BIT));
     }
@@ -218,6 +368,9 @@ void RenderTarget::clear(Color color)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clearStencil(StencilValue stencilValue)
 {
+    // Pending draw calls were issued before the clear
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -227,6 +380,9 @@ void RenderTarget::clearStencil(StencilValue stencilValue)
         if (!m_cache.enable || m_cache.viewChanged)
             applyCurrentView();
 
+        if (m_gpuTimer)
+            m_gpuTimer->beginFrame();
+
         glCheck(glClearStencil(static_cast<int>(stencilValue.value)));
         glCheck(glClear(GL_STENCIL_BUFFER_BIT));
     }
@@ -236,6 +392,9 @@ void RenderTarget::clearStencil(StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(Color color, StencilValue stencilValue)
 {
+    // Pending draw calls were issued before the clear
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -245,6 +404,9 @@ void RenderTarget::clear(Color color, StencilValue stencilValue)
         if (!m_cache.enable || m_cache.viewChanged)
             applyCurrentView();
 
+        if (m_gpuTimer)
+            m_gpuTimer->beginFrame();
+
         glCheck(glClearColor(color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f));
         glCheck(glClearStencil(static_cast<int>(stencilValue.value)));
         glCheck(glClear(GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT));
@@ -255,6 +417,9 @@ void RenderTarget::clear(Color color, StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::setView(const View& view)
 {
+    // Pending draw calls must be rendered with the previous view
+    flush();
+
     m_view              = view;
     m_cache.viewChanged = true;
 }
@@ -352,65 +517,16 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
     if (!vertices || (vertexCount == 0))
         return;
 
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
-    {
-        // Check if the vertex count is low enough so that we can pre-transform them
-        const bool useVertexCache = (vertexCount <= m_cache.vertexCache.size());
-
-        if (useVertexCache)
-        {
-            // Pre-transform the vertices and store them into the vertex cache
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                Vertex& vertex   = m_cache.vertexCache[i];
-                vertex.position  = states.transform * vertices[i].position;
-                vertex.color     = vertices[i].color;
-                vertex.texCoords = vertices[i].texCoords;
-            }
-        }
-
-        setupDraw(useVertexCache, states);
-
-        // Check if texture coordinates array is needed, and update client state accordingly
-        const bool enableTexCoordsArray = (states.texture || states.shader);
-        if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
-        {
-            if (enableTexCoordsArray)
-                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
-            else
-                glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
-        }
-
-        // If we switch between non-cache and cache mode or enable texture
-        // coordinates we need to set up the pointers to the vertices' components
-        if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
-        {
-            const auto* data = reinterpret_cast<const std::byte*>(vertices);
-
-            // If we pre-transform the vertices, we must use our internal vertex cache
-            if (useVertexCache)
-                data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
-
-            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
-            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
-            if (enableTexCoordsArray)
-                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
-        else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
-        {
-            // If we enter this block, we are already using our internal vertex cache
-            const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+    if (cullVertices(vertices, vertexCount, states))
+        return;
 
-            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
+    if (batchVertices(vertices, vertexCount, type, states))
+        return;
 
-        drawPrimitives(type, 0, vertexCount);
-        cleanupDraw(states);
+    // Draw calls that cannot be batched must not overtake the pending batch
+    flush();
 
-        // Update the cache
-        m_cache.useVertexCache        = useVertexCache;
-        m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
-    }
+    drawVertices(vertices, vertexCount, type, states);
 }
 
 
@@ -442,32 +558,109 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
     if (!vertexCount || !vertexBuffer.getNativeHandle())
         return;
 
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
-    {
-        setupDraw(false, states);
+    // Draw calls that cannot be batched must not overtake the pending batch
+    flush();
 
-        // Bind vertex buffer
-        VertexBuffer::bind(&vertexBuffer);
+    drawVertexBuffer(vertexBuffer, firstVertex, vertexCount, states);
+}
 
-        // Always enable texture coordinates
-        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
-            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
 
-        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
-        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
-        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex*        vertices,
+                        std::size_t          vertexCount,
+                        const std::uint16_t* indices,
+                        std::size_t          indexCount,
+                        PrimitiveType        type,
+                        const RenderStates&  states)
+{
+    // Nothing to draw?
+    if (!vertices || !vertexCount || !indices || !indexCount)
+        return;
 
-        drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
+    if (cullVertices(vertices, vertexCount, states))
+        return;
 
-        // Unbind vertex buffer
-        VertexBuffer::bind(nullptr);
+    // Indexed draws are never batched, they must not overtake the pending batch
+    flush();
 
-        cleanupDraw(states);
+    const Indices clientIndices{indices, indexCount, false, 0};
+    drawVertices(vertices, vertexCount, type, states, &clientIndices);
+}
 
-        // Update the cache
-        m_cache.useVertexCache        = false;
-        m_cache.texCoordsArrayEnabled = true;
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex*        vertices,
+                        std::size_t          vertexCount,
+                        const std::uint32_t* indices,
+                        std::size_t          indexCount,
+                        PrimitiveType        type,
+                        const RenderStates&  states)
+{
+    // Nothing to draw?
+    if (!vertices || !vertexCount || !indices || !indexCount)
+        return;
+
+    if (cullVertices(vertices, vertexCount, states))
+        return;
+
+    // 32-bit indices not supported?
+    if (!IndexBuffer::isUInt32Available())
+    {
+        err() << "32-bit indices are not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Indexed draws are never batched, they must not overtake the pending batch
+    flush();
+
+    const Indices clientIndices{indices, indexCount, true, 0};
+    drawVertices(vertices, vertexCount, type, states, &clientIndices);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const IndexBuffer& indexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, indexBuffer, 0, indexBuffer.getIndexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer,
+                        const IndexBuffer&  indexBuffer,
+                        std::size_t         firstIndex,
+                        std::size_t         indexCount,
+                        const RenderStates& states)
+{
+    // VertexBuffer not supported?
+    if (!VertexBuffer::isAvailable())
+    {
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
     }
+
+    // Sanity check
+    if (firstIndex > indexBuffer.getIndexCount())
+        return;
+
+    // Clamp indexCount to something that makes sense
+    indexCount = std::min(indexCount, indexBuffer.getIndexCount() - firstIndex);
+
+    // Nothing to draw?
+    if (!indexCount || !vertexBuffer.getVertexCount() || !vertexBuffer.getNativeHandle() ||
+        !indexBuffer.getNativeHandle())
+        return;
+
+    // Draw calls that cannot be batched must not overtake the pending batch
+    flush();
+
+    const bool        wide      = indexBuffer.getFormat() == IndexBuffer::Format::UInt32;
+    const std::size_t indexSize = wide ? sizeof(std::uint32_t) : sizeof(std::uint16_t);
+    const Indices     bufferIndices{reinterpret_cast<const void*>(firstIndex * indexSize),
+                                    indexCount,
+                                    wide,
+                                    indexBuffer.getNativeHandle()};
+    drawVertexBuffer(vertexBuffer, 0, vertexBuffer.getVertexCount(), states, &bufferIndices);
 }
 
 
@@ -482,35 +675,27 @@ bool RenderTarget::isSrgb() const
 ////////////////////////////////////////////////////////////
 bool RenderTarget::setActive(bool active)
 {
-    // Mark this RenderTarget as active or no longer active in the tracking map
-    const std::lock_guard lock(RenderTargetImpl::getMutex());
-
-    const std::uint64_t contextId = Context::getActiveContextId();
-
-    using RenderTargetImpl::getContextRenderTargetMap;
-    auto&      contextRenderTargetMap = getContextRenderTargetMap();
-    const auto it                     = contextRenderTargetMap.find(contextId);
+    // Mark this RenderTarget as active or no longer active in the current context
+    // The slot is only accessed from the thread the context is current on, so no lock is needed
+    auto& activeRenderTarget = RenderTargetImpl::getActiveRenderTargetSlot();
 
     if (active)
     {
-        if (it == contextRenderTargetMap.end())
-        {
-            contextRenderTargetMap[contextId] = m_id;
+        const std::uint64_t previousId = activeRenderTarget.exchange(m_id, std::memory_order_relaxed);
 
+        if (previousId == 0)
+        {
             m_cache.glStatesSet = false;
             m_cache.enable      = false;
         }
-        else if (it->second != m_id)
+        else if (previousId != m_id)
         {
-            it->second = m_id;
-
             m_cache.enable = false;
         }
     }
     else
     {
-        if (it != contextRenderTargetMap.end())
-            contextRenderTargetMap.erase(it);
+        activeRenderTarget.store(0, std::memory_order_relaxed);
 
         m_cache.enable = false;
     }
@@ -522,6 +707,9 @@ bool RenderTarget::setActive(bool active)
 ////////////////////////////////////////////////////////////
 void RenderTarget::pushGLStates()
 {
+    // Pending draw calls must be rendered before the user's OpenGL states are touched
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
 #ifdef SFML_DEBUG
@@ -534,16 +722,20 @@ void RenderTarget::pushGLStates()
         }
 #endif
 
+        // The shader pipeline has no attribute or matrix stacks to save the states to
+        if (!m_shaderPipelineEnabled)
+        {
 #ifndef SFML_OPENGL_ES
-        glCheck(glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS));
-        glCheck(glPushAttrib(GL_ALL_ATTRIB_BITS));
+            glCheck(glPushClientAttrib(GL_CLIENT_ALL_ATTRIB_BITS));
+            glCheck(glPushAttrib(GL_ALL_ATTRIB_BITS));
 #endif
-        glCheck(glMatrixMode(GL_MODELVIEW));
-        glCheck(glPushMatrix());
-        glCheck(glMatrixMode(GL_PROJECTION));
-        glCheck(glPushMatrix());
-        glCheck(glMatrixMode(GL_TEXTURE));
-        glCheck(glPushMatrix());
+            glCheck(glMatrixMode(GL_MODELVIEW));
+            glCheck(glPushMatrix());
+            glCheck(glMatrixMode(GL_PROJECTION));
+            glCheck(glPushMatrix());
+            glCheck(glMatrixMode(GL_TEXTURE));
+            glCheck(glPushMatrix());
+        }
     }
 
     resetGLStates();
@@ -553,7 +745,10 @@ void RenderTarget::pushGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::popGLStates()
 {
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    // Pending draw calls must be rendered before the user's OpenGL states are touched
+    flush();
+
+    if ((RenderTargetImpl::isActive(m_id) || setActive(true)) && !m_shaderPipelineEnabled)
     {
         glCheck(glMatrixMode(GL_PROJECTION));
         glCheck(glPopMatrix());
@@ -572,9 +767,13 @@ void RenderTarget::popGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::resetGLStates()
 {
+    // Pending draw calls must be rendered with the states they were issued with
+    flush();
+
     // Check here to make sure a context change does not happen after activate(true)
-    const bool shaderAvailable       = Shader::isAvailable();
-    const bool vertexBufferAvailable = VertexBuffer::isAvailable();
+    const bool shaderAvailable           = Shader::isAvailable();
+    const bool vertexBufferAvailable     = VertexBuffer::isAvailable();
+    const bool primitiveRestartAvailable = IndexBuffer::isPrimitiveRestartAvailable();
 
 // Workaround for states not being properly reset on
 // macOS unless a context switch really takes place
@@ -593,25 +792,35 @@ void RenderTarget::resetGLStates()
         // Make sure that the texture unit which is active is the number 0
         if (GLEXT_multitexture)
         {
-            glCheck(GLEXT_glClientActiveTexture(GLEXT_GL_TEXTURE0));
+            if (!m_shaderPipelineEnabled)
+                glCheck(GLEXT_glClientActiveTexture(GLEXT_GL_TEXTURE0));
             glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
         }
 
         // Define the default OpenGL states
         glCheck(glDisable(GL_CULL_FACE));
-        glCheck(glDisable(GL_LIGHTING));
         glCheck(glDisable(GL_STENCIL_TEST));
         glCheck(glDisable(GL_DEPTH_TEST));
-        glCheck(glDisable(GL_ALPHA_TEST));
         glCheck(glDisable(GL_SCISSOR_TEST));
-        glCheck(glEnable(GL_TEXTURE_2D));
         glCheck(glEnable(GL_BLEND));
-        glCheck(glMatrixMode(GL_MODELVIEW));
-        glCheck(glLoadIdentity());
-        glCheck(glEnableClientState(GL_VERTEX_ARRAY));
-        glCheck(glEnableClientState(GL_COLOR_ARRAY));
-        glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
         glCheck(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE));
+
+        // The largest value of each index format restarts strips and fans
+        if (primitiveRestartAvailable)
+            glCheck(glEnable(GLEXT_GL_PRIMITIVE_RESTART_FIXED_INDEX));
+
+        // Fixed-function states don't exist in the shader pipeline
+        if (!m_shaderPipelineEnabled)
+        {
+            glCheck(glDisable(GL_LIGHTING));
+            glCheck(glDisable(GL_ALPHA_TEST));
+            glCheck(glEnable(GL_TEXTURE_2D));
+            glCheck(glMatrixMode(GL_MODELVIEW));
+            glCheck(glLoadIdentity());
+            glCheck(glEnableClientState(GL_VERTEX_ARRAY));
+            glCheck(glEnableClientState(GL_COLOR_ARRAY));
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+        }
         m_cache.scissorEnabled = false;
         m_cache.stencilEnabled = false;
         m_cache.glStatesSet    = true;
@@ -624,7 +833,10 @@ void RenderTarget::resetGLStates()
             applyShader(nullptr);
 
         if (vertexBufferAvailable)
+        {
             glCheck(VertexBuffer::bind(nullptr));
+            IndexBuffer::bind(nullptr);
+        }
 
         m_cache.texCoordsArrayEnabled = true;
 
@@ -639,8 +851,159 @@ void RenderTarget::resetGLStates()
 
 
 ////////////////////////////////////////////////////////////
-void RenderTarget::initialize()
+void RenderTarget::setBatchingEnabled(bool enabled)
+{
+    if (!enabled)
+        flush();
+
+    m_batch.enabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isBatchingEnabled() const
+{
+    return m_batch.enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setCullingEnabled(bool enabled)
+{
+    m_cullingEnabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isCullingEnabled() const
+{
+    return m_cullingEnabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isVisible(const FloatRect& bounds, const Transform& transform) const
+{
+    // The view transform maps the visible area to [-1, 1], whatever its rotation
+    return RenderTargetImpl::intersectsClipArea((m_view.getTransform() * transform).transformRect(bounds));
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::cull(const FloatRect& bounds, const RenderStates& states, std::size_t drawCount)
+{
+    // Shaders may move the vertices anywhere, so shaded draws are never culled
+    if (states.shader || isVisible(bounds, states.transform))
+        return false;
+
+    m_frameStatistics.culledDraws += drawCount;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::flush()
+{
+    if (m_batch.vertices.empty())
+        return;
+
+    // Take the vertices out of the batch first, since
+    // setting up the draw may recursively trigger a flush
+    std::vector<Vertex> vertices;
+    vertices.swap(m_batch.vertices);
+
+    drawVertices(vertices.data(), vertices.size(), m_batch.type, m_batch.states);
+    ++m_batch.statistics.flushes;
+
+    // Give the storage back to avoid reallocating it for the next batch
+    vertices.clear();
+    vertices.swap(m_batch.vertices);
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderTarget::BatchStatistics& RenderTarget::getBatchStatistics() const
+{
+    return m_batch.statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::resetBatchStatistics()
+{
+    m_batch.statistics = {};
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderTarget::FrameStatistics& RenderTarget::getFrameStatistics() const
+{
+    return m_lastFrameStatistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setGpuTimingEnabled(bool enabled)
+{
+    if (enabled == isGpuTimingEnabled())
+        return;
+
+    if (!RenderTargetImpl::isActive(m_id) && !setActive(true))
+    {
+        err() << "Failed to activate render target to change GPU timing" << std::endl;
+        return;
+    }
+
+    if (!enabled)
+    {
+        m_gpuTimer.reset();
+        m_lastFrameStatistics.gpuTime = Time::Zero;
+        return;
+    }
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    if (!GLEXT_timer_query)
+    {
+        err() << "OpenGL extension ARB_timer_query unavailable" << '\n'
+              << "GPU timing of render targets is not available" << std::endl;
+        return;
+    }
+
+    m_gpuTimer = std::make_unique<GpuTimer>();
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isGpuTimingEnabled() const
+{
+    return m_gpuTimer != nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isShaderPipelineEnabled() const
+{
+    return m_shaderPipelineEnabled;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::initialize(const ContextSettings& settings)
 {
+    // Core profile contexts lack the fixed-function pipeline, so they require the shader pipeline
+    m_shaderPipelineEnabled = false;
+    m_shaderPipeline.reset();
+
+    if (settings.attributeFlags & ContextSettings::Attribute::Core)
+    {
+        if (priv::ShaderPipeline::isAvailable())
+            m_shaderPipelineEnabled = true;
+        else
+            err() << "The shader pipeline is not available, falling back to the fixed-function pipeline" << std::endl;
+    }
+
     // Setup the default and current views
     m_defaultView = View(FloatRect({0, 0}, Vector2f(getSize())));
     m_view        = m_defaultView;
@@ -654,9 +1017,25 @@ void RenderTarget::initialize()
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::endFrame()
+{
+    if (m_gpuTimer && (RenderTargetImpl::isActive(m_id) || setActive(true)))
+    {
+        m_gpuTimer->endFrame();
+        m_frameStatistics.gpuTime = m_gpuTimer->lastGpuTime;
+    }
+
+    m_lastFrameStatistics = m_frameStatistics;
+    m_frameStatistics     = {};
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyCurrentView()
 {
+    ++m_frameStatistics.viewApplications;
+
     // Set the viewport
     const IntRect viewport    = getViewport(m_view);
     const int     viewportTop = static_cast<int>(getSize().y) - (viewport.position.y + viewport.size.y);
@@ -684,12 +1063,15 @@ void RenderTarget::applyCurrentView()
         }
     }
 
-    // Set the projection matrix
-    glCheck(glMatrixMode(GL_PROJECTION));
-    glCheck(glLoadMatrixf(m_view.getTransform().getMatrix()));
+    // Set the projection matrix, the shader pipeline passes it to its program with every draw instead
+    if (!m_shaderPipelineEnabled)
+    {
+        glCheck(glMatrixMode(GL_PROJECTION));
+        glCheck(glLoadMatrixf(m_view.getTransform().getMatrix()));
 
-    // Go back to model-view mode
-    glCheck(glMatrixMode(GL_MODELVIEW));
+        // Go back to model-view mode
+        glCheck(glMatrixMode(GL_MODELVIEW));
+    }
 
     m_cache.viewChanged = false;
 }
@@ -800,7 +1182,13 @@ void RenderTarget::applyTransform(const Transform& transform)
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyTexture(const Texture* texture, CoordinateType coordinateType)
 {
-    Texture::bind(texture, coordinateType);
+    ++m_frameStatistics.textureBinds;
+
+    // The shader pipeline computes the texture matrix itself, only bind the texture
+    if (m_shaderPipelineEnabled)
+        glCheck(glBindTexture(GL_TEXTURE_2D, (texture && texture->m_texture) ? texture->m_texture : 0));
+    else
+        Texture::bind(texture, coordinateType);
 
     m_cache.lastTextureId      = texture ? texture->m_cacheId : 0;
     m_cache.lastCoordinateType = coordinateType;
@@ -810,7 +1198,266 @@ void RenderTarget::applyTexture(const Texture* texture, CoordinateType coordinat
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyShader(const Shader* shader)
 {
+    ++m_frameStatistics.shaderBinds;
+
     Shader::bind(shader);
+
+    // The shader pipeline must bind its built-in shader again before its next draw
+    if (m_shaderPipeline)
+        m_shaderPipeline->invalidateProgram();
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::ensureShaderPipeline()
+{
+    // Vertex array objects are not shared, so the pipeline is recreated when the target is drawn from another context
+    if (!m_shaderPipeline || (m_shaderPipeline->getContextId() != Context::getActiveContextId()))
+    {
+        m_shaderPipeline = std::make_unique<priv::ShaderPipeline>();
+        m_cache.enable   = false;
+    }
+
+    return m_shaderPipeline->isValid();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::prepareShaderPipelineDraw(const RenderStates& states, unsigned int buffer, std::size_t bufferOffset)
+{
+    // clang-format off
+    static constexpr std::array<float, 16> identityMatrix = {1.f, 0.f, 0.f, 0.f,
+                                                             0.f, 1.f, 0.f, 0.f,
+                                                             0.f, 0.f, 1.f, 0.f,
+                                                             0.f, 0.f, 0.f, 1.f};
+    // clang-format on
+
+    const bool textured = states.texture && states.texture->m_texture;
+
+    m_shaderPipeline->prepareDraw(states,
+                                  m_view.getTransform() * states.transform,
+                                  textured ? states.texture->getTextureMatrix(states.coordinateType) : identityMatrix,
+                                  buffer,
+                                  bufferOffset,
+                                  !m_cache.enable);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawVertices(const Vertex*       vertices,
+                                std::size_t         vertexCount,
+                                PrimitiveType       type,
+                                const RenderStates& states,
+                                const Indices*      indices)
+{
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        if (m_shaderPipelineEnabled)
+        {
+            if (!ensureShaderPipeline())
+                return;
+
+            // Vertices are transformed by the program, so the vertex cache is never used
+            setupDraw(false, states);
+            const std::size_t firstVertex = m_shaderPipeline->stream(vertices, vertexCount);
+            prepareShaderPipelineDraw(states, m_shaderPipeline->getStreamBuffer(), 0);
+
+            if (indices)
+            {
+                // Core profiles don't accept indices in client memory, they are streamed like the vertices
+                const std::size_t offset = m_shaderPipeline->streamIndices(indices->data,
+                                                                           indices->count,
+                                                                           indices->wide,
+                                                                           firstVertex);
+                const Indices streamedIndices{reinterpret_cast<const void*>(offset),
+                                              indices->count,
+                                              true,
+                                              m_shaderPipeline->getIndexStreamBuffer()};
+                drawIndexedPrimitives(type, streamedIndices);
+            }
+            else
+            {
+                drawPrimitives(type, firstVertex, vertexCount);
+            }
+
+            cleanupDraw(states);
+            return;
+        }
+
+        // Check if the vertex count is low enough so that we can pre-transform them
+        const bool useVertexCache = (vertexCount <= m_cache.vertexCache.size());
+
+        if (useVertexCache)
+        {
+            // Pre-transform the vertices and store them into the vertex cache
+            for (std::size_t i = 0; i < vertexCount; ++i)
+            {
+                Vertex& vertex   = m_cache.vertexCache[i];
+                vertex.position  = states.transform * vertices[i].position;
+                vertex.color     = vertices[i].color;
+                vertex.texCoords = vertices[i].texCoords;
+            }
+        }
+
+        setupDraw(useVertexCache, states);
+
+        // Check if texture coordinates array is needed, and update client state accordingly
+        const bool enableTexCoordsArray = (states.texture || states.shader);
+        if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
+        {
+            if (enableTexCoordsArray)
+                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+            else
+                glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
+        }
+
+        // If we switch between non-cache and cache mode or enable texture
+        // coordinates we need to set up the pointers to the vertices' components
+        if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
+        {
+            const auto* data = reinterpret_cast<const std::byte*>(vertices);
+
+            // If we pre-transform the vertices, we must use our internal vertex cache
+            if (useVertexCache)
+                data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+
+            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
+            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
+            if (enableTexCoordsArray)
+                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+        }
+        else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
+        {
+            // If we enter this block, we are already using our internal vertex cache
+            const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+
+            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+        }
+
+        if (indices)
+            drawIndexedPrimitives(type, *indices);
+        else
+            drawPrimitives(type, 0, vertexCount);
+
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache.useVertexCache        = useVertexCache;
+        m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawVertexBuffer(const VertexBuffer& vertexBuffer,
+                                    std::size_t         firstVertex,
+                                    std::size_t         vertexCount,
+                                    const RenderStates& states,
+                                    const Indices*      indices)
+{
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        // Streamed buffers are drawn from the segment holding their latest data
+        const std::size_t bufferOffset = sizeof(Vertex) * vertexBuffer.getSegmentOffset();
+
+        if (m_shaderPipelineEnabled)
+        {
+            if (!ensureShaderPipeline())
+                return;
+
+            setupDraw(false, states);
+            prepareShaderPipelineDraw(states, vertexBuffer.getNativeHandle(), bufferOffset);
+
+            if (indices)
+                drawIndexedPrimitives(vertexBuffer.getPrimitiveType(), *indices);
+            else
+                drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
+
+            cleanupDraw(states);
+            return;
+        }
+
+        setupDraw(false, states);
+
+        // Bind vertex buffer
+        VertexBuffer::bind(&vertexBuffer);
+
+        // Always enable texture coordinates
+        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(bufferOffset)));
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(bufferOffset + 8)));
+        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(bufferOffset + 12)));
+
+        if (indices)
+            drawIndexedPrimitives(vertexBuffer.getPrimitiveType(), *indices);
+        else
+            drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
+
+        // Unbind vertex buffer
+        VertexBuffer::bind(nullptr);
+
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache.useVertexCache        = false;
+        m_cache.texCoordsArrayEnabled = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::cullVertices(const Vertex* vertices, std::size_t vertexCount, const RenderStates& states)
+{
+    // Shaders may move the vertices anywhere, so shaded draws are never culled
+    if (!m_cullingEnabled || states.shader)
+        return false;
+
+    const Transform transform = m_view.getTransform() * states.transform;
+    if (RenderTargetImpl::intersectsClipArea(transform.getTransformedBounds(vertices, vertexCount)))
+        return false;
+
+    ++m_frameStatistics.culledDraws;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::batchVertices(const Vertex*       vertices,
+                                 std::size_t         vertexCount,
+                                 PrimitiveType       type,
+                                 const RenderStates& states)
+{
+    // Shader uniforms may be modified between two draw calls, so shaded draws are never deferred
+    if (!m_batch.enabled || states.shader)
+        return false;
+
+    const PrimitiveType batchType = priv::getListPrimitiveType(type);
+
+    // Flush the pending batch if its states are not compatible with the new ones
+    if (!m_batch.vertices.empty() &&
+        ((batchType != m_batch.type) || (states.texture != m_batch.states.texture) ||
+         (states.coordinateType != m_batch.states.coordinateType) || (states.blendMode != m_batch.states.blendMode) ||
+         (states.stencilMode != m_batch.states.stencilMode)))
+        flush();
+
+    if (m_batch.vertices.empty())
+    {
+        // Batched vertices are pre-transformed, so they are rendered with an identity transform
+        m_batch.type             = batchType;
+        m_batch.states           = states;
+        m_batch.states.transform = Transform::Identity;
+    }
+
+    // Strips and fans are expanded to lists, count the vertices actually appended
+    const std::size_t previousSize = m_batch.vertices.size();
+    priv::appendListVertices(m_batch.vertices, vertices, vertexCount, type, states.transform);
+
+    ++m_batch.statistics.batchedDraws;
+    m_batch.statistics.batchedVertices += m_batch.vertices.size() - previousSize;
+
+    return true;
 }
 
 
@@ -841,7 +1488,7 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
         if (!m_cache.enable || !m_cache.useVertexCache)
             glCheck(glLoadIdentity());
     }
-    else
+    else if (!m_shaderPipelineEnabled)
     {
         applyTransform(states.transform);
     }
@@ -850,13 +1497,30 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
     if (!m_cache.enable || m_cache.viewChanged)
         applyCurrentView();
 
+    if (m_gpuTimer)
+        m_gpuTimer->beginFrame();
+
     // Apply the blend mode
     if (!m_cache.enable || (states.blendMode != m_cache.lastBlendMode))
+    {
         applyBlendMode(states.blendMode);
+        ++m_frameStatistics.stateChangesApplied;
+    }
+    else
+    {
+        ++m_frameStatistics.stateChangesAvoided;
+    }
 
     // Apply the stencil mode
     if (!m_cache.enable || (states.stencilMode != m_cache.lastStencilMode))
+    {
         applyStencilMode(states.stencilMode);
+        ++m_frameStatistics.stateChangesApplied;
+    }
+    else
+    {
+        ++m_frameStatistics.stateChangesAvoided;
+    }
 
     // Mask the color buffer off if necessary
     if (states.stencilMode.stencilOnly)
@@ -872,12 +1536,20 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
         // RenderTextureImplFBO which can be quite costly
         // See: https://www.khronos.org/opengl/wiki/Memory_Model
         applyTexture(states.texture, states.coordinateType);
+        ++m_frameStatistics.stateChangesApplied;
     }
     else
     {
         const std::uint64_t textureId = states.texture ? states.texture->m_cacheId : 0;
         if (textureId != m_cache.lastTextureId || states.coordinateType != m_cache.lastCoordinateType)
+        {
             applyTexture(states.texture, states.coordinateType);
+            ++m_frameStatistics.stateChangesApplied;
+        }
+        else
+        {
+            ++m_frameStatistics.stateChangesAvoided;
+        }
     }
 
     // Apply the shader
@@ -889,13 +1561,33 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 ////////////////////////////////////////////////////////////
 void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount)
 {
-    // Find the OpenGL primitive type
-    static constexpr priv::EnumArray<PrimitiveType, GLenum, 6> modes =
-        {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
-    const GLenum mode = modes[type];
-
     // Draw the primitives
+    const GLenum mode = RenderTargetImpl::primitiveTypeToGlConstant(type);
     glCheck(glDrawArrays(mode, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
+
+    ++m_frameStatistics.drawCalls;
+    m_frameStatistics.vertices += vertexCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexedPrimitives(PrimitiveType type, const Indices& indices)
+{
+    if (indices.buffer)
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, indices.buffer));
+
+    // Draw the primitives
+    const GLenum mode = RenderTargetImpl::primitiveTypeToGlConstant(type);
+    glCheck(glDrawElements(mode,
+                           static_cast<GLsizei>(indices.count),
+                           indices.wide ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT,
+                           indices.data));
+
+    if (indices.buffer)
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0));
+
+    ++m_frameStatistics.drawCalls;
+    m_frameStatistics.vertices += indices.count;
 }
 
 
@@ -919,6 +1611,43 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
     m_cache.enable = true;
 }
 
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::beginCustomDraw(const RenderStates& states)
+{
+    // Custom draws must not overtake the pending batch
+    flush();
+
+    // Custom draws rely on fixed-function client arrays
+    if (m_shaderPipelineEnabled)
+        return false;
+
+    if (!RenderTargetImpl::isActive(m_id) && !setActive(true))
+        return false;
+
+    setupDraw(false, states);
+
+    // Always enable texture coordinates, the client arrays are owned by the caller until endCustomDraw()
+    if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+        glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::endCustomDraw(const RenderStates& states, std::size_t vertexCount)
+{
+    ++m_frameStatistics.drawCalls;
+    m_frameStatistics.vertices += vertexCount;
+
+    cleanupDraw(states);
+
+    // The client array pointers no longer refer to our vertex cache
+    m_cache.useVertexCache        = false;
+    m_cache.texCoordsArrayEnabled = true;
+}
+
 } // namespace sf
 
 
@@ -957,4 +1686,12 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
 //   do is that we avoid setting a null shader if there was
 //   already none for the previous draw.
 //
+// * Batching
+//   When enabled, consecutive draws sharing the same texture,
+//   blend mode and stencil mode are pre-transformed on the CPU
+//   and accumulated, then submitted with a single glDrawArrays.
+//   Anything that could observe or alter the GL state (view
+//   change, clear, display, GL state push/pop, draws with other
+//   states) flushes the pending batch first to preserve order.
+//
 ////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RenderTextureImplDefault.hpp>
 #include <SFML/Graphics/RenderTextureImplFBO.hpp>
@@ -34,6 +35,7 @@
 
 #include <memory>
 #include <ostream>
+#include <utility>
 
 #include <cassert>
 
@@ -99,7 +101,7 @@ bool RenderTexture::resize(Vector2u size, const ContextSettings& settings)
         return false;
 
     // We can now initialize the render target part
-    RenderTarget::initialize();
+    RenderTarget::initialize(settings);
 
     return true;
 }
@@ -169,6 +171,9 @@ void RenderTexture::display()
     if (!m_impl)
         return;
 
+    // Render the pending batch of draw calls, if any
+    flush();
+
     if (priv::RenderTextureImplFBO::isAvailable())
     {
         // Perform a RenderTarget-only activation if we are using FBOs
@@ -186,6 +191,8 @@ void RenderTexture::display()
     m_impl->updateTexture(m_texture.m_texture);
     m_texture.m_pixelsFlipped = true;
     m_texture.invalidateMipmap();
+
+    endFrame();
 }
 
 
@@ -210,4 +217,35 @@ const Texture& RenderTexture::getTexture() const
     return m_texture;
 }
 
+
+////////////////////////////////////////////////////////////
+std::uint64_t RenderTexture::copyToImageAsync(std::function<void(Image&&)> callback)
+{
+    // Render the pending batch of draw calls, so that they are part of the copy
+    flush();
+
+    return m_texture.copyToImageAsync(std::move(callback));
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> RenderTexture::pollAsyncCopy(std::uint64_t ticket)
+{
+    return m_texture.pollAsyncCopy(ticket);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> RenderTexture::waitForAsyncCopy(std::uint64_t ticket)
+{
+    return m_texture.waitForAsyncCopy(ticket);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexture::processAsyncCopies()
+{
+    m_texture.processAsyncCopies();
+}
+
 } // namespace sf
@@ -114,7 +114,7 @@ void RenderWindow::onCreate()
     }
 
     // Just initialize the render target part
-    RenderTarget::initialize();
+    RenderTarget::initialize(getSettings());
 }
 
 
@@ -125,4 +125,14 @@ void RenderWindow::onResize()
     setView(getView());
 }
 
+
+////////////////////////////////////////////////////////////
+void RenderWindow::onDisplay()
+{
+    // Render the pending batch of draw calls, if any
+    flush();
+
+    endFrame();
+}
+
 } // namespace sf
@@ -29,7 +29,9 @@
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/ShaderCache.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
 
 #include <SFML/Window/GlResource.hpp>
 
@@ -40,10 +42,15 @@
 #include <SFML/System/Vector2.hpp>
 #include <SFML/System/Vector3.hpp>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
+#include <optional>
 #include <ostream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -65,6 +72,14 @@
 
 namespace
 {
+// Thread-safe unique identifier, used to tell programs apart even when OpenGL reuses their names
+std::uint64_t getUniqueProgramId()
+{
+    static std::atomic<std::uint64_t> id(1); // start at 1, zero is "no program"
+
+    return id.fetch_add(1);
+}
+
 // Retrieve the maximum number of texture units available
 std::size_t getMaxTextureUnits()
 {
@@ -79,6 +94,109 @@ std::size_t getMaxTextureUnits()
     return static_cast<std::size_t>(maxUnits);
 }
 
+// Retrieve the maximum number of uniform buffer binding points available
+std::size_t getMaxUniformBufferBindings()
+{
+    static const GLint maxBindings = []
+    {
+        GLint value = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS, &value));
+
+        return value;
+    }();
+
+    return static_cast<std::size_t>(maxBindings);
+}
+
+// State of the program binary cache, shared by all the threads
+struct BinaryCache
+{
+    std::mutex            mutex;
+    std::filesystem::path directory;
+    std::size_t           hits{};
+    std::size_t           misses{};
+};
+
+BinaryCache& getBinaryCache()
+{
+    static BinaryCache cache;
+    return cache;
+}
+
+// Describe the driver of the active context, programs saved by another driver can't be loaded
+std::string getDriverDescription()
+{
+    constexpr std::array<GLenum, 3> names = {GL_VENDOR, GL_RENDERER, GL_VERSION};
+
+    std::string description;
+    for (const GLenum name : names)
+    {
+        if (const auto* string = reinterpret_cast<const char*>(glCheck(glGetString(name))))
+            description += string;
+
+        description += '\n';
+    }
+
+    return description;
+}
+
+// Check whether the driver accepts a program binary format
+bool isProgramBinaryFormatSupported(GLenum format)
+{
+    GLint count = 0;
+    glCheck(glGetIntegerv(GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS, &count));
+    if (count <= 0)
+        return false;
+
+    std::vector<GLint> formats(static_cast<std::size_t>(count));
+    glCheck(glGetIntegerv(GLEXT_GL_PROGRAM_BINARY_FORMATS, formats.data()));
+
+    return std::find(formats.begin(), formats.end(), static_cast<GLint>(format)) != formats.end();
+}
+
+// Create a program from its cache file, returns a null handle if the file is missing or the driver rejects it
+GLEXT_GLhandle loadCachedProgram(const std::filesystem::path& path, std::string_view driver)
+{
+    const std::optional binary = sf::priv::loadProgramBinary(path, driver);
+    if (!binary || !isProgramBinaryFormatSupported(binary->format))
+        return {};
+
+    const GLEXT_GLhandle shaderProgram = glCheck(GLEXT_glCreateProgramObject());
+    glCheck(GLEXT_glProgramBinary(castFromGlHandle(shaderProgram),
+                                  binary->format,
+                                  binary->data.data(),
+                                  static_cast<GLsizei>(binary->data.size())));
+
+    GLint success = GL_FALSE;
+    glCheck(GLEXT_glGetProgramiv(castFromGlHandle(shaderProgram), GLEXT_GL_OBJECT_LINK_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        glCheck(GLEXT_glDeleteObject(shaderProgram));
+        return {};
+    }
+
+    return shaderProgram;
+}
+
+// Save a linked program to its cache file
+void saveCachedProgram(const std::filesystem::path& path, std::string_view driver, GLEXT_GLhandle shaderProgram)
+{
+    GLint length = 0;
+    glCheck(GLEXT_glGetProgramiv(castFromGlHandle(shaderProgram), GLEXT_GL_PROGRAM_BINARY_LENGTH, &length));
+    if (length <= 0)
+        return;
+
+    sf::priv::ProgramBinary binary;
+    binary.data.resize(static_cast<std::size_t>(length));
+
+    GLenum format = 0;
+    glCheck(GLEXT_glGetProgramBinary(castFromGlHandle(shaderProgram), length, &length, &format, binary.data.data()));
+    binary.data.resize(static_cast<std::size_t>(length));
+    binary.format = format;
+
+    (void)sf::priv::saveProgramBinary(path, driver, binary);
+}
+
 // Read the contents of a file into an array of char
 bool getFileContents(const std::filesystem::path& filename, std::vector<char>& buffer)
 {
@@ -311,9 +429,13 @@ Shader::~Shader()
 ////////////////////////////////////////////////////////////
 Shader::Shader(Shader&& source) noexcept :
     m_shaderProgram(std::exchange(source.m_shaderProgram, 0u)),
+    m_programId(std::exchange(source.m_programId, 0u)),
     m_currentTexture(std::exchange(source.m_currentTexture, -1)),
     m_textures(std::move(source.m_textures)),
-    m_uniforms(std::move(source.m_uniforms))
+    m_uniforms(std::move(source.m_uniforms)),
+    m_deferredUniforms(std::move(source.m_deferredUniforms)),
+    m_pendingUniforms(std::move(source.m_pendingUniforms)),
+    m_uniformBlocks(std::move(source.m_uniformBlocks))
 {
 }
 
@@ -334,10 +456,14 @@ Shader& Shader::operator=(Shader&& right) noexcept
     }
 
     // Move the contents of right.
-    m_shaderProgram  = std::exchange(right.m_shaderProgram, 0u);
-    m_currentTexture = std::exchange(right.m_currentTexture, -1);
-    m_textures       = std::move(right.m_textures);
-    m_uniforms       = std::move(right.m_uniforms);
+    m_shaderProgram    = std::exchange(right.m_shaderProgram, 0u);
+    m_programId        = std::exchange(right.m_programId, 0u);
+    m_currentTexture   = std::exchange(right.m_currentTexture, -1);
+    m_textures         = std::move(right.m_textures);
+    m_uniforms         = std::move(right.m_uniforms);
+    m_deferredUniforms = std::move(right.m_deferredUniforms);
+    m_pendingUniforms  = std::move(right.m_pendingUniforms);
+    m_uniformBlocks    = std::move(right.m_uniformBlocks);
     return *this;
 }
 
@@ -768,6 +894,290 @@ void Shader::setUniformArray(const std::string& name, const Glsl::Mat4* matrixAr
 }
 
 
+////////////////////////////////////////////////////////////
+Shader::UniformHandle Shader::getUniformHandle(const std::string& name)
+{
+    if (!m_shaderProgram)
+        return {};
+
+    const TransientContextLock lock;
+
+    const int location = getUniformLocation(name);
+    if (location == -1)
+        return {};
+
+    // Handles of the same uniform share their storage
+    for (std::size_t i = 0; i < m_deferredUniforms.size(); ++i)
+    {
+        if (m_deferredUniforms[i].location == location)
+            return {location, i};
+    }
+
+    m_deferredUniforms.emplace_back().location = location;
+    return {location, m_deferredUniforms.size() - 1};
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, float x)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Float, 1))
+        uniform->floats.assign({x});
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, Glsl::Vec2 v)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Vec2, 1))
+        uniform->floats.assign({v.x, v.y});
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Vec3& v)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Vec3, 1))
+        uniform->floats.assign({v.x, v.y, v.z});
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Vec4& v)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Vec4, 1))
+        uniform->floats.assign({v.x, v.y, v.z, v.w});
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, int x)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Int, 1))
+        uniform->ints.assign({x});
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, Glsl::Ivec2 v)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Ivec2, 1))
+        uniform->ints.assign({v.x, v.y});
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Ivec3& v)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Ivec3, 1))
+        uniform->ints.assign({v.x, v.y, v.z});
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Ivec4& v)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Ivec4, 1))
+        uniform->ints.assign({v.x, v.y, v.z, v.w});
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, bool x)
+{
+    setUniform(handle, static_cast<int>(x));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, Glsl::Bvec2 v)
+{
+    setUniform(handle, Glsl::Ivec2(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Bvec3& v)
+{
+    setUniform(handle, Glsl::Ivec3(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Bvec4& v)
+{
+    setUniform(handle, Glsl::Ivec4(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Mat3& matrix)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Mat3, 1))
+        uniform->floats.assign(matrix.array.begin(), matrix.array.end());
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Mat4& matrix)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Mat4, 1))
+        uniform->floats.assign(matrix.array.begin(), matrix.array.end());
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Texture& texture)
+{
+    if (!m_shaderProgram || !handle.isValid())
+        return;
+
+    // Location already used, just replace the texture
+    if (const auto it = m_textures.find(handle.m_location); it != m_textures.end())
+    {
+        it->second = &texture;
+        return;
+    }
+
+    // New entry, make sure there are enough texture units
+    const TransientContextLock lock;
+    if (m_textures.size() + 1 >= getMaxTextureUnits())
+    {
+        err() << "Impossible to use texture for shader: all available texture units are used" << std::endl;
+        return;
+    }
+
+    m_textures[handle.m_location] = &texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, CurrentTextureType)
+{
+    if (m_shaderProgram && handle.isValid())
+        m_currentTexture = handle.m_location;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const float* scalarArray, std::size_t length)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Float, length))
+        uniform->floats.assign(scalarArray, scalarArray + length);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Vec2* vectorArray, std::size_t length)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Vec2, length))
+    {
+        uniform->floats.clear();
+        for (std::size_t i = 0; i < length; ++i)
+            uniform->floats.insert(uniform->floats.end(), {vectorArray[i].x, vectorArray[i].y});
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Vec3* vectorArray, std::size_t length)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Vec3, length))
+    {
+        uniform->floats.clear();
+        for (std::size_t i = 0; i < length; ++i)
+            uniform->floats.insert(uniform->floats.end(), {vectorArray[i].x, vectorArray[i].y, vectorArray[i].z});
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Vec4* vectorArray, std::size_t length)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Vec4, length))
+    {
+        uniform->floats.clear();
+        for (std::size_t i = 0; i < length; ++i)
+            uniform->floats.insert(uniform->floats.end(),
+                                   {vectorArray[i].x, vectorArray[i].y, vectorArray[i].z, vectorArray[i].w});
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Mat3* matrixArray, std::size_t length)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Mat3, length))
+    {
+        const std::size_t matrixSize = 3 * 3;
+
+        uniform->floats.resize(matrixSize * length);
+        for (std::size_t i = 0; i < length; ++i)
+            priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &uniform->floats[matrixSize * i]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Mat4* matrixArray, std::size_t length)
+{
+    if (DeferredUniform* uniform = deferUniform(handle, DeferredUniform::Type::Mat4, length))
+    {
+        const std::size_t matrixSize = 4 * 4;
+
+        uniform->floats.resize(matrixSize * length);
+        for (std::size_t i = 0; i < length; ++i)
+            priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &uniform->floats[matrixSize * i]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformBlock(const std::string& name, const UniformBuffer& buffer)
+{
+    if (!m_shaderProgram)
+        return;
+
+    if (!UniformBuffer::isAvailable())
+    {
+        err() << "Failed to set uniform block " << std::quoted(name) << ": your system doesn't support uniform buffers "
+              << "(you should test UniformBuffer::isAvailable() before trying to use uniform blocks)" << std::endl;
+        return;
+    }
+
+    const TransientContextLock lock;
+
+    // Find the index of the block in the shader
+    const GLuint index = glCheck(GLEXT_glGetUniformBlockIndex(m_shaderProgram, name.c_str()));
+    if (index == GLEXT_GL_INVALID_INDEX)
+    {
+        err() << "Uniform block " << std::quoted(name) << " not found in shader" << std::endl;
+        return;
+    }
+
+    // Block already attached, just replace the buffer
+    for (UniformBlock& block : m_uniformBlocks)
+    {
+        if (block.index == index)
+        {
+            block.buffer = &buffer;
+            return;
+        }
+    }
+
+    // New entry, make sure there are enough binding points
+    if (m_uniformBlocks.size() >= getMaxUniformBufferBindings())
+    {
+        err() << "Impossible to use uniform block " << std::quoted(name)
+              << " for shader: all available binding points are used" << std::endl;
+        return;
+    }
+
+    glCheck(GLEXT_glUniformBlockBinding(m_shaderProgram, index, static_cast<GLuint>(m_uniformBlocks.size())));
+    m_uniformBlocks.push_back({index, &buffer});
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Shader::getNativeHandle() const
 {
@@ -793,9 +1203,15 @@ void Shader::bind(const Shader* shader)
         // Enable the program
         glCheck(GLEXT_glUseProgramObject(castToGlHandle(shader->m_shaderProgram)));
 
+        // Upload the values set through uniform handles
+        shader->applyDeferredUniforms();
+
         // Bind the textures
         shader->bindTextures();
 
+        // Bind the uniform buffers
+        shader->bindUniformBlocks();
+
         // Bind the current texture
         if (shader->m_currentTexture != -1)
             glCheck(GLEXT_glUniform1i(shader->m_currentTexture, 0));
@@ -808,6 +1224,56 @@ void Shader::bind(const Shader* shader)
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setBinaryCacheDirectory(const std::filesystem::path& directory)
+{
+    BinaryCache&          cache = getBinaryCache();
+    const std::lock_guard lock(cache.mutex);
+    cache.directory = directory;
+}
+
+
+////////////////////////////////////////////////////////////
+std::filesystem::path Shader::getBinaryCacheDirectory()
+{
+    BinaryCache&          cache = getBinaryCache();
+    const std::lock_guard lock(cache.mutex);
+    return cache.directory;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::BinaryCacheStatistics Shader::getBinaryCacheStatistics()
+{
+    BinaryCache&          cache = getBinaryCache();
+    const std::lock_guard lock(cache.mutex);
+    return {cache.hits, cache.misses};
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isBinaryCacheAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        if (!isAvailable() || !GLEXT_get_program_binary)
+            return false;
+
+        // Some drivers expose the extension without supporting any format
+        GLint count = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS, &count));
+        return count > 0;
+    }();
+
+    return available;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Shader::isAvailable()
 {
@@ -864,6 +1330,59 @@ bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometr
         return false;
     }
 
+    // Replace the current program by a new one
+    const auto replaceProgram = [this](GLEXT_GLhandle shaderProgram)
+    {
+        // Destroy the shader if it was already created
+        if (m_shaderProgram)
+        {
+            glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
+            m_shaderProgram = 0;
+        }
+
+        // Reset the internal state
+        m_currentTexture = -1;
+        m_textures.clear();
+        m_uniforms.clear();
+        m_deferredUniforms.clear();
+        m_pendingUniforms.clear();
+        m_uniformBlocks.clear();
+
+        m_shaderProgram = castFromGlHandle(shaderProgram);
+        m_programId     = getUniqueProgramId();
+
+        // Force an OpenGL flush, so that the shader will appear updated
+        // in all contexts immediately (solves problems in multi-threaded apps)
+        glCheck(glFlush());
+    };
+
+    // Load the program from the binary cache if it was saved by the same driver
+    std::string           driver;
+    std::filesystem::path binaryPath;
+    const std::filesystem::path directory = getBinaryCacheDirectory();
+    if (!directory.empty() && isBinaryCacheAvailable())
+    {
+        driver     = getDriverDescription();
+        binaryPath = priv::getProgramBinaryPath(directory,
+                                                driver,
+                                                vertexShaderCode,
+                                                geometryShaderCode,
+                                                fragmentShaderCode);
+
+        const GLEXT_GLhandle cachedProgram = loadCachedProgram(binaryPath, driver);
+        {
+            BinaryCache&          cache = getBinaryCache();
+            const std::lock_guard cacheLock(cache.mutex);
+            ++(cachedProgram ? cache.hits : cache.misses);
+        }
+
+        if (cachedProgram)
+        {
+            replaceProgram(cachedProgram);
+            return true;
+        }
+    }
+
     // Create the program
     const GLEXT_GLhandle shaderProgram = glCheck(GLEXT_glCreateProgramObject());
 
@@ -912,6 +1431,12 @@ bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometr
         if (!createAndAttachShader(GLEXT_GL_FRAGMENT_SHADER, "fragment", fragmentShaderCode))
             return false;
 
+    // Let the driver keep the binary if it is going to be saved
+    if (!binaryPath.empty())
+        glCheck(GLEXT_glProgramParameteri(castFromGlHandle(shaderProgram),
+                                          GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                                          GL_TRUE));
+
     // Link the program
     glCheck(GLEXT_glLinkProgram(shaderProgram));
 
@@ -927,23 +1452,11 @@ bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometr
         return false;
     }
 
-    // Destroy the shader if it was already created
-    if (m_shaderProgram)
-    {
-        glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
-        m_shaderProgram = 0;
-    }
-
-    // Reset the internal state
-    m_currentTexture = -1;
-    m_textures.clear();
-    m_uniforms.clear();
-
-    m_shaderProgram = castFromGlHandle(shaderProgram);
+    // Save the program for the next runs
+    if (!binaryPath.empty())
+        saveCachedProgram(binaryPath, driver, shaderProgram);
 
-    // Force an OpenGL flush, so that the shader will appear updated
-    // in all contexts immediately (solves problems in multi-threaded apps)
-    glCheck(glFlush());
+    replaceProgram(shaderProgram);
 
     return true;
 }
@@ -967,6 +1480,94 @@ void Shader::bindTextures() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::applyDeferredUniforms() const
+{
+    for (const std::size_t slot : m_pendingUniforms)
+    {
+        const DeferredUniform& uniform  = m_deferredUniforms[slot];
+        const GLint            location = uniform.location;
+        const auto             count    = static_cast<GLsizei>(uniform.count);
+        const float*           floats   = uniform.floats.data();
+        const int*             ints     = uniform.ints.data();
+
+        switch (uniform.type)
+        {
+            case DeferredUniform::Type::Float:
+                glCheck(GLEXT_glUniform1fv(location, count, floats));
+                break;
+            case DeferredUniform::Type::Vec2:
+                glCheck(GLEXT_glUniform2fv(location, count, floats));
+                break;
+            case DeferredUniform::Type::Vec3:
+                glCheck(GLEXT_glUniform3fv(location, count, floats));
+                break;
+            case DeferredUniform::Type::Vec4:
+                glCheck(GLEXT_glUniform4fv(location, count, floats));
+                break;
+            case DeferredUniform::Type::Int:
+                glCheck(GLEXT_glUniform1iv(location, count, ints));
+                break;
+            case DeferredUniform::Type::Ivec2:
+                glCheck(GLEXT_glUniform2iv(location, count, ints));
+                break;
+            case DeferredUniform::Type::Ivec3:
+                glCheck(GLEXT_glUniform3iv(location, count, ints));
+                break;
+            case DeferredUniform::Type::Ivec4:
+                glCheck(GLEXT_glUniform4iv(location, count, ints));
+                break;
+            case DeferredUniform::Type::Mat3:
+                glCheck(GLEXT_glUniformMatrix3fv(location, count, GL_FALSE, floats));
+                break;
+            case DeferredUniform::Type::Mat4:
+                glCheck(GLEXT_glUniformMatrix4fv(location, count, GL_FALSE, floats));
+                break;
+        }
+
+        uniform.pending = false;
+    }
+
+    m_pendingUniforms.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlocks() const
+{
+    for (std::size_t i = 0; i < m_uniformBlocks.size(); ++i)
+    {
+        glCheck(GLEXT_glBindBufferBase(GLEXT_GL_UNIFORM_BUFFER,
+                                       static_cast<GLuint>(i),
+                                       m_uniformBlocks[i].buffer->getNativeHandle()));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::DeferredUniform* Shader::deferUniform(UniformHandle handle, DeferredUniform::Type type, std::size_t count)
+{
+    // Ignore invalid handles and the ones resolved before the shader was loaded again
+    if (!handle.isValid() || (handle.m_slot >= m_deferredUniforms.size()))
+        return nullptr;
+
+    DeferredUniform& uniform = m_deferredUniforms[handle.m_slot];
+    if (uniform.location != handle.m_location)
+        return nullptr;
+
+    uniform.type  = type;
+    uniform.count = count;
+
+    if (!uniform.pending)
+    {
+        uniform.pending = true;
+        m_pendingUniforms.push_back(handle.m_slot);
+    }
+
+    return &uniform;
+}
+
+
 ////////////////////////////////////////////////////////////
 int Shader::getUniformLocation(const std::string& name)
 {
@@ -1277,6 +1878,151 @@ void Shader::setUniformArray(const std::string& /* name */, const Glsl::Mat4* /*
 }
 
 
+////////////////////////////////////////////////////////////
+Shader::UniformHandle Shader::getUniformHandle(const std::string& /* name */)
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, float)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, Glsl::Vec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Vec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Vec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, int)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, Glsl::Ivec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Ivec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Ivec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, bool)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, Glsl::Bvec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Bvec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Bvec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Mat3& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Mat4& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Texture& /* texture */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, CurrentTextureType)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const float* /* scalarArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Vec2* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Vec3* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Vec4* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Mat3* /* matrixArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Mat4* /* matrixArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformBlock(const std::string& /* name */, const UniformBuffer& /* buffer */)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Shader::getNativeHandle() const
 {
@@ -1290,6 +2036,33 @@ void Shader::bind(const Shader* /* shader */)
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setBinaryCacheDirectory(const std::filesystem::path& /* directory */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::filesystem::path Shader::getBinaryCacheDirectory()
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::BinaryCacheStatistics Shader::getBinaryCacheStatistics()
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isBinaryCacheAvailable()
+{
+    return false;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Shader::isAvailable()
 {
@@ -1318,6 +2091,18 @@ void Shader::bindTextures() const
 {
 }
 
+
+////////////////////////////////////////////////////////////
+void Shader::applyDeferredUniforms() const
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlocks() const
+{
+}
+
 } // namespace sf
 
 #endif // SFML_OPENGL_ES
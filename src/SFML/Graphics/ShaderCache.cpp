@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ShaderCache.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <array>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ShaderCacheImpl
+{
+// Signature of the cache files, the last character is the version of the format
+constexpr std::array<char, 8> signature = {'S', 'F', 'M', 'L', 'P', 'R', 'G', '1'};
+
+// Larger binaries are rejected, so that a corrupted size can't trigger a huge allocation
+constexpr std::uint64_t maxBinarySize = 256 * 1024 * 1024;
+
+// 64-bit FNV-1a hash
+void hash(std::uint64_t& value, std::string_view data)
+{
+    // The size is hashed too, so that moving code from one shader to another changes the hash
+    const std::uint64_t size = data.size();
+    for (std::size_t i = 0; i < sizeof(size); ++i)
+        value = (value ^ ((size >> (i * 8)) & 0xFF)) * 0x100000001B3;
+
+    for (const char character : data)
+        value = (value ^ static_cast<unsigned char>(character)) * 0x100000001B3;
+}
+
+template <typename T>
+bool read(std::istream& stream, T& value)
+{
+    return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+template <typename T>
+void write(std::ostream& stream, const T& value)
+{
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+} // namespace ShaderCacheImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::filesystem::path getProgramBinaryPath(const std::filesystem::path& directory,
+                                           std::string_view             driver,
+                                           std::string_view             vertexShaderCode,
+                                           std::string_view             geometryShaderCode,
+                                           std::string_view             fragmentShaderCode)
+{
+    std::uint64_t value = 0xCBF29CE484222325;
+    ShaderCacheImpl::hash(value, driver);
+    ShaderCacheImpl::hash(value, vertexShaderCode);
+    ShaderCacheImpl::hash(value, geometryShaderCode);
+    ShaderCacheImpl::hash(value, fragmentShaderCode);
+
+    std::ostringstream name;
+    name << std::hex << std::setfill('0') << std::setw(16) << value << ".bin";
+    return directory / name.str();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<ProgramBinary> loadProgramBinary(const std::filesystem::path& path, std::string_view driver)
+{
+    std::ifstream file(path, std::ios_base::binary);
+    if (!file)
+        return std::nullopt;
+
+    // Check the signature and the driver which wrote the file
+    std::array<char, ShaderCacheImpl::signature.size()> fileSignature{};
+    std::uint32_t                                       driverSize = 0;
+    if (!file.read(fileSignature.data(), fileSignature.size()) || (fileSignature != ShaderCacheImpl::signature) ||
+        !ShaderCacheImpl::read(file, driverSize) || (driverSize != driver.size()))
+        return std::nullopt;
+
+    std::string fileDriver(driverSize, '\0');
+    if (!file.read(fileDriver.data(), static_cast<std::streamsize>(driverSize)) || (fileDriver != driver))
+        return std::nullopt;
+
+    // Read the binary
+    ProgramBinary binary;
+    std::uint64_t size = 0;
+    if (!ShaderCacheImpl::read(file, binary.format) || !ShaderCacheImpl::read(file, size) || (size == 0) ||
+        (size > ShaderCacheImpl::maxBinarySize))
+        return std::nullopt;
+
+    binary.data.resize(static_cast<std::size_t>(size));
+    if (!file.read(reinterpret_cast<char*>(binary.data.data()), static_cast<std::streamsize>(size)))
+        return std::nullopt;
+
+    return binary;
+}
+
+
+////////////////////////////////////////////////////////////
+bool saveProgramBinary(const std::filesystem::path& path, std::string_view driver, const ProgramBinary& binary)
+{
+    std::error_code error;
+    std::filesystem::create_directories(path.parent_path(), error);
+
+    std::filesystem::path temporaryPath = path;
+    temporaryPath += ".tmp";
+
+    {
+        std::ofstream file(temporaryPath, std::ios_base::binary | std::ios_base::trunc);
+        if (!file)
+        {
+            err() << "Failed to write shader binary cache file\n" << formatDebugPathInfo(temporaryPath) << std::endl;
+            return false;
+        }
+
+        file.write(ShaderCacheImpl::signature.data(), ShaderCacheImpl::signature.size());
+        ShaderCacheImpl::write(file, static_cast<std::uint32_t>(driver.size()));
+        file.write(driver.data(), static_cast<std::streamsize>(driver.size()));
+        ShaderCacheImpl::write(file, binary.format);
+        ShaderCacheImpl::write(file, static_cast<std::uint64_t>(binary.data.size()));
+        file.write(reinterpret_cast<const char*>(binary.data.data()), static_cast<std::streamsize>(binary.data.size()));
+
+        if (!file.flush())
+        {
+            err() << "Failed to write shader binary cache file\n" << formatDebugPathInfo(temporaryPath) << std::endl;
+            file.close();
+            std::filesystem::remove(temporaryPath, error);
+            return false;
+        }
+    }
+
+    // Replace the file in one step, readers see either the old file or the new one
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error)
+    {
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace sf::priv
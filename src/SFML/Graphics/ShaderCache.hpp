@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Linked shader program retrieved from the driver
+///
+////////////////////////////////////////////////////////////
+struct ProgramBinary
+{
+    std::uint32_t          format{}; //!< Driver specific format of the binary
+    std::vector<std::byte> data;     //!< Contents of the binary
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Get the path of the cache file of a program
+///
+/// The file name is a hash of the driver description and of
+/// the source code of the shaders, so that editing a shader or
+/// updating the driver leads to a different file.
+///
+/// \param directory          Directory of the cache
+/// \param driver             Description of the driver which compiles the program
+/// \param vertexShaderCode   Source code of the vertex shader
+/// \param geometryShaderCode Source code of the geometry shader
+/// \param fragmentShaderCode Source code of the fragment shader
+///
+/// \return Path of the cache file
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::filesystem::path getProgramBinaryPath(const std::filesystem::path& directory,
+                                                         std::string_view             driver,
+                                                         std::string_view             vertexShaderCode,
+                                                         std::string_view             geometryShaderCode,
+                                                         std::string_view             fragmentShaderCode);
+
+////////////////////////////////////////////////////////////
+/// \brief Read a program binary from a cache file
+///
+/// \param path   Path of the cache file
+/// \param driver Description of the driver which will load the program
+///
+/// \return Program binary, or `std::nullopt` if the file is missing, invalid or from another driver
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::optional<ProgramBinary> loadProgramBinary(const std::filesystem::path& path,
+                                                           std::string_view             driver);
+
+////////////////////////////////////////////////////////////
+/// \brief Write a program binary to a cache file
+///
+/// The file is written under a temporary name then renamed, so
+/// that other threads or processes never read a partial file.
+/// The directory is created if needed.
+///
+/// \param path   Path of the cache file
+/// \param driver Description of the driver which compiled the program
+/// \param binary Program binary to write
+///
+/// \return `true` if the file was written, `false` otherwise
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool saveProgramBinary(const std::filesystem::path& path,
+                                     std::string_view             driver,
+                                     const ProgramBinary&         binary);
+
+} // namespace sf::priv
@@ -0,0 +1,530 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/ShaderPipeline.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <SFML/Window/Context.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+
+#include <cstring>
+
+#ifndef SFML_OPENGL_ES
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ShaderPipelineImpl
+{
+// Initial size of the streaming buffers, enough for most frames without any orphaning
+constexpr std::size_t initialCapacity = 1024 * 1024;
+
+// Built-in vertex inputs and uniforms, also available to user shaders
+constexpr std::array<const char*, 3> attributeNames = {"sf_position", "sf_color", "sf_texCoords"};
+
+// Offsets of the attributes within sf::Vertex
+constexpr std::array<std::size_t, 3> attributeOffsets = {0, 8, 12};
+
+constexpr const char* vertexShader = R"(
+in vec2 sf_position;
+in vec4 sf_color;
+in vec2 sf_texCoords;
+
+uniform mat4 sf_modelViewProjection;
+uniform mat4 sf_textureMatrix;
+
+out vec4 sf_vertexColor;
+out vec2 sf_vertexTexCoords;
+
+void main()
+{
+    gl_Position        = sf_modelViewProjection * vec4(sf_position, 0.0, 1.0);
+    sf_vertexTexCoords = (sf_textureMatrix * vec4(sf_texCoords, 0.0, 1.0)).xy;
+    sf_vertexColor     = sf_color;
+}
+)";
+
+constexpr const char* fragmentShader = R"(
+in vec4 sf_vertexColor;
+in vec2 sf_vertexTexCoords;
+
+uniform sampler2D sf_texture;
+uniform float     sf_textureEnabled;
+
+out vec4 sf_fragmentColor;
+
+void main()
+{
+    vec4 texel       = mix(vec4(1.0), texture(sf_texture, sf_vertexTexCoords), sf_textureEnabled);
+    sf_fragmentColor = sf_vertexColor * texel;
+}
+)";
+
+// Get the GLSL version supported by the active context, as major * 100 + minor
+int getShadingLanguageVersion()
+{
+    const auto* version = reinterpret_cast<const char*>(glGetString(GL_SHADING_LANGUAGE_VERSION));
+    if (!version)
+        return 0;
+
+    // The beginning of the returned string is "major.minor" (this is standard)
+    int major = 0;
+    int minor = 0;
+    for (; (*version >= '0') && (*version <= '9'); ++version)
+        major = major * 10 + (*version - '0');
+    if (*version == '.')
+        ++version;
+    for (int digits = 0; (digits < 2) && (*version >= '0') && (*version <= '9'); ++digits, ++version)
+        minor = minor * 10 + (*version - '0');
+
+    return major * 100 + minor;
+}
+
+// Get the GLSL version directive the built-in shader should be compiled with
+std::string getVersionDirective()
+{
+    // Core profile contexts are only guaranteed to support GLSL 1.50 and later
+    return (getShadingLanguageVersion() >= 150) ? "#version 150\n" : "#version 130\n";
+}
+
+// Convert a shader to the handle type expected by the ARB_shader_objects entry points
+GLEXT_GLhandle getProgramHandle(const sf::Shader& shader)
+{
+#if defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS)
+    return reinterpret_cast<GLEXT_GLhandle>(std::ptrdiff_t{shader.getNativeHandle()});
+#else
+    return shader.getNativeHandle();
+#endif
+}
+} // namespace ShaderPipelineImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+ShaderPipeline::ShaderPipeline() : m_contextId(Context::getActiveContextId())
+{
+    using ShaderPipelineImpl::getVersionDirective;
+
+    const std::string version = getVersionDirective();
+    if (!m_defaultShader.loadFromMemory(version + ShaderPipelineImpl::vertexShader,
+                                        version + ShaderPipelineImpl::fragmentShader))
+    {
+        err() << "Failed to compile the built-in shader of the shader pipeline" << std::endl;
+        return;
+    }
+
+    m_defaultShader.setUniform("sf_texture", Shader::CurrentTexture);
+    m_defaultLayout = getProgramLayout(m_defaultShader);
+
+    glCheck(GLEXT_glGenVertexArrays(1, &m_vertexArray));
+    glCheck(GLEXT_glGenBuffers(1, &m_streamBuffer.name));
+    glCheck(GLEXT_glGenBuffers(1, &m_indexStreamBuffer.name));
+
+    if (!m_vertexArray || !m_streamBuffer.name || !m_indexStreamBuffer.name)
+    {
+        err() << "Failed to create the vertex array or buffers of the shader pipeline" << std::endl;
+        return;
+    }
+
+    m_streamBuffer.capacity = ShaderPipelineImpl::initialCapacity;
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_streamBuffer.name));
+    glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                               static_cast<GLsizeiptrARB>(m_streamBuffer.capacity),
+                               nullptr,
+                               GLEXT_GL_STREAM_DRAW));
+
+    // The index buffer binding is part of the vertex array state
+    m_indexStreamBuffer.capacity = ShaderPipelineImpl::initialCapacity;
+    glCheck(GLEXT_glBindVertexArray(m_vertexArray));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_indexStreamBuffer.name));
+    glCheck(GLEXT_glBufferData(GLEXT_GL_ELEMENT_ARRAY_BUFFER,
+                               static_cast<GLsizeiptrARB>(m_indexStreamBuffer.capacity),
+                               nullptr,
+                               GLEXT_GL_STREAM_DRAW));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0));
+}
+
+
+////////////////////////////////////////////////////////////
+ShaderPipeline::~ShaderPipeline()
+{
+    // Vertex array objects are not shared between contexts, they can only be deleted
+    // from the context that created them (otherwise they die with that context)
+    if (m_vertexArray && (Context::getActiveContextId() == m_contextId))
+        glCheck(GLEXT_glDeleteVertexArrays(1, &m_vertexArray));
+
+    if (m_streamBuffer.name || m_indexStreamBuffer.name)
+    {
+        const TransientContextLock contextLock;
+
+        if (m_streamBuffer.name)
+            glCheck(GLEXT_glDeleteBuffers(1, &m_streamBuffer.name));
+
+        if (m_indexStreamBuffer.name)
+            glCheck(GLEXT_glDeleteBuffers(1, &m_indexStreamBuffer.name));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool ShaderPipeline::isAvailable()
+{
+    static const bool available = []
+    {
+        if (!Shader::isAvailable())
+            return false;
+
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        ensureExtensionsInit();
+
+        return GLEXT_vertex_buffer_object && GLEXT_vertex_array_object && GLEXT_map_buffer_range &&
+               (ShaderPipelineImpl::getShadingLanguageVersion() >= 130);
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ShaderPipeline::isValid() const
+{
+    return m_vertexArray && m_streamBuffer.name && m_indexStreamBuffer.name;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t ShaderPipeline::getContextId() const
+{
+    return m_contextId;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShaderPipeline::stream(const Vertex* vertices, std::size_t vertexCount)
+{
+    return write(m_streamBuffer, GLEXT_GL_ARRAY_BUFFER, vertices, vertexCount * sizeof(Vertex)) / sizeof(Vertex);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShaderPipeline::streamIndices(const void* indices,
+                                          std::size_t indexCount,
+                                          bool        wide,
+                                          std::size_t firstVertex)
+{
+    // Rebasing the indices on the fly avoids relying on glDrawElementsBaseVertex (OpenGL 3.2)
+    // The streamed indices are always 32-bit, so the restart index of both formats becomes 0xFFFFFFFF
+    m_indices.resize(indexCount);
+
+    constexpr std::uint32_t restartIndex = 0xFFFFFFFF;
+    const auto              base         = static_cast<std::uint32_t>(firstVertex);
+    if (wide)
+    {
+        const auto* source = static_cast<const std::uint32_t*>(indices);
+        for (std::size_t i = 0; i < indexCount; ++i)
+            m_indices[i] = (source[i] == restartIndex) ? restartIndex : base + source[i];
+    }
+    else
+    {
+        const auto* source = static_cast<const std::uint16_t*>(indices);
+        for (std::size_t i = 0; i < indexCount; ++i)
+            m_indices[i] = (source[i] == 0xFFFF) ? restartIndex : base + std::uint32_t{source[i]};
+    }
+
+    return write(m_indexStreamBuffer,
+                 GLEXT_GL_ELEMENT_ARRAY_BUFFER,
+                 m_indices.data(),
+                 indexCount * sizeof(std::uint32_t));
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ShaderPipeline::getStreamBuffer() const
+{
+    return m_streamBuffer.name;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ShaderPipeline::getIndexStreamBuffer() const
+{
+    return m_indexStreamBuffer.name;
+}
+
+
+////////////////////////////////////////////////////////////
+void ShaderPipeline::invalidateProgram()
+{
+    m_defaultShaderBound = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void ShaderPipeline::prepareDraw(const RenderStates&          states,
+                                 const Transform&             modelViewProjection,
+                                 const std::array<float, 16>& textureMatrix,
+                                 unsigned int                 buffer,
+                                 std::size_t                  bufferOffset,
+                                 bool                         force)
+{
+    // Bind the built-in shader if the user didn't provide one
+    if (states.shader)
+    {
+        m_defaultShaderBound = false;
+    }
+    else if (force || !m_defaultShaderBound)
+    {
+        Shader::bind(&m_defaultShader);
+        m_defaultShaderBound = true;
+    }
+
+    const ProgramLayout& layout = states.shader ? getProgramLayout(*states.shader) : m_defaultLayout;
+
+    // Binding our own vertex array protects it from vertex array changes made outside of SFML
+    glCheck(GLEXT_glBindVertexArray(m_vertexArray));
+
+    // Point the attributes at the vertex buffer, only if they changed since the last draw
+    if (force || (layout.attributes != m_enabledAttributes) || (buffer != m_attributeBuffer) ||
+        (bufferOffset != m_attributeOffset))
+    {
+        for (const int location : m_enabledAttributes)
+        {
+            if (location >= 0)
+                glCheck(GLEXT_glDisableVertexAttribArray(static_cast<GLuint>(location)));
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, buffer));
+
+        static constexpr std::array<GLint, 3>     sizes       = {2, 4, 2};
+        static constexpr std::array<GLenum, 3>    types       = {GL_FLOAT, GL_UNSIGNED_BYTE, GL_FLOAT};
+        static constexpr std::array<GLboolean, 3> normalizeds = {GL_FALSE, GL_TRUE, GL_FALSE};
+
+        for (std::size_t i = 0; i < layout.attributes.size(); ++i)
+        {
+            if (layout.attributes[i] < 0)
+                continue;
+
+            const auto location = static_cast<GLuint>(layout.attributes[i]);
+            glCheck(GLEXT_glEnableVertexAttribArray(location));
+            glCheck(GLEXT_glVertexAttribPointer(location,
+                                                sizes[i],
+                                                types[i],
+                                                normalizeds[i],
+                                                sizeof(Vertex),
+                                                reinterpret_cast<const void*>(
+                                                    bufferOffset + ShaderPipelineImpl::attributeOffsets[i])));
+        }
+
+        m_enabledAttributes = layout.attributes;
+        m_attributeBuffer   = buffer;
+        m_attributeOffset   = bufferOffset;
+    }
+
+    // Set the built-in uniforms of the bound program
+    if (layout.modelViewProjection >= 0)
+        glCheck(GLEXT_glUniformMatrix4fv(layout.modelViewProjection, 1, GL_FALSE, modelViewProjection.getMatrix()));
+
+    if (layout.textureMatrix >= 0)
+        glCheck(GLEXT_glUniformMatrix4fv(layout.textureMatrix, 1, GL_FALSE, textureMatrix.data()));
+
+    if (layout.textureEnabled >= 0)
+        glCheck(GLEXT_glUniform1f(layout.textureEnabled, states.texture ? 1.f : 0.f));
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShaderPipeline::write(StreamBuffer& buffer, unsigned int target, const void* data, std::size_t size)
+{
+    glCheck(GLEXT_glBindBuffer(target, buffer.name));
+
+    if (size > buffer.capacity)
+    {
+        // Grow the buffer, this also orphans the previous storage
+        buffer.capacity = std::max(size, buffer.capacity * 2);
+        buffer.offset   = 0;
+        glCheck(GLEXT_glBufferData(target, static_cast<GLsizeiptrARB>(buffer.capacity), nullptr, GLEXT_GL_STREAM_DRAW));
+    }
+    else if (buffer.offset + size > buffer.capacity)
+    {
+        // Orphan the storage: the driver hands us fresh memory while
+        // the GPU keeps reading the old one for the pending draws
+        buffer.offset = 0;
+        glCheck(GLEXT_glBufferData(target, static_cast<GLsizeiptrARB>(buffer.capacity), nullptr, GLEXT_GL_STREAM_DRAW));
+    }
+
+    // The written range is never used by a pending draw, so no synchronization is needed
+    void* destination = nullptr;
+    glCheck(destination = GLEXT_glMapBufferRange(target,
+                                                 static_cast<GLintptr>(buffer.offset),
+                                                 static_cast<GLsizeiptr>(size),
+                                                 GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_INVALIDATE_RANGE_BIT |
+                                                     GLEXT_GL_MAP_UNSYNCHRONIZED_BIT));
+
+    if (destination)
+    {
+        std::memcpy(destination, data, size);
+        glCheck(GLEXT_glUnmapBuffer(target));
+    }
+    else
+    {
+        glCheck(GLEXT_glBufferSubData(target,
+                                      static_cast<GLintptrARB>(buffer.offset),
+                                      static_cast<GLsizeiptrARB>(size),
+                                      data));
+    }
+
+    const std::size_t offset = buffer.offset;
+    buffer.offset += size;
+
+    return offset;
+}
+
+
+////////////////////////////////////////////////////////////
+const ShaderPipeline::ProgramLayout& ShaderPipeline::getProgramLayout(const Shader& shader)
+{
+    // Program names are reused once deleted, the identifier tells whether the entry is still valid
+    ProgramLayout& layout = m_programLayouts[shader.m_shaderProgram];
+    if (layout.programId == shader.m_programId)
+        return layout;
+
+    const GLEXT_GLhandle program = ShaderPipelineImpl::getProgramHandle(shader);
+
+    layout           = {};
+    layout.programId = shader.m_programId;
+
+    for (std::size_t i = 0; i < layout.attributes.size(); ++i)
+        glCheck(layout.attributes[i] = GLEXT_glGetAttribLocation(program, ShaderPipelineImpl::attributeNames[i]));
+
+    glCheck(layout.modelViewProjection = GLEXT_glGetUniformLocation(program, "sf_modelViewProjection"));
+    glCheck(layout.textureMatrix = GLEXT_glGetUniformLocation(program, "sf_textureMatrix"));
+    glCheck(layout.textureEnabled = GLEXT_glGetUniformLocation(program, "sf_textureEnabled"));
+
+    return layout;
+}
+
+} // namespace sf::priv
+
+#else // SFML_OPENGL_ES
+
+// OpenGL ES 1 doesn't support shaders, provide an empty implementation
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+ShaderPipeline::ShaderPipeline() = default;
+
+
+////////////////////////////////////////////////////////////
+ShaderPipeline::~ShaderPipeline() = default;
+
+
+////////////////////////////////////////////////////////////
+bool ShaderPipeline::isAvailable()
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ShaderPipeline::isValid() const
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t ShaderPipeline::getContextId() const
+{
+    return m_contextId;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShaderPipeline::stream(const Vertex* /* vertices */, std::size_t /* vertexCount */)
+{
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShaderPipeline::streamIndices(const void* /* indices */,
+                                          std::size_t /* indexCount */,
+                                          bool /* wide */,
+                                          std::size_t /* firstVertex */)
+{
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ShaderPipeline::getStreamBuffer() const
+{
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ShaderPipeline::getIndexStreamBuffer() const
+{
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void ShaderPipeline::invalidateProgram()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void ShaderPipeline::prepareDraw(const RenderStates& /* states */,
+                                 const Transform& /* modelViewProjection */,
+                                 const std::array<float, 16>& /* textureMatrix */,
+                                 unsigned int /* buffer */,
+                                 std::size_t /* bufferOffset */,
+                                 bool /* force */)
+{
+}
+
+} // namespace sf::priv
+
+#endif // SFML_OPENGL_ES
@@ -0,0 +1,268 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Shader.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Transform;
+struct RenderStates;
+struct Vertex;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Shader-based rendering pipeline used by render targets
+///        that don't rely on the fixed-function pipeline
+///
+/// Vertices are streamed into a single vertex buffer object
+/// used as a ring buffer, and are rendered through a vertex
+/// array object and a built-in shader that reproduces the
+/// fixed-function behavior of SFML. The pipeline objects
+/// belong to the context that was active when the pipeline
+/// was created.
+///
+////////////////////////////////////////////////////////////
+class ShaderPipeline : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the pipeline objects in the active context
+    ///
+    ////////////////////////////////////////////////////////////
+    ShaderPipeline();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ShaderPipeline();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ShaderPipeline(const ShaderPipeline&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ShaderPipeline& operator=(const ShaderPipeline&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether the system supports the shader pipeline
+    ///
+    /// \return `true` if the shader pipeline is supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the pipeline objects were successfully created
+    ///
+    /// \return `true` if the pipeline can be used for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isValid() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the ID of the context owning the pipeline objects
+    ///
+    /// \return Context ID
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getContextId() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy vertices into the streaming buffer
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    ///
+    /// \return Index of the first copied vertex within the streaming buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t stream(const Vertex* vertices, std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy indices into the index streaming buffer
+    ///
+    /// The indices are converted to 32 bits and offset by
+    /// `firstVertex`, so that they refer to the vertices copied
+    /// by `stream`. The vertex array object must be bound, since
+    /// it records the index buffer binding.
+    ///
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param wide        Are the indices 32-bit instead of 16-bit?
+    /// \param firstVertex Index of the first vertex within the streaming buffer
+    ///
+    /// \return Offset of the first copied index within the index streaming buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t streamIndices(const void* indices,
+                                            std::size_t indexCount,
+                                            bool        wide,
+                                            std::size_t firstVertex);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the OpenGL name of the index streaming buffer
+    ///
+    /// \return Name of the streaming index buffer object
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getIndexStreamBuffer() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the OpenGL name of the streaming buffer
+    ///
+    /// \return Name of the streaming vertex buffer object
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getStreamBuffer() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Notify the pipeline that the bound program was changed
+    ///
+    /// The built-in shader is bound again on the next draw.
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidateProgram();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the program and vertex layout and set the built-in uniforms
+    ///
+    /// A user shader set in the render states must already be
+    /// bound, otherwise the built-in shader is bound.
+    ///
+    /// \param states              Render states used for drawing
+    /// \param modelViewProjection Combined view and model transform
+    /// \param textureMatrix       Matrix mapping texture coordinates to normalized coordinates
+    /// \param buffer              Vertex buffer object holding the vertices to draw
+    /// \param bufferOffset        Offset of the first vertex in the buffer, in bytes
+    /// \param force               Ignore the cached state and bind everything again?
+    ///
+    ////////////////////////////////////////////////////////////
+    void prepareDraw(const RenderStates&          states,
+                     const Transform&             modelViewProjection,
+                     const std::array<float, 16>& textureMatrix,
+                     unsigned int                 buffer,
+                     std::size_t                  bufferOffset,
+                     bool                         force);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Locations of the built-in inputs of a program
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ProgramLayout
+    {
+        std::array<int, 3> attributes{-1, -1, -1}; //!< Locations of the position, color and texture coordinates attributes
+        int                modelViewProjection{-1};  //!< Location of the model-view-projection matrix uniform
+        int                textureMatrix{-1};        //!< Location of the texture matrix uniform
+        int                textureEnabled{-1};       //!< Location of the texture enabled uniform
+        std::uint64_t      programId{};              //!< Identifier of the program the locations were queried from
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    using ProgramLayoutTable = std::unordered_map<unsigned int, ProgramLayout>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Ring buffer used to stream data to the GPU
+    ///
+    ////////////////////////////////////////////////////////////
+    struct StreamBuffer
+    {
+        unsigned int name{};     //!< Buffer object
+        std::size_t  capacity{}; //!< Size of the buffer, in bytes
+        std::size_t  offset{};   //!< Write position in the buffer, in bytes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy data into a streaming buffer
+    ///
+    /// \param buffer Streaming buffer to write to
+    /// \param target Binding point used to write to the buffer
+    /// \param data   Pointer to the data
+    /// \param size   Size of the data, in bytes
+    ///
+    /// \return Offset of the copied data within the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::size_t write(StreamBuffer& buffer,
+                                           unsigned int  target,
+                                           const void*   data,
+                                           std::size_t   size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the locations of the built-in inputs of a program
+    ///
+    /// The locations are only queried the first time a program
+    /// is used, and again after the shader is reloaded.
+    ///
+    /// \param shader Shader to query
+    ///
+    /// \return Layout of the program
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const ProgramLayout& getProgramLayout(const Shader& shader);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::uint64_t              m_contextId{};                   //!< Context owning the vertex array object
+    unsigned int               m_vertexArray{};                 //!< Vertex array object
+    StreamBuffer               m_streamBuffer;                  //!< Streaming vertex buffer
+    StreamBuffer               m_indexStreamBuffer;             //!< Streaming index buffer
+    std::vector<std::uint32_t> m_indices;                       //!< Indices converted before being streamed
+    Shader                     m_defaultShader;                 //!< Built-in shader emulating fixed-function rendering
+    ProgramLayout              m_defaultLayout;                 //!< Layout of the built-in shader
+    bool                       m_defaultShaderBound{};          //!< Is the built-in shader currently bound?
+    std::array<int, 3>         m_enabledAttributes{-1, -1, -1}; //!< Attribute locations enabled in the vertex array
+    unsigned int               m_attributeBuffer{};             //!< Buffer the enabled attributes currently point to
+    std::size_t                m_attributeOffset{};             //!< Offset in the buffer the attributes point to
+    ProgramLayoutTable         m_programLayouts;                //!< Layouts of the programs used so far, by name
+};
+
+} // namespace priv
+} // namespace sf
@@ -0,0 +1,489 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/SpriteBatch.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Transform.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <mutex>
+#include <ostream>
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+
+namespace
+{
+namespace SpriteBatchImpl
+{
+// Corners of the unit quad, in triangle strip order
+// The instancing program scales them by the size of the texture rectangle
+constexpr std::array<sf::Vector2f, 4> quadCorners = {{{0.f, 0.f}, {0.f, 1.f}, {1.f, 0.f}, {1.f, 1.f}}};
+
+// Order in which the quad corners are emitted as a triangle list
+constexpr std::array<std::size_t, 6> triangleCorners = {0, 1, 2, 2, 1, 3};
+
+// Instanced vertex shader: expands the unit quad using the per-instance attributes
+constexpr const char* vertexShader = R"(
+#version 110
+
+attribute vec3 transformRow0;
+attribute vec3 transformRow1;
+attribute vec4 textureRect;
+attribute vec4 instanceColor;
+
+void main()
+{
+    vec2 corner      = gl_Vertex.xy;
+    vec3 position    = vec3(corner * abs(textureRect.zw), 1.0);
+    vec2 transformed = vec2(dot(transformRow0, position), dot(transformRow1, position));
+
+    gl_Position    = gl_ModelViewProjectionMatrix * vec4(transformed, 0.0, 1.0);
+    gl_TexCoord[0] = gl_TextureMatrix[0] * vec4(textureRect.xy + corner * textureRect.zw, 0.0, 1.0);
+    gl_FrontColor  = instanceColor;
+}
+)";
+
+// Fragment shader: identical to the fixed-function textured output
+constexpr const char* fragmentShader = R"(
+#version 110
+
+uniform sampler2D sourceTexture;
+
+void main()
+{
+    gl_FragColor = gl_Color * texture2D(sourceTexture, gl_TexCoord[0].xy);
+}
+)";
+
+////////////////////////////////////////////////////////////
+std::array<float, 6> toTransformRows(const sf::Transform& transform)
+{
+    const float* matrix = transform.getMatrix();
+    return {matrix[0], matrix[4], matrix[12], matrix[1], matrix[5], matrix[13]};
+}
+
+
+////////////////////////////////////////////////////////////
+std::array<float, 4> toTextureRect(const sf::IntRect& textureRect)
+{
+    const auto [position, size] = sf::FloatRect(textureRect);
+    return {position.x, position.y, size.x, size.y};
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Vector2f getAbsoluteSize(const std::array<float, 4>& textureRect)
+{
+    // Absolute value is used to support negative texture rect sizes, like sf::Sprite
+    return {std::abs(textureRect[2]), std::abs(textureRect[3])};
+}
+
+
+////////////////////////////////////////////////////////////
+GLint getAttributeLocation(const sf::Shader& shader, const char* name)
+{
+#if defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS)
+    const auto program = reinterpret_cast<GLEXT_GLhandle>(std::ptrdiff_t{shader.getNativeHandle()});
+#else
+    const auto program = shader.getNativeHandle();
+#endif
+
+    return GLEXT_glGetAttribLocation(program, name);
+}
+} // namespace SpriteBatchImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct SpriteBatch::InstancingProgram : private GlResource
+{
+    Shader               shader;                      //!< Built-in instancing shader
+    std::array<GLint, 4> attributes{-1, -1, -1, -1}; //!< Locations of the per-instance attributes
+    bool                 valid{};                     //!< Did the program compile and expose all its attributes?
+
+    ////////////////////////////////////////////////////////////
+    InstancingProgram()
+    {
+        if (!shader.loadFromMemory(SpriteBatchImpl::vertexShader, SpriteBatchImpl::fragmentShader))
+        {
+            err() << "Failed to compile the sprite batch instancing shader, falling back to CPU expansion" << std::endl;
+            return;
+        }
+
+        shader.setUniform("sourceTexture", Shader::CurrentTexture);
+
+        const TransientContextLock contextLock;
+
+        static constexpr std::array<const char*, 4> names = {"transformRow0",
+                                                             "transformRow1",
+                                                             "textureRect",
+                                                             "instanceColor"};
+        for (std::size_t i = 0; i < names.size(); ++i)
+            glCheck(attributes[i] = SpriteBatchImpl::getAttributeLocation(shader, names[i]));
+
+        valid = std::all_of(attributes.begin(), attributes.end(), [](GLint location) { return location >= 0; });
+    }
+
+    ////////////////////////////////////////////////////////////
+    static bool isSupported()
+    {
+        if (!Shader::isAvailable())
+            return false;
+
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return (GLEXT_draw_instanced != 0) && (GLEXT_instanced_arrays != 0);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // To save on program objects, all sprite batches share a
+    // single instancing program, destroyed with the last batch
+    static std::shared_ptr<InstancingProgram> get()
+    {
+        struct ProgramCache
+        {
+            std::mutex                       mutex;
+            std::weak_ptr<InstancingProgram> program;
+        };
+        static ProgramCache   programCache;
+        const std::lock_guard lock(programCache.mutex);
+
+        auto program = programCache.program.lock();
+
+        if (!program)
+        {
+            program              = std::make_shared<InstancingProgram>();
+            programCache.program = program;
+        }
+
+        return program;
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+SpriteBatch::SpriteBatch(const Texture& texture) : m_texture(&texture)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setTexture(const Texture& texture)
+{
+    m_texture = &texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& SpriteBatch::getTexture() const
+{
+    return *m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::add(const Transform& transform, const IntRect& textureRect, Color color)
+{
+    m_transforms.push_back(SpriteBatchImpl::toTransformRows(transform));
+    m_textureRects.push_back(SpriteBatchImpl::toTextureRect(textureRect));
+    m_colors.push_back(color);
+    m_verticesNeedUpdate = true;
+
+    return m_colors.size() - 1;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::add(const Sprite& sprite)
+{
+    return add(sprite.getTransform(), sprite.getTextureRect(), sprite.getColor());
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setInstanceTransform(std::size_t index, const Transform& transform)
+{
+    assert(index < m_transforms.size() && "Index is out of bounds");
+    m_transforms[index]  = SpriteBatchImpl::toTransformRows(transform);
+    m_verticesNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setInstanceTextureRect(std::size_t index, const IntRect& textureRect)
+{
+    assert(index < m_textureRects.size() && "Index is out of bounds");
+    m_textureRects[index] = SpriteBatchImpl::toTextureRect(textureRect);
+    m_verticesNeedUpdate  = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setInstanceColor(std::size_t index, Color color)
+{
+    assert(index < m_colors.size() && "Index is out of bounds");
+    m_colors[index]      = color;
+    m_verticesNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+Transform SpriteBatch::getInstanceTransform(std::size_t index) const
+{
+    assert(index < m_transforms.size() && "Index is out of bounds");
+    const auto& rows = m_transforms[index];
+    return {rows[0], rows[1], rows[2], rows[3], rows[4], rows[5], 0.f, 0.f, 1.f};
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect SpriteBatch::getInstanceTextureRect(std::size_t index) const
+{
+    assert(index < m_textureRects.size() && "Index is out of bounds");
+    const auto& rect = m_textureRects[index];
+    return IntRect(FloatRect({rect[0], rect[1]}, {rect[2], rect[3]}));
+}
+
+
+////////////////////////////////////////////////////////////
+Color SpriteBatch::getInstanceColor(std::size_t index) const
+{
+    assert(index < m_colors.size() && "Index is out of bounds");
+    return m_colors[index];
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::getInstanceCount() const
+{
+    return m_colors.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::reserve(std::size_t instanceCount)
+{
+    m_transforms.reserve(instanceCount);
+    m_textureRects.reserve(instanceCount);
+    m_colors.reserve(instanceCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::clear()
+{
+    m_transforms.clear();
+    m_textureRects.clear();
+    m_colors.clear();
+    m_vertices.clear();
+    m_verticesNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect SpriteBatch::getLocalBounds() const
+{
+    if (m_colors.empty())
+        return {};
+
+    Vector2f min(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    Vector2f max(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+
+    for (std::size_t i = 0; i < m_colors.size(); ++i)
+    {
+        const FloatRect bounds = getInstanceTransform(i).transformRect(
+            {{0.f, 0.f}, SpriteBatchImpl::getAbsoluteSize(m_textureRects[i])});
+
+        min.x = std::min(min.x, bounds.position.x);
+        min.y = std::min(min.y, bounds.position.y);
+        max.x = std::max(max.x, bounds.position.x + bounds.size.x);
+        max.y = std::max(max.y, bounds.position.y + bounds.size.y);
+    }
+
+    return {min, max - min};
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect SpriteBatch::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+bool SpriteBatch::isInstancingAvailable()
+{
+    static const bool available = InstancingProgram::isSupported();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_colors.empty())
+        return;
+
+    states.transform *= getTransform();
+    states.texture        = m_texture;
+    states.coordinateType = CoordinateType::Pixels;
+
+    // Custom shaders expect regular vertices, so they always go through the CPU expansion
+    if (!states.shader && isInstancingAvailable())
+    {
+        if (!m_program)
+            m_program = InstancingProgram::get();
+
+        if (m_program->valid)
+        {
+            states.shader = &m_program->shader;
+
+            if (target.beginCustomDraw(states))
+            {
+                // The unit quad is the only per-vertex data, everything else is per-instance
+                static const std::array<Vertex, 4> quad = [] {
+                    std::array<Vertex, 4> vertices;
+                    for (std::size_t i = 0; i < vertices.size(); ++i)
+                        vertices[i].position = vertices[i].texCoords = SpriteBatchImpl::quadCorners[i];
+                    return vertices;
+                }();
+
+                const auto* data = reinterpret_cast<const std::byte*>(quad.data());
+                glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
+                glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
+                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+
+                const auto& attributes = m_program->attributes;
+                const auto  setupAttribute = [](GLint       location,
+                                                GLint       size,
+                                                GLenum      type,
+                                                GLboolean   normalized,
+                                                GLsizei     stride,
+                                                const void* pointer)
+                {
+                    const auto index = static_cast<GLuint>(location);
+                    glCheck(GLEXT_glEnableVertexAttribArray(index));
+                    glCheck(GLEXT_glVertexAttribPointer(index, size, type, normalized, stride, pointer));
+                    glCheck(GLEXT_glVertexAttribDivisor(index, 1));
+                };
+
+                constexpr auto transformStride = static_cast<GLsizei>(sizeof(m_transforms[0]));
+                setupAttribute(attributes[0], 3, GL_FLOAT, GL_FALSE, transformStride, m_transforms.data()->data());
+                setupAttribute(attributes[1], 3, GL_FLOAT, GL_FALSE, transformStride, m_transforms.data()->data() + 3);
+                setupAttribute(attributes[2],
+                               4,
+                               GL_FLOAT,
+                               GL_FALSE,
+                               static_cast<GLsizei>(sizeof(m_textureRects[0])),
+                               m_textureRects.data());
+                setupAttribute(attributes[3],
+                               4,
+                               GL_UNSIGNED_BYTE,
+                               GL_TRUE,
+                               static_cast<GLsizei>(sizeof(Color)),
+                               m_colors.data());
+
+                glCheck(GLEXT_glDrawArraysInstanced(GL_TRIANGLE_STRIP,
+                                                    0,
+                                                    static_cast<GLsizei>(quad.size()),
+                                                    static_cast<GLsizei>(m_colors.size())));
+
+                // Leave the generic attributes in their default state for other draws
+                for (const GLint location : attributes)
+                {
+                    glCheck(GLEXT_glVertexAttribDivisor(static_cast<GLuint>(location), 0));
+                    glCheck(GLEXT_glDisableVertexAttribArray(static_cast<GLuint>(location)));
+                }
+
+                target.endCustomDraw(states, quad.size() * m_colors.size());
+                return;
+            }
+
+            // The target doesn't support custom draws, fall back to the CPU expansion
+            states.shader = nullptr;
+        }
+    }
+
+    ensureVerticesUpdate();
+    target.draw(m_vertices.data(), m_vertices.size(), PrimitiveType::Triangles, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::ensureVerticesUpdate() const
+{
+    if (!m_verticesNeedUpdate)
+        return;
+
+    m_vertices.resize(m_colors.size() * SpriteBatchImpl::triangleCorners.size());
+
+    auto vertex = m_vertices.begin();
+    for (std::size_t i = 0; i < m_colors.size(); ++i)
+    {
+        const Transform transform   = getInstanceTransform(i);
+        const auto&     textureRect = m_textureRects[i];
+        const Vector2f  absSize     = SpriteBatchImpl::getAbsoluteSize(textureRect);
+        const Vector2f  texPosition(textureRect[0], textureRect[1]);
+        const Vector2f  texSize(textureRect[2], textureRect[3]);
+
+        for (const std::size_t corner : SpriteBatchImpl::triangleCorners)
+        {
+            const Vector2f unit = SpriteBatchImpl::quadCorners[corner];
+
+            vertex->position  = transform.transformPoint(unit.componentWiseMul(absSize));
+            vertex->color     = m_colors[i];
+            vertex->texCoords = texPosition + unit.componentWiseMul(texSize);
+            ++vertex;
+        }
+    }
+
+    m_verticesNeedUpdate = false;
+}
+
+} // namespace sf
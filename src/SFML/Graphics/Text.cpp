@@ -27,15 +27,23 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <SFML/System/Err.hpp>
+
 #include <SheenBidi/SheenBidi.h>
 #include <algorithm>
+#include <array>
+#include <functional>
 #include <hb-ft.h>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <mutex>
+#include <ostream>
+#include <unordered_map>
 #include <utility>
 
 #include <cassert>
@@ -89,9 +97,14 @@ void addLineVertical(sf::VertexArray& vertices,
 }
 
 // Add a glyph quad to the vertex array
-void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, sf::Color color, const sf::Glyph& glyph, float italicShear)
+void addGlyphQuad(sf::VertexArray& vertices,
+                  sf::Vector2f     position,
+                  sf::Color        color,
+                  const sf::Glyph& glyph,
+                  float            italicShear,
+                  float            glyphPadding)
 {
-    const sf::Vector2f padding(1.0f, 1.0f);
+    const sf::Vector2f padding(glyphPadding, glyphPadding);
 
     const sf::Vector2f p1 = glyph.bounds.position - padding;
     const sf::Vector2f p2 = glyph.bounds.position + glyph.bounds.size + padding;
@@ -107,6 +120,101 @@ void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, sf::Color co
     vertices.append({position + sf::Vector2f(p2.x - italicShear * p2.y, p2.y), color, {uv2.x, uv2.y}});
 }
 
+// Fragment shader rendering distance field glyphs, outlines are
+// obtained by moving the edge outwards by the given offset
+constexpr const char* distanceFieldShaderSource = R"(
+uniform sampler2D texture;
+uniform float offset;
+
+void main()
+{
+    // Distance to the edge of the glyph, positive inside
+    float distance = texture2D(texture, gl_TexCoord[0].xy).a - 0.5 + offset;
+
+    // Smooth the edge over about one pixel on screen
+    float width = max(fwidth(distance) * 0.5, 0.0001);
+    float alpha = smoothstep(-width, width, distance);
+
+    gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);
+}
+)";
+
+// Same shader for targets rendering through the shader pipeline, which have no fixed-function stage
+// Core profiles are at least OpenGL 3.2, so GLSL 1.50 is always supported
+constexpr const char* distanceFieldCoreVertexShaderSource = R"(#version 150
+in vec2 sf_position;
+in vec4 sf_color;
+in vec2 sf_texCoords;
+
+uniform mat4 sf_modelViewProjection;
+uniform mat4 sf_textureMatrix;
+
+out vec4 sf_vertexColor;
+out vec2 sf_vertexTexCoords;
+
+void main()
+{
+    gl_Position        = sf_modelViewProjection * vec4(sf_position, 0.0, 1.0);
+    sf_vertexTexCoords = (sf_textureMatrix * vec4(sf_texCoords, 0.0, 1.0)).xy;
+    sf_vertexColor     = sf_color;
+}
+)";
+
+constexpr const char* distanceFieldCoreFragmentShaderSource = R"(#version 150
+in vec4 sf_vertexColor;
+in vec2 sf_vertexTexCoords;
+
+uniform sampler2D sf_texture;
+uniform float     offset;
+
+out vec4 sf_fragmentColor;
+
+void main()
+{
+    float distance = texture(sf_texture, sf_vertexTexCoords).a - 0.5 + offset;
+    float width    = max(fwidth(distance) * 0.5, 0.0001);
+    float alpha    = smoothstep(-width, width, distance);
+
+    sf_fragmentColor = vec4(sf_vertexColor.rgb, sf_vertexColor.a * alpha);
+}
+)";
+
+// Get the shader rendering distance field glyphs in the calling thread
+// Texts change the offset uniform while drawing, so each thread owns its shaders
+sf::Shader* getDistanceFieldShader(bool shaderPipeline)
+{
+    struct ShaderCache
+    {
+        std::unique_ptr<sf::Shader> shader;
+        bool                        failed{};
+    };
+    thread_local std::array<ShaderCache, 2> shaderCaches;
+    ShaderCache&                            shaderCache = shaderCaches[shaderPipeline ? 1 : 0];
+
+    if (shaderCache.shader)
+        return shaderCache.shader.get();
+
+    // Don't try again if the shader cannot be compiled
+    if (shaderCache.failed || !sf::Shader::isAvailable())
+        return nullptr;
+
+    auto       shader = std::make_unique<sf::Shader>();
+    const bool loaded = shaderPipeline ? shader->loadFromMemory(distanceFieldCoreVertexShaderSource,
+                                                                distanceFieldCoreFragmentShaderSource)
+                                       : shader->loadFromMemory(distanceFieldShaderSource, sf::Shader::Type::Fragment);
+    if (!loaded)
+    {
+        sf::err() << "Failed to compile the distance field text shader, distance field glyphs will be blurry"
+                  << std::endl;
+        shaderCache.failed = true;
+        return nullptr;
+    }
+
+    shader->setUniform(shaderPipeline ? "sf_texture" : "texture", sf::Shader::CurrentTexture);
+    shaderCache.shader = std::move(shader);
+    return shaderCache.shader.get();
+}
+
 struct TextSegment
 {
     std::size_t    offset{};
@@ -115,19 +223,20 @@ struct TextSegment
     hb_direction_t direction{};
 };
 
-// Split string into segments with uniform text properties
-std::vector<TextSegment> segmentString(const sf::String& input)
+// Split string into segments with uniform text properties, starting at the given paragraph
+// Paragraphs are processed independently, so segments don't depend on the previous paragraphs
+std::vector<TextSegment> segmentString(const sf::String& input, std::size_t offset)
 {
     std::vector<TextSegment> segments;
 
-    const SBCodepointSequence codepointSequence{SBStringEncodingUTF32,
-                                                static_cast<const void*>(input.getData()),
-                                                input.getSize()};
+    const char32_t* const     data   = input.getData() + offset;
+    const std::size_t         length = input.getSize() - offset;
+    const SBCodepointSequence codepointSequence{SBStringEncodingUTF32, static_cast<const void*>(data), length};
     auto* const               scriptLocator   = SBScriptLocatorCreate();
     auto* const               algorithm       = SBAlgorithmCreate(&codepointSequence);
     SBUInteger                paragraphOffset = 0;
 
-    while (paragraphOffset < input.getSize())
+    while (paragraphOffset < length)
     {
         SBUInteger paragraphLength{};
         SBUInteger separatorLength{};
@@ -156,7 +265,7 @@ std::vector<TextSegment> segmentString(const sf::String& input)
             const auto direction = (runArray[i].level % 2) ? HB_DIRECTION_RTL : HB_DIRECTION_LTR;
 
             const SBCodepointSequence codepointSubsequence{SBStringEncodingUTF32,
-                                                           static_cast<const void*>(input.getData() + runArray[i].offset),
+                                                           static_cast<const void*>(data + runArray[i].offset),
                                                            runArray[i].length};
 
             SBScriptLocatorLoadCodepoints(scriptLocator, &codepointSubsequence);
@@ -166,7 +275,8 @@ std::vector<TextSegment> segmentString(const sf::String& input)
                 const auto* agent  = SBScriptLocatorGetAgent(scriptLocator);
                 const auto  script = hb_script_from_iso15924_tag(SBScriptGetUnicodeTag(agent->script));
 
-                segments.emplace_back(TextSegment{runArray[i].offset + agent->offset, agent->length, script, direction});
+                segments.emplace_back(
+                    TextSegment{offset + runArray[i].offset + agent->offset, agent->length, script, direction});
             }
 
             SBScriptLocatorReset(scriptLocator);
@@ -196,62 +306,107 @@ struct Text::ShaperImpl
     // FreeType face and a specific character size
     // If we need to shape text using another font or another
     // character size we will have to create a new shaper
-    ShaperImpl(void* fontHandle, std::uint64_t theFontId, unsigned int theCharacterSize) :
+    ShaperImpl(void* fontHandle, std::uint64_t theFontId, unsigned int theCharacterSize, bool theOutline) :
         fontId(theFontId),
         characterSize(theCharacterSize),
-        shaper(hb_ft_font_create(static_cast<FT_Face>(fontHandle), nullptr)),
-        shapingBuffer(hb_buffer_create())
+        outline(theOutline),
+        shaper(hb_ft_font_create(static_cast<FT_Face>(fontHandle), nullptr))
     {
         // Make HarfBuzz use FreeType font functions
         hb_ft_font_set_funcs(shaper.get());
+
+        // Set load flags analogous to the Font implementation
+        // They are fixed for the lifetime of the shaper, since
+        // changing them while other threads are shaping would
+        // affect their results
+        FT_Int32 flags = FT_LOAD_TARGET_NORMAL;
+        if (outline)
+            flags |= FT_LOAD_NO_BITMAP;
+        hb_ft_font_set_load_flags(shaper.get(), flags);
+
+        // Shapers are shared by all threads, prevent any further modification
+        hb_font_make_immutable(shaper.get());
+    }
+
+    // Key identifying shapers in the caches
+    struct Key
+    {
+        std::uint64_t fontId{};
+        unsigned int  characterSize{};
+        bool          outline{};
+
+        bool operator==(const Key& other) const
+        {
+            return (fontId == other.fontId) && (characterSize == other.characterSize) && (outline == other.outline);
+        }
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const
+        {
+            const std::uint64_t combined = (key.fontId << 32) ^ (std::uint64_t{key.characterSize} << 1) ^ key.outline;
+            return std::hash<std::uint64_t>{}(combined);
+        }
+    };
+
+    using Cache = std::unordered_map<Key, std::weak_ptr<ShaperImpl>, KeyHash>;
+
+    // Remove the cache entries of the shapers which are not used anymore
+    static void removeStaleEntries(Cache& cache)
+    {
+        for (auto iter = cache.begin(); iter != cache.end();)
+            iter = iter->second.expired() ? cache.erase(iter) : std::next(iter);
     }
 
     // To save on memory, instead of every sf::Text object having
     // its own shaper, we try to share shapers among multiple
     // sf::Text objects if they all reference the same font and
     // want to shape text at the same character size
-    // Because we are allowing simultaneous access to shapers
-    // from multiple sf::Text objects we have to guard both the
-    // shaper cache and the shaper objects (which contain buffers)
-    // themselves using mutexes
-    static std::shared_ptr<ShaperImpl> getShaper(void* fontHandle, std::uint64_t fontId, unsigned int characterSize)
+    // Each thread first looks the shaper up in its own cache,
+    // so that threads laying out text concurrently only have
+    // to lock the shared cache the first time they need a shaper
+    static std::shared_ptr<ShaperImpl> getShaper(void*         fontHandle,
+                                                 std::uint64_t fontId,
+                                                 unsigned int  characterSize,
+                                                 bool          outline)
     {
-        // Our shaper cache
+        const Key key{fontId, characterSize, outline};
+
+        thread_local Cache localCache;
+        if (const auto iter = localCache.find(key); iter != localCache.end())
+        {
+            if (auto shaper = iter->second.lock())
+                return shaper;
+        }
+
+        // Our shared shaper cache
         struct ShaperCache
         {
-            std::mutex                             mutex;
-            std::vector<std::weak_ptr<ShaperImpl>> cache;
+            std::mutex mutex;
+            Cache      cache;
         };
-        static ShaperCache    shaperCache;
-        const std::lock_guard lock(shaperCache.mutex);
+        static ShaperCache shaperCache;
 
         std::shared_ptr<ShaperImpl> result;
 
-        // Iterate over the cache looking for a font ID and character size match
-        // while at the same time cleaning out stale cache entries
-        for (auto iter = shaperCache.cache.begin(); iter != shaperCache.cache.end();)
         {
-            if (auto shaper = iter->lock(); !shaper)
-            {
-                // Remove stale entries
-                iter = shaperCache.cache.erase(iter);
-            }
-            else
-            {
-                if (shaper->fontId == fontId && shaper->characterSize == characterSize)
-                    result = std::move(shaper);
+            const std::lock_guard lock(shaperCache.mutex);
+
+            auto& entry = shaperCache.cache[key];
+            result      = entry.lock();
 
-                // Don't break even if we find a match since we want to finish cleaning up
-                ++iter;
+            if (!result)
+            {
+                // We didn't find a cached shaper, create a new one
+                removeStaleEntries(shaperCache.cache);
+                result                 = std::make_shared<ShaperImpl>(fontHandle, fontId, characterSize, outline);
+                shaperCache.cache[key] = result;
             }
         }
 
-        if (!result)
-        {
-            // We didn't find a cached shaper, create a new one
-            result = std::make_shared<ShaperImpl>(fontHandle, fontId, characterSize);
-            shaperCache.cache.emplace_back(result);
-        }
+        removeStaleEntries(localCache);
+        localCache[key] = result;
 
         return result;
     }
@@ -274,8 +429,7 @@ struct Text::ShaperImpl
         hb_direction_t                    direction,
         sf::Text::TextOrientation         orientation,
         sf::Text::ClusterGrouping         clusterGrouping,
-        float                             outlineThickness,
-        std::uint32_t                     style)
+        std::uint32_t                     style) const
     {
         assert(input.getSize() == indices.size() && "Input string length does not match indices count");
 
@@ -289,8 +443,9 @@ struct Text::ShaperImpl
             direction = HB_DIRECTION_BTT;
         }
 
-        const std::lock_guard lock(mutex);
-        auto*                 buffer = shapingBuffer.get();
+        // Shaping buffers are per thread, so that threads sharing the shaper can use it concurrently
+        thread_local const std::unique_ptr<hb_buffer_t, ShaperBufferDeleter> shapingBuffer(hb_buffer_create());
+        auto* const                                                        buffer = shapingBuffer.get();
 
         // Clear out and add the input to the buffer
         hb_buffer_clear_contents(buffer);
@@ -325,12 +480,6 @@ struct Text::ShaperImpl
                 break;
         }
 
-        // Set load flags analogous to the Font implementation
-        FT_Int32 flags = FT_LOAD_TARGET_NORMAL;
-        if (outlineThickness != 0)
-            flags |= FT_LOAD_NO_BITMAP;
-        hb_ft_font_set_load_flags(shaper.get(), flags);
-
         // Shape the text
         hb_shape(shaper.get(), buffer, nullptr, 0);
 
@@ -391,11 +540,10 @@ struct Text::ShaperImpl
         }
     };
 
-    std::mutex                                        mutex;           //!< Mutex guarding our shaper and shaping buffer
-    const std::uint64_t                               fontId{};        //!< Font ID this shaper is linked to
-    const unsigned int                                characterSize{}; //!< Character size this shaper was created with
-    std::unique_ptr<hb_font_t, ShaperDeleter>         shaper;          //!< Our shaper
-    std::unique_ptr<hb_buffer_t, ShaperBufferDeleter> shapingBuffer;   //!< The buffer to perform shaping with
+    const std::uint64_t                       fontId{};        //!< Font ID this shaper is linked to
+    const unsigned int                        characterSize{}; //!< Character size this shaper was created with
+    const bool                                outline{};       //!< Does this shaper load glyphs for outlines?
+    std::unique_ptr<hb_font_t, ShaperDeleter> shaper;          //!< Our shaper
 };
 
 
@@ -411,7 +559,13 @@ Text::Text(const Font& font, String string, unsigned int characterSize) :
 ////////////////////////////////////////////////////////////
 void Text::setString(const String& string)
 {
-    if (m_string != string)
+    if ((string.getSize() > m_string.getSize()) && std::equal(m_string.begin(), m_string.end(), string.begin()))
+    {
+        // Characters appended to the string only require its last line to be laid out again
+        m_string         = string;
+        m_stringAppended = true;
+    }
+    else if (m_string != string)
     {
         m_string             = string;
         m_geometryNeedUpdate = true;
@@ -419,6 +573,17 @@ void Text::setString(const String& string)
 }
 
 
+////////////////////////////////////////////////////////////
+void Text::appendString(const String& string)
+{
+    if (!string.isEmpty())
+    {
+        m_string += string;
+        m_stringAppended = true;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void Text::setFont(const Font& font)
 {
@@ -746,37 +911,138 @@ void Text::draw(RenderTarget& target, RenderStates states) const
     states.texture        = &m_font->getTexture(m_characterSize);
     states.coordinateType = CoordinateType::Pixels;
 
+    // Distance field glyphs need the built-in shader, unless the user provides their own
+    Shader* distanceFieldShader = nullptr;
+    if (!states.shader && m_font->isDistanceFieldActive())
+    {
+        distanceFieldShader = getDistanceFieldShader(target.isShaderPipelineEnabled());
+        states.shader       = distanceFieldShader;
+    }
+
     // Only draw the outline if there is something to draw
     if (m_outlineVertices.getVertexCount() > 0)
-        target.draw(m_outlineVertices, states);
+    {
+        if (distanceFieldShader)
+            distanceFieldShader->setUniform("offset",
+                                            m_font->getDistanceFieldOffset(m_outlineThickness, m_characterSize));
+
+        drawTextureRanges(target, states, m_outlineVertices, m_outlineTextureRanges);
+    }
+
+    if (distanceFieldShader)
+        distanceFieldShader->setUniform("offset", 0.f);
+
+    drawTextureRanges(target, states, m_vertices, m_textureRanges);
+}
+
 
-    target.draw(m_vertices, states);
+////////////////////////////////////////////////////////////
+void Text::drawTextureRanges(RenderTarget&                    target,
+                             RenderStates                     states,
+                             const VertexArray&               vertices,
+                             const std::vector<TextureRange>& ranges) const
+{
+    // All the glyphs are in the first font texture: draw everything at once
+    if (ranges.empty())
+    {
+        target.draw(vertices, states);
+        return;
+    }
+
+    for (std::size_t i = 0; i < ranges.size(); ++i)
+    {
+        const std::size_t begin = ranges[i].vertexOffset;
+        const std::size_t end   = (i + 1 < ranges.size()) ? ranges[i + 1].vertexOffset : vertices.getVertexCount();
+        if (begin == end)
+            continue;
+
+        states.texture = &m_font->getTexture(m_characterSize, ranges[i].textureIndex);
+        target.draw(&vertices[begin], end - begin, PrimitiveType::Triangles, states);
+    }
 }
 
 
 ////////////////////////////////////////////////////////////
 void Text::ensureGeometryUpdate() const
 {
+    // Glyphs which were still being loaded by the font during the last update may be available now
+    const bool glyphsLoaded = m_glyphsPending && (m_font->getGlyphGeneration() != m_fontGlyphGeneration);
+
+    // Whether the font texture changed, e.g. because the font was reloaded
+    const bool fontTextureChanged = m_font->getTexture(m_characterSize).m_cacheId != m_fontTextureId;
+
     // Do nothing, if geometry has not changed and the font texture has not changed
-    if (!m_geometryNeedUpdate && m_font->getTexture(m_characterSize).m_cacheId == m_fontTextureId)
+    if (!m_geometryNeedUpdate && !m_stringAppended && !glyphsLoaded && !fontTextureChanged)
         return;
 
+    // If characters were only appended to the string, the lines before
+    // the last one are unchanged and only the last one is laid out again
+    const bool isIncremental = !m_geometryNeedUpdate && !glyphsLoaded && !fontTextureChanged && !m_lines.empty();
+
     // Save the current fonts texture id
     m_fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
 
+    // Save the current fonts glyph generation, to know when missing glyphs are loaded
+    // (the lines kept by an incremental update may still be waiting for some)
+    m_fontGlyphGeneration = m_font->getGlyphGeneration();
+    m_glyphsPending       = isIncremental && m_glyphsPending;
+
+    // Remember whether glyphs are still being loaded by the font
+    const auto trackGlyph = [this](const Glyph& glyph) -> const Glyph&
+    {
+        if (m_font->isGlyphPending(glyph))
+            m_glyphsPending = true;
+
+        return glyph;
+    };
+
     // Mark geometry as updated
     m_geometryNeedUpdate = false;
+    m_stringAppended     = false;
+
+    // Clear the previous geometry, or only the one of the last line when updating incrementally
+    LineRecord resumedLine;
+    if (isIncremental)
+    {
+        // Forget where the geometry of the removed vertices switched to other font textures
+        const auto truncateTextureRanges = [](std::vector<TextureRange>& ranges, std::size_t vertexCount)
+        {
+            while (!ranges.empty() && (ranges.back().vertexOffset >= vertexCount))
+                ranges.pop_back();
+
+            if ((ranges.size() == 1) && (ranges.front().textureIndex == 0))
+                ranges.clear();
+        };
+
+        resumedLine = m_lines.back();
+        m_lines.pop_back();
+
+        m_vertices.resize(resumedLine.verticesStart);
+        m_outlineVertices.resize(resumedLine.outlineVerticesStart);
+        truncateTextureRanges(m_textureRanges, resumedLine.verticesStart);
+        truncateTextureRanges(m_outlineTextureRanges, resumedLine.outlineVerticesStart);
+        m_glyphs.erase(m_glyphs.begin() + static_cast<std::ptrdiff_t>(resumedLine.glyphsStart), m_glyphs.end());
+    }
+    else
+    {
+        m_vertices.clear();
+        m_outlineVertices.clear();
+        m_textureRanges.clear();
+        m_outlineTextureRanges.clear();
+        m_glyphs.clear();
+        m_lines.clear();
+    }
 
-    // Clear the previous geometry
-    m_vertices.clear();
-    m_outlineVertices.clear();
-    m_glyphs.clear();
     m_bounds = FloatRect();
 
     // No text: nothing to draw
     if (m_string.isEmpty())
         return;
 
+    // Distance field glyphs already have a margin around them, other glyphs
+    // are padded to avoid cutting their antialiased edges
+    const float glyphPadding = m_font->isDistanceFieldActive() ? 0.0f : 1.0f;
+
     // Compute values related to the text style
     const bool  isBold             = m_style & Bold;
     const bool  isUnderlined       = m_style & Underlined;
@@ -787,10 +1053,10 @@ void Text::ensureGeometryUpdate() const
     // Compute the location of the strikethrough dynamically
     // We use the center point of the lowercase 'x' glyph as the reference
     // We reuse the underline thickness as the thickness of the strikethrough as well
-    const float strikeThroughOffset = m_font->getGlyph(U'x', m_characterSize, isBold).bounds.getCenter().y;
+    const float strikeThroughOffset = trackGlyph(m_font->getGlyph(U'x', m_characterSize, isBold)).bounds.getCenter().y;
 
     // Precompute the variables needed by the algorithm
-    const float whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
+    const float whitespaceWidth = trackGlyph(m_font->getGlyph(U' ', m_characterSize, isBold)).advance;
     const float letterSpacing   = (whitespaceWidth / 3.0f) * (m_letterSpacingFactor - 1.0f);
     const float lineSpacing     = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
     float       x               = 0.0f;
@@ -802,6 +1068,16 @@ void Text::ensureGeometryUpdate() const
     auto maxX = 0.0f;
     auto maxY = 0.0f;
 
+    // Resume the layout where the last line started
+    if (isIncremental)
+    {
+        y    = resumedLine.y;
+        minX = resumedLine.previousMin.x;
+        minY = resumedLine.previousMin.y;
+        maxX = resumedLine.previousMax.x;
+        maxY = resumedLine.previousMax.y;
+    }
+
     // Check that we have a usable font
     const auto  fontId     = m_font->getInfo().id;
     auto* const fontHandle = m_font->getFontHandle();
@@ -823,12 +1099,29 @@ void Text::ensureGeometryUpdate() const
     hb_script_t                currentScript{};
     hb_direction_t             currentDirection{};
 
+    // Record where the geometry switches to another font texture; decorations
+    // can be drawn with any of them since they all start with a white square
+    const auto trackTextureRange = [](std::vector<TextureRange>& ranges,
+                                      std::size_t                vertexOffset,
+                                      unsigned int               textureIndex)
+    {
+        if (ranges.empty() && (textureIndex == 0))
+            return;
+
+        if (ranges.empty())
+            ranges.push_back({0, 0});
+
+        if (ranges.back().textureIndex != textureIndex)
+            ranges.push_back({vertexOffset, textureIndex});
+    };
+
     const auto outputLine = [&]
     {
-        if (!m_shaper || m_shaper->fontId != fontId || m_shaper->characterSize != m_characterSize)
+        if (!m_shaper || m_shaper->fontId != fontId || m_shaper->characterSize != m_characterSize ||
+            m_shaper->outline != (m_outlineThickness != 0))
         {
             // We need to get a new shaper implementation
-            m_shaper = ShaperImpl::getShaper(fontHandle, fontId, m_characterSize);
+            m_shaper = ShaperImpl::getShaper(fontHandle, fontId, m_characterSize, m_outlineThickness != 0);
         }
 
         const auto shapeOutput = m_shaper->shape(currentLine,
@@ -837,7 +1130,6 @@ void Text::ensureGeometryUpdate() const
                                                  currentDirection,
                                                  m_textOrientation,
                                                  m_clusterGrouping,
-                                                 m_outlineThickness,
                                                  m_style & Bold);
 
         // Variables used to compute bounds for the current line
@@ -874,7 +1166,7 @@ void Text::ensureGeometryUpdate() const
             }
 
             // Extract the current glyph's description
-            const Glyph& glyph = m_font->getGlyphById(shapeGlyph.id, m_characterSize, isBold);
+            const Glyph& glyph = trackGlyph(m_font->getGlyphById(shapeGlyph.id, m_characterSize, isBold));
 
             // Add the glyph to the glyph list
             auto& glyphEntry    = m_glyphs.emplace_back(ShapedGlyph{glyph, {}, {}, {}});
@@ -932,16 +1224,26 @@ void Text::ensureGeometryUpdate() const
                 // Apply the outline
                 if (outlineThickness != 0)
                 {
-                    const Glyph& outlineGlyph = m_font->getGlyphById(shapeGlyph.id, m_characterSize, style & Bold, outlineThickness);
+                    const Glyph& outlineGlyph = trackGlyph(
+                        m_font->getGlyphById(shapeGlyph.id, m_characterSize, style & Bold, outlineThickness));
 
                     // Add the outline glyph to the vertices
-                    addGlyphQuad(m_outlineVertices, glyphEntry.position, outlineColor, outlineGlyph, italicShear);
+                    trackTextureRange(m_outlineTextureRanges,
+                                      m_outlineVertices.getVertexCount(),
+                                      outlineGlyph.textureIndex);
+                    addGlyphQuad(m_outlineVertices,
+                                 glyphEntry.position,
+                                 outlineColor,
+                                 outlineGlyph,
+                                 italicShear,
+                                 glyphPadding);
                 }
 
                 glyphEntry.vertexOffset = m_vertices.getVertexCount();
 
-                const Glyph& fillGlyph = m_font->getGlyphById(shapeGlyph.id, m_characterSize, style & Bold);
-                addGlyphQuad(m_vertices, glyphEntry.position, fillColor, fillGlyph, italicShear);
+                const Glyph& fillGlyph = trackGlyph(m_font->getGlyphById(shapeGlyph.id, m_characterSize, style & Bold));
+                trackTextureRange(m_textureRanges, m_vertices.getVertexCount(), fillGlyph.textureIndex);
+                addGlyphQuad(m_vertices, glyphEntry.position, fillColor, fillGlyph, italicShear, glyphPadding);
 
                 glyphEntry.vertexCount = m_vertices.getVertexCount() - glyphEntry.vertexOffset;
             }
@@ -1106,38 +1408,30 @@ void Text::ensureGeometryUpdate() const
 
     // Split the input string into multiple segments with uniform
     // script and direction using the unicode bidirectional algorithm
-    const auto segments = segmentString(m_string);
+    const std::size_t layoutStart = resumedLine.stringOffset;
+    const std::size_t glyphsStart = resumedLine.glyphsStart;
+    const auto        segments    = segmentString(m_string, layoutStart);
 
     // In order to be able to align text we have to record all line data until we can compute the text metrics
     // We then use the record data to shift the necessary lines to the right/left as necessary
-    struct LineRecord
-    {
-        std::size_t    glyphsStart{};
-        std::size_t    glyphsCount{};
-        std::size_t    verticesStart{};
-        std::size_t    verticesCount{};
-        std::size_t    outlineVerticesStart{};
-        std::size_t    outlineVerticesCount{};
-        std::size_t    firstCodepointOffset = std::numeric_limits<std::size_t>::max();
-        hb_direction_t direction{};
-        float          lineWidth{};
-    };
-
-    std::vector<LineRecord> lines;
-
-    const auto beginLineRecord = [&]
+    // The records also hold the layout state at the start of the lines, to resume it from the last one
+    const auto beginLineRecord = [&](std::size_t stringOffset)
     {
         // Start a new line record
-        auto& lineRecord                = lines.emplace_back();
+        auto& lineRecord                = m_lines.emplace_back();
+        lineRecord.stringOffset         = stringOffset;
         lineRecord.glyphsStart          = m_glyphs.size();
         lineRecord.verticesStart        = m_vertices.getVertexCount();
         lineRecord.outlineVerticesStart = m_outlineVertices.getVertexCount();
+        lineRecord.y                    = y;
+        lineRecord.previousMin          = {minX, minY};
+        lineRecord.previousMax          = {maxX, maxY};
     };
 
     const auto endLineRecord = [&]
     {
         // Complete the line record
-        auto& lineRecord                = lines.back();
+        auto& lineRecord                = m_lines.back();
         lineRecord.glyphsCount          = m_glyphs.size() - lineRecord.glyphsStart;
         lineRecord.verticesCount        = m_vertices.getVertexCount() - lineRecord.verticesStart;
         lineRecord.outlineVerticesCount = m_outlineVertices.getVertexCount() - lineRecord.outlineVerticesStart;
@@ -1145,7 +1439,7 @@ void Text::ensureGeometryUpdate() const
     };
 
     if (!segments.empty())
-        beginLineRecord();
+        beginLineRecord(layoutStart);
 
     // Iterate over all segments
     for (const auto& segment : segments)
@@ -1153,10 +1447,10 @@ void Text::ensureGeometryUpdate() const
         currentScript    = segment.script;
         currentDirection = segment.direction;
 
-        if (segment.offset < lines.back().firstCodepointOffset)
+        if (segment.offset < m_lines.back().firstCodepointOffset)
         {
-            lines.back().firstCodepointOffset = segment.offset;
-            lines.back().direction            = currentDirection;
+            m_lines.back().firstCodepointOffset = segment.offset;
+            m_lines.back().isRightToLeft        = (currentDirection == HB_DIRECTION_RTL);
         }
 
         // We use the index into the input string as the input cluster IDs as well
@@ -1193,11 +1487,10 @@ void Text::ensureGeometryUpdate() const
                 {
                     // Search for the cluster with the highest cluster value, see comment below on why this works
                     // We are guaranteed to find an element, so the iterator returned is guaranteed to be valid
-                    const auto& highestClusterGlyph = *std::max_element(m_glyphs.begin() +
-                                                                            static_cast<int>(lines.back().glyphsStart),
-                                                                        m_glyphs.end(),
-                                                                        [](const ShapedGlyph& left, const ShapedGlyph& right)
-                                                                        { return left.cluster < right.cluster; });
+                    const auto  lineBegin           = m_glyphs.begin() + static_cast<int>(m_lines.back().glyphsStart);
+                    const auto  compareClusters     = [](const ShapedGlyph& left, const ShapedGlyph& right)
+                    { return left.cluster < right.cluster; };
+                    const auto& highestClusterGlyph = *std::max_element(lineBegin, m_glyphs.end(), compareClusters);
 
                     glyph.position = {highestClusterGlyph.position.x +
                                           (highestClusterGlyph.textDirection == TextDirection::RightToLeft
@@ -1214,7 +1507,6 @@ void Text::ensureGeometryUpdate() const
                 glyph.cluster = index;
 
                 endLineRecord();
-                beginLineRecord();
 
                 // Update the current bounds (min coordinates)
                 minX = std::min(minX, x);
@@ -1227,6 +1519,8 @@ void Text::ensureGeometryUpdate() const
                 maxX = std::max(maxX, x);
                 maxY = std::max(maxY, y);
 
+                beginLineRecord(index + 1u);
+
                 // Next glyph, no need to create a quad for newline
                 continue;
             }
@@ -1258,7 +1552,8 @@ void Text::ensureGeometryUpdate() const
         endLineRecord();
 
     // Sort shaped glyphs so that clusters are in ascending order
-    std::sort(m_glyphs.begin(),
+    // The clusters of the previous lines are all lower than the ones of the new glyphs
+    std::sort(m_glyphs.begin() + static_cast<std::ptrdiff_t>(glyphsStart),
               m_glyphs.end(),
               [](const ShapedGlyph& left, const ShapedGlyph& right) { return left.cluster < right.cluster; });
 
@@ -1277,16 +1572,16 @@ void Text::ensureGeometryUpdate() const
     m_bounds.size     = Vector2f(maxX, maxY) - Vector2f(minX, minY);
 
     // Use line record data to post-process lines e.g. re-alignment etc.
-    if (!lines.empty())
+    if (!m_lines.empty())
     {
         // Get width of widest line
-        const auto maxWidth = std::max_element(lines.begin(),
-                                               lines.end(),
+        const auto maxWidth = std::max_element(m_lines.begin(),
+                                               m_lines.end(),
                                                [](const LineRecord& left, const LineRecord& right)
                                                { return left.lineWidth < right.lineWidth; })
                                   ->lineWidth;
 
-        for (auto& line : lines)
+        for (auto& line : m_lines)
         {
             auto shift = 0.0f;
 
@@ -1298,15 +1593,19 @@ void Text::ensureGeometryUpdate() const
             {
                 shift = -line.lineWidth;
             }
-            else if ((m_lineAlignment == LineAlignment::Default) && (line.direction == HB_DIRECTION_RTL))
+            else if ((m_lineAlignment == LineAlignment::Default) && line.isRightToLeft)
             {
                 shift = maxWidth - line.lineWidth;
             }
-            else
-            {
-                // Skip modifying the data if there is nothing to shift
+
+            // Lines kept from the previous update are already shifted, possibly
+            // by another amount if they are aligned with the widest line
+            shift -= line.shift;
+            line.shift += shift;
+
+            // Skip modifying the data if there is nothing to shift
+            if (shift == 0.0f)
                 continue;
-            }
 
             // Shift glyphs
             for (auto i = line.glyphsStart; i < line.glyphsStart + line.glyphsCount; ++i)
@@ -1331,6 +1630,10 @@ void Text::ensureGeometryUpdate() const
             m_bounds.position.x -= m_bounds.size.x;
         }
     }
+
+    // Glyphs loaded during the update may have changed the font texture,
+    // this doesn't move the glyphs which were already in it
+    m_fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
 }
 
 } // namespace sf
@@ -29,6 +29,7 @@
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureCompression.hpp>
 #include <SFML/Graphics/TextureSaver.hpp>
 
 #include <SFML/Window/Context.hpp>
@@ -36,12 +37,19 @@
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
+#include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
+#include <SFML/System/Utils.hpp>
 
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <functional>
+#include <limits>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 #include <cassert>
 #include <cstring>
@@ -60,12 +68,277 @@ std::uint64_t getUniqueId() noexcept
 
     return id.fetch_add(1);
 }
+
+// Copy the useful pixels of a padded and/or flipped texture read back from the graphics card
+void copyPixels(const std::uint8_t* src, sf::Vector2u actualSize, sf::Vector2u size, bool flipped, std::uint8_t* dst)
+{
+    int                srcPitch = static_cast<int>(actualSize.x * 4);
+    const unsigned int dstPitch = size.x * 4;
+
+    // Handle the case where source pixels are flipped vertically
+    if (flipped)
+    {
+        src += static_cast<unsigned int>(srcPitch * static_cast<int>(size.y - 1));
+        srcPitch = -srcPitch;
+    }
+
+    for (unsigned int i = 0; i < size.y; ++i)
+    {
+        std::memcpy(dst, src, dstPitch);
+        src += srcPitch;
+        dst += dstPitch;
+    }
+}
+
+// Number of asynchronous copies that can be in flight at the same time
+constexpr std::size_t maxAsyncCopies = 3;
+
+// Get the OpenGL format of compressed blocks, if the driver supports it
+std::optional<GLenum> getCompressedInternalFormat(sf::priv::CompressedFormat format, bool sRgb)
+{
+    using sf::priv::CompressedFormat;
+
+    if (!GLEXT_texture_compression || (sRgb && !GLEXT_texture_sRGB))
+        return std::nullopt;
+
+    switch (format)
+    {
+        case CompressedFormat::Bc1:
+            if (GLEXT_texture_compression_s3tc)
+                return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1 : GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT1;
+            break;
+        case CompressedFormat::Bc2:
+            if (GLEXT_texture_compression_s3tc)
+                return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3 : GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT3;
+            break;
+        case CompressedFormat::Bc3:
+            if (GLEXT_texture_compression_s3tc)
+                return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5 : GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT5;
+            break;
+        case CompressedFormat::Bc4:
+            if (GLEXT_texture_compression_rgtc && !sRgb)
+                return GLEXT_GL_COMPRESSED_RED_RGTC1;
+            break;
+        case CompressedFormat::Bc5:
+            if (GLEXT_texture_compression_rgtc && !sRgb)
+                return GLEXT_GL_COMPRESSED_RG_RGTC2;
+            break;
+        case CompressedFormat::Bc7:
+            if (GLEXT_texture_compression_bptc)
+                return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM : GLEXT_GL_COMPRESSED_RGBA_BPTC_UNORM;
+            break;
+        case CompressedFormat::Etc2Rgb:
+            if (GLEXT_texture_compression_etc2)
+                return sRgb ? GLEXT_GL_COMPRESSED_SRGB8_ETC2 : GLEXT_GL_COMPRESSED_RGB8_ETC2;
+            break;
+        case CompressedFormat::Etc2Rgba:
+            if (GLEXT_texture_compression_etc2)
+                return sRgb ? GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC : GLEXT_GL_COMPRESSED_RGBA8_ETC2_EAC;
+            break;
+    }
+
+    return std::nullopt;
+}
+
+// Does the area cover the whole image? (an empty area means the whole image)
+bool isWholeImage(const sf::IntRect& area, sf::Vector2i size)
+{
+    return (area.size.x == 0) || (area.size.y == 0) ||
+           ((area.position.x <= 0) && (area.position.y <= 0) && (area.size.x >= size.x) && (area.size.y >= size.y));
+}
 } // namespace TextureImpl
 } // namespace
 
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+struct Texture::StagingPool
+{
+    struct Buffer
+    {
+        GLuint                    buffer{};   //!< Pixel buffer object, 0 if they are not supported
+        std::vector<std::uint8_t> memory;     //!< Memory used instead of a pixel buffer object
+        GLsync                    fence{};    //!< Fence signaled when the last upload from the buffer is complete
+        std::uint64_t             ticket{};   //!< Ticket of the last upload from the buffer
+        bool                      isMapped{}; //!< Is the buffer being filled?
+    };
+
+    StagingPool() = default;
+
+    ~StagingPool()
+    {
+        const TransientContextLock lock;
+
+        // Deleting mapped buffers unmaps them
+        for (const Buffer& staging : buffers)
+        {
+            if (staging.fence)
+                glCheck(GLEXT_glDeleteSync(staging.fence));
+
+            if (staging.buffer)
+                glCheck(GLEXT_glDeleteBuffers(1, &staging.buffer));
+        }
+    }
+
+    // clang-format off
+    StagingPool(const StagingPool&)            = delete;
+    StagingPool& operator=(const StagingPool&) = delete;
+    // clang-format on
+
+    // Release the fences of the uploads which are complete
+    void pollFences(bool wait)
+    {
+        for (Buffer& staging : buffers)
+        {
+            if (!staging.fence)
+                continue;
+
+            const GLbitfield flags   = wait ? GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT : 0;
+            const GLuint64   timeout = wait ? std::numeric_limits<GLuint64>::max() : 0;
+            GLenum           status  = 0;
+            glCheck(status = GLEXT_glClientWaitSync(staging.fence, flags, timeout));
+
+            if ((status == GLEXT_GL_ALREADY_SIGNALED) || (status == GLEXT_GL_CONDITION_SATISFIED) ||
+                (status == GLEXT_GL_WAIT_FAILED))
+            {
+                glCheck(GLEXT_glDeleteSync(staging.fence));
+                staging.fence   = nullptr;
+                completedTicket = std::max(completedTicket, staging.ticket);
+            }
+        }
+    }
+
+    std::vector<Buffer> buffers;           //!< Staging buffers, created on demand
+    std::uint64_t       nextTicket{1};     //!< Ticket of the next update
+    std::uint64_t       completedTicket{}; //!< Last update known to be complete
+};
+
+
+////////////////////////////////////////////////////////////
+struct Texture::ReadbackRing
+{
+    struct Slot
+    {
+        GLuint                       buffer{};        //!< Pixel buffer object receiving the pixels
+        GLsync                       fence{};         //!< Fence signaled when the pixels are in the buffer
+        std::uint64_t                ticket{};        //!< Ticket of the copy in flight, 0 if the slot is free
+        Vector2u                     size;            //!< Size of the copied image
+        Vector2u                     actualSize;      //!< Size of the pixels in the buffer (including padding)
+        bool                         pixelsFlipped{}; //!< Are the pixels in the buffer flipped vertically?
+        std::function<void(Image&&)> callback;        //!< Function receiving the image
+    };
+
+    struct Result
+    {
+        std::uint64_t                ticket{}; //!< Ticket of the copy
+        Image                        image;    //!< Copied image
+        std::function<void(Image&&)> callback; //!< Function receiving the image
+    };
+
+    ReadbackRing() = default;
+
+    ~ReadbackRing()
+    {
+        const TransientContextLock lock;
+
+        for (const Slot& slot : slots)
+        {
+            if (slot.fence)
+                glCheck(GLEXT_glDeleteSync(slot.fence));
+
+            if (slot.buffer)
+                glCheck(GLEXT_glDeleteBuffers(1, &slot.buffer));
+        }
+    }
+
+    // clang-format off
+    ReadbackRing(const ReadbackRing&)            = delete;
+    ReadbackRing& operator=(const ReadbackRing&) = delete;
+    // clang-format on
+
+    // Tell whether the pixels of a copy have arrived in its buffer, optionally waiting for them
+    static bool isComplete(Slot& slot, bool wait)
+    {
+        // Without fences, mapping the buffer waits for the copy
+        if (!slot.fence)
+            return true;
+
+        const GLbitfield flags   = wait ? GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT : 0;
+        const GLuint64   timeout = wait ? std::numeric_limits<GLuint64>::max() : 0;
+        GLenum           status  = 0;
+        glCheck(status = GLEXT_glClientWaitSync(slot.fence, flags, timeout));
+
+        if ((status != GLEXT_GL_ALREADY_SIGNALED) && (status != GLEXT_GL_CONDITION_SATISFIED) &&
+            (status != GLEXT_GL_WAIT_FAILED))
+            return false;
+
+        glCheck(GLEXT_glDeleteSync(slot.fence));
+        slot.fence = nullptr;
+        return true;
+    }
+
+    // Read the pixels of a complete copy from its buffer and free the slot
+    static Result resolve(Slot& slot)
+    {
+        isComplete(slot, true);
+
+        std::vector<std::uint8_t> pixels(std::size_t{slot.size.x} * std::size_t{slot.size.y} * 4);
+        const void*               data = nullptr;
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, slot.buffer));
+        glCheck(data = GLEXT_glMapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, GLEXT_GL_READ_ONLY));
+
+        if (data)
+        {
+            TextureImpl::copyPixels(static_cast<const std::uint8_t*>(data),
+                                    slot.actualSize,
+                                    slot.size,
+                                    slot.pixelsFlipped,
+                                    pixels.data());
+            glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER));
+        }
+        else
+        {
+            err() << "Failed to map pixel buffer of asynchronous texture copy" << std::endl;
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+        Result result{slot.ticket, Image(slot.size, pixels.data()), std::move(slot.callback)};
+        slot.ticket   = 0;
+        slot.callback = {};
+        return result;
+    }
+
+    // Extract the result of a copy, resolving it if it is complete or if waiting is allowed
+    std::optional<Image> take(std::uint64_t ticket, bool wait)
+    {
+        const auto result = std::find_if(results.begin(),
+                                         results.end(),
+                                         [ticket](const Result& entry) { return entry.ticket == ticket; });
+        if (result != results.end())
+        {
+            Image image = std::move(result->image);
+            results.erase(result);
+            return image;
+        }
+
+        const auto slot = std::find_if(slots.begin(),
+                                       slots.end(),
+                                       [ticket](const Slot& entry) { return entry.ticket == ticket; });
+        if ((ticket == 0) || (slot == slots.end()) || !isComplete(*slot, wait))
+            return std::nullopt;
+
+        return resolve(*slot).image;
+    }
+
+    std::array<Slot, TextureImpl::maxAsyncCopies> slots;         //!< Copies in flight
+    std::vector<Result>                           results;       //!< Complete copies not delivered yet
+    std::uint64_t                                 nextTicket{1}; //!< Ticket of the next copy
+};
+
+
 ////////////////////////////////////////////////////////////
 Texture::Texture() : m_cacheId(TextureImpl::getUniqueId())
 {
@@ -197,7 +470,10 @@ Texture::Texture(Texture&& right) noexcept :
     m_pixelsFlipped(std::exchange(right.m_pixelsFlipped, false)),
     m_fboAttachment(std::exchange(right.m_fboAttachment, false)),
     m_hasMipmap(std::exchange(right.m_hasMipmap, false)),
-    m_cacheId(std::exchange(right.m_cacheId, 0))
+    m_isCompressed(std::exchange(right.m_isCompressed, false)),
+    m_cacheId(std::exchange(right.m_cacheId, 0)),
+    m_stagingPool(std::move(right.m_stagingPool)),
+    m_readbackRing(std::move(right.m_readbackRing))
 {
 }
 
@@ -229,7 +505,10 @@ Texture& Texture::operator=(Texture&& right) noexcept
     m_pixelsFlipped = std::exchange(right.m_pixelsFlipped, false);
     m_fboAttachment = std::exchange(right.m_fboAttachment, false);
     m_hasMipmap     = std::exchange(right.m_hasMipmap, false);
+    m_isCompressed  = std::exchange(right.m_isCompressed, false);
     m_cacheId       = std::exchange(right.m_cacheId, 0);
+    m_stagingPool   = std::move(right.m_stagingPool);
+    m_readbackRing  = std::move(right.m_readbackRing);
     return *this;
 }
 
@@ -342,7 +621,14 @@ bool Texture::resize(Vector2u size, bool sRgb)
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
     m_cacheId = TextureImpl::getUniqueId();
 
-    m_hasMipmap = false;
+#ifndef SFML_OPENGL_ES
+    // Compressed images limit the mipmap levels to the ones stored in the file, restore the default
+    if (m_isCompressed)
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 1000));
+#endif
+
+    m_hasMipmap    = false;
+    m_isCompressed = false;
 
     return true;
 }
@@ -351,6 +637,25 @@ bool Texture::resize(Vector2u size, bool sRgb)
 ////////////////////////////////////////////////////////////
 bool Texture::loadFromFile(const std::filesystem::path& filename, bool sRgb, const IntRect& area)
 {
+    // Compressed images are read by the texture itself, other formats are decoded by sf::Image
+    const std::string extension = toLower(filename.extension().string());
+    if ((extension == ".dds") || (extension == ".ktx") || (extension == ".ktx2"))
+    {
+        // Read the blocks directly from the file mapped in memory when possible
+        MappedFileInputStream mappedFile;
+        if (mappedFile.open(filename) && mappedFile.getData())
+            return loadFromMemory(mappedFile.getData(), mappedFile.getSize().value(), sRgb, area);
+
+        FileInputStream stream;
+        if (!stream.open(filename))
+        {
+            err() << "Failed to open compressed image file\n" << formatDebugPathInfo(filename) << std::endl;
+            return false;
+        }
+
+        return loadFromStream(stream, sRgb, area);
+    }
+
     Image image;
     return image.loadFromFile(filename) && loadFromImage(image, sRgb, area);
 }
@@ -359,6 +664,12 @@ bool Texture::loadFromFile(const std::filesystem::path& filename, bool sRgb, con
 ////////////////////////////////////////////////////////////
 bool Texture::loadFromMemory(const void* data, std::size_t size, bool sRgb, const IntRect& area)
 {
+    if (priv::isCompressedImage(data, size))
+    {
+        const std::optional<priv::CompressedImage> image = priv::loadCompressedImage(data, size);
+        return image && loadFromCompressedImage(*image, sRgb, area);
+    }
+
     Image image;
     return image.loadFromMemory(data, size) && loadFromImage(image, sRgb, area);
 }
@@ -367,6 +678,26 @@ bool Texture::loadFromMemory(const void* data, std::size_t size, bool sRgb, cons
 ////////////////////////////////////////////////////////////
 bool Texture::loadFromStream(InputStream& stream, bool sRgb, const IntRect& area)
 {
+    // Read the signature of compressed images
+    std::array<std::uint8_t, 12> signature{};
+    const std::optional<std::size_t> signatureSize = stream.seek(0).has_value()
+                                                         ? stream.read(signature.data(), signature.size())
+                                                         : std::nullopt;
+
+    if (signatureSize.has_value() && priv::isCompressedImage(signature.data(), *signatureSize))
+    {
+        // Compressed images are parsed in memory, read the whole stream
+        const std::optional<std::size_t> size = stream.getSize();
+        std::vector<std::uint8_t>        data(size.value_or(0));
+        if (!size.has_value() || !stream.seek(0).has_value() || (stream.read(data.data(), data.size()) != size))
+        {
+            err() << "Failed to read compressed image from stream" << std::endl;
+            return false;
+        }
+
+        return loadFromMemory(data.data(), data.size(), sRgb, area);
+    }
+
     Image image;
     return image.loadFromStream(stream) && loadFromImage(image, sRgb, area);
 }
@@ -379,8 +710,7 @@ bool Texture::loadFromImage(const Image& image, bool sRgb, const IntRect& area)
     const auto size = Vector2i(image.getSize());
 
     // Load the entire image if the source area is either empty or contains the whole image
-    if (area.size.x == 0 || (area.size.y == 0) ||
-        ((area.position.x <= 0) && (area.position.y <= 0) && (area.size.x >= size.x) && (area.size.y >= size.y)))
+    if (TextureImpl::isWholeImage(area, size))
     {
         // Load the entire image
         if (resize(image.getSize(), sRgb))
@@ -438,6 +768,120 @@ bool Texture::loadFromImage(const Image& image, bool sRgb, const IntRect& area)
 }
 
 
+////////////////////////////////////////////////////////////
+bool Texture::loadFromCompressedImage(const priv::CompressedImage& image, bool sRgb, const IntRect& area)
+{
+    const TransientContextLock lock;
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    sRgb = sRgb || image.sRgb;
+
+    const auto decompressImage = [&]
+    {
+        const std::vector<std::uint8_t> pixels = priv::decompress(image.format,
+                                                                  image.size,
+                                                                  image.levels.front().data());
+        return loadFromImage(Image(image.size, pixels.data()), sRgb, area);
+    };
+
+    // Blocks can only be uploaded as they are if the whole image fits in a texture without padding
+    const std::optional<GLenum> internalFormat = TextureImpl::getCompressedInternalFormat(image.format, sRgb);
+    const unsigned int          maxSize        = getMaximumSize();
+
+    if (!internalFormat || !TextureImpl::isWholeImage(area, Vector2i(image.size)) ||
+        (getValidSize(image.size.x) != image.size.x) || (getValidSize(image.size.y) != image.size.y) ||
+        (image.size.x > maxSize) || (image.size.y > maxSize))
+        return decompressImage();
+
+    // Upload the blocks to a new OpenGL texture, so that this one is left
+    // unchanged if they are rejected and its parameters don't leak into them
+    GLuint texture = 0;
+    glCheck(glGenTextures(1, &texture));
+    if (!texture)
+    {
+        err() << "Failed to load compressed image, failed to create texture" << std::endl;
+        return false;
+    }
+
+    {
+        // Make sure that the current texture binding will be preserved
+        const priv::TextureSaver save;
+
+        glCheck(glBindTexture(GL_TEXTURE_2D, texture));
+
+        // Upload the mipmap levels stored in the file
+        Vector2u levelSize = image.size;
+        for (std::size_t level = 0; level < image.levels.size(); ++level)
+        {
+            glCheck(GLEXT_glCompressedTexImage2D(GL_TEXTURE_2D,
+                                                 static_cast<GLint>(level),
+                                                 *internalFormat,
+                                                 static_cast<GLsizei>(levelSize.x),
+                                                 static_cast<GLsizei>(levelSize.y),
+                                                 0,
+                                                 static_cast<GLsizei>(image.levels[level].size()),
+                                                 image.levels[level].data()));
+
+            levelSize = {std::max(levelSize.x / 2, 1u), std::max(levelSize.y / 2, 1u)};
+        }
+
+#ifndef SFML_OPENGL_ES
+        // Decompress the image ourselves if the driver rejected the blocks
+        GLint isCompressed = GL_FALSE;
+        glCheck(glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GLEXT_GL_TEXTURE_COMPRESSED, &isCompressed));
+        if (isCompressed != GL_TRUE)
+        {
+            glCheck(glDeleteTextures(1, &texture));
+            return decompressImage();
+        }
+
+        // Files may contain an incomplete mipmap chain
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(image.levels.size() - 1)));
+
+        static const bool textureEdgeClamp = GLEXT_texture_edge_clamp || GLEXT_GL_VERSION_1_2 ||
+                                             Context::isExtensionAvailable("GL_EXT_texture_edge_clamp");
+        const GLint textureWrapParam = m_isRepeated ? GL_REPEAT
+                                                    : (textureEdgeClamp ? GLEXT_GL_CLAMP_TO_EDGE : GLEXT_GL_CLAMP);
+#else
+        const GLint textureWrapParam = m_isRepeated ? GL_REPEAT : GLEXT_GL_CLAMP_TO_EDGE;
+#endif
+
+        const bool  hasMipmap = image.levels.size() > 1;
+        const GLint minFilter = hasMipmap ? (m_isSmooth ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_LINEAR)
+                                          : (m_isSmooth ? GL_LINEAR : GL_NEAREST);
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, textureWrapParam));
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, textureWrapParam));
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter));
+    }
+
+    // Everything succeeded, replace the previous texture
+    if (m_texture)
+    {
+        const GLuint previousTexture = m_texture;
+        glCheck(glDeleteTextures(1, &previousTexture));
+    }
+
+    m_texture       = texture;
+    m_size          = image.size;
+    m_actualSize    = image.size;
+    m_sRgb          = sRgb;
+    m_pixelsFlipped = false;
+    m_fboAttachment = false;
+    m_hasMipmap     = image.levels.size() > 1;
+    m_isCompressed  = true;
+    m_cacheId       = TextureImpl::getUniqueId();
+
+    // Force an OpenGL flush, so that the texture will appear updated
+    // in all contexts immediately (solves problems in multi-threaded apps)
+    glCheck(glFlush());
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2u Texture::getSize() const
 {
@@ -519,24 +963,7 @@ Image Texture::copyToImage() const
         glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, allPixels.data()));
 
         // Then we copy the useful pixels from the temporary array to the final one
-        const std::uint8_t* src      = allPixels.data();
-        std::uint8_t*       dst      = pixels.data();
-        int                 srcPitch = static_cast<int>(m_actualSize.x * 4);
-        const unsigned int  dstPitch = m_size.x * 4;
-
-        // Handle the case where source pixels are flipped vertically
-        if (m_pixelsFlipped)
-        {
-            src += static_cast<unsigned int>(srcPitch * static_cast<int>(m_size.y - 1));
-            srcPitch = -srcPitch;
-        }
-
-        for (unsigned int i = 0; i < m_size.y; ++i)
-        {
-            std::memcpy(dst, src, dstPitch);
-            src += srcPitch;
-            dst += dstPitch;
-        }
+        TextureImpl::copyPixels(allPixels.data(), m_actualSize, m_size, m_pixelsFlipped, pixels.data());
     }
 
 #endif // SFML_OPENGL_ES
@@ -559,6 +986,12 @@ void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
     assert(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture");
     assert(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture");
 
+    if (m_isCompressed)
+    {
+        err() << "Failed to update texture, compressed textures cannot be updated" << std::endl;
+        return;
+    }
+
     if (pixels && m_texture)
     {
         const TransientContextLock lock;
@@ -603,6 +1036,12 @@ void Texture::update(const Texture& texture, Vector2u dest)
     assert(dest.x + texture.m_size.x <= m_size.x && "Destination x coordinate is outside of texture");
     assert(dest.y + texture.m_size.y <= m_size.y && "Destination y coordinate is outside of texture");
 
+    if (m_isCompressed)
+    {
+        err() << "Failed to update texture, compressed textures cannot be updated" << std::endl;
+        return;
+    }
+
     if (!m_texture || !texture.m_texture)
         return;
 
@@ -746,6 +1185,12 @@ void Texture::update(const Window& window, Vector2u dest)
     assert(dest.x + window.getSize().x <= m_size.x && "Destination x coordinate is outside of texture");
     assert(dest.y + window.getSize().y <= m_size.y && "Destination y coordinate is outside of texture");
 
+    if (m_isCompressed)
+    {
+        err() << "Failed to update texture, compressed textures cannot be updated" << std::endl;
+        return;
+    }
+
     if (m_texture && window.setActive(true))
     {
         const TransientContextLock lock;
@@ -775,6 +1220,331 @@ void Texture::update(const Window& window, Vector2u dest)
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<Texture::AsyncUpdate> Texture::beginAsyncUpdate(Vector2u size, Vector2u dest)
+{
+    if (!m_texture || (size.x == 0) || (size.y == 0) || (dest.x + size.x > m_size.x) || (dest.y + size.y > m_size.y))
+        return std::nullopt;
+
+    if (m_isCompressed)
+    {
+        err() << "Failed to update texture, compressed textures cannot be updated" << std::endl;
+        return std::nullopt;
+    }
+
+    const TransientContextLock lock;
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    if (!m_stagingPool)
+        m_stagingPool = std::make_unique<StagingPool>();
+
+    // Reuse the staging buffer with the oldest upload, or create a new
+    // one if all of them are being filled
+    auto&      buffers = m_stagingPool->buffers;
+    const auto staging = std::min_element(buffers.begin(),
+                                          buffers.end(),
+                                          [](const StagingPool::Buffer& left, const StagingPool::Buffer& right)
+                                          {
+                                              if (left.isMapped != right.isMapped)
+                                                  return right.isMapped;
+
+                                              return left.ticket < right.ticket;
+                                          });
+    auto       index   = static_cast<std::size_t>(staging - buffers.begin());
+
+    if ((staging == buffers.end()) || staging->isMapped)
+    {
+        index = buffers.size();
+        buffers.emplace_back();
+
+        if (GLEXT_pixel_buffer_object)
+            glCheck(GLEXT_glGenBuffers(1, &buffers.back().buffer));
+    }
+
+    StagingPool::Buffer& buffer    = buffers[index];
+    const std::size_t    byteCount = std::size_t{size.x} * std::size_t{size.y} * 4;
+    std::uint8_t*        pixels    = nullptr;
+
+    if (buffer.buffer)
+    {
+        // Give the buffer new storage, so that mapping it doesn't
+        // wait for the driver to finish a previous upload from it
+        void* data = nullptr;
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, buffer.buffer));
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_UNPACK_BUFFER,
+                                   static_cast<GLsizeiptrARB>(byteCount),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_DRAW));
+        glCheck(data = GLEXT_glMapBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, GLEXT_GL_WRITE_ONLY));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+
+        pixels = static_cast<std::uint8_t*>(data);
+    }
+    else
+    {
+        buffer.memory.resize(byteCount);
+        pixels = buffer.memory.data();
+    }
+
+    if (!pixels)
+    {
+        err() << "Failed to map staging buffer for asynchronous texture update" << std::endl;
+        return std::nullopt;
+    }
+
+    buffer.isMapped = true;
+
+    return AsyncUpdate{pixels, size, dest, index};
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t Texture::endAsyncUpdate(const AsyncUpdate& asyncUpdate)
+{
+    assert(m_stagingPool && (asyncUpdate.staging < m_stagingPool->buffers.size()) && "Invalid asynchronous update");
+
+    StagingPool::Buffer& buffer = m_stagingPool->buffers[asyncUpdate.staging];
+    assert(buffer.isMapped && "Asynchronous update already ended");
+
+    buffer.isMapped = false;
+    buffer.ticket   = m_stagingPool->nextTicket++;
+
+    if (!buffer.buffer)
+    {
+        // Pixel buffer objects are not supported: copy the pixels synchronously
+        update(buffer.memory.data(), asyncUpdate.size, asyncUpdate.dest);
+        m_stagingPool->completedTicket = buffer.ticket;
+        return buffer.ticket;
+    }
+
+    const TransientContextLock lock;
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save;
+
+    GLboolean unmapped = GL_FALSE;
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, buffer.buffer));
+    glCheck(unmapped = GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER));
+
+    // The content of the buffer may be lost, e.g. when the screen mode changed
+    if (unmapped == GL_FALSE)
+        err() << "Staging buffer of asynchronous texture update was corrupted" << std::endl;
+
+    // Copy pixels from the bound buffer to the texture, the driver performs
+    // the transfer without blocking the thread
+    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+    glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                            0,
+                            static_cast<GLint>(asyncUpdate.dest.x),
+                            static_cast<GLint>(asyncUpdate.dest.y),
+                            static_cast<GLsizei>(asyncUpdate.size.x),
+                            static_cast<GLsizei>(asyncUpdate.size.y),
+                            GL_RGBA,
+                            GL_UNSIGNED_BYTE,
+                            nullptr));
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+
+    m_hasMipmap     = false;
+    m_pixelsFlipped = false;
+    m_cacheId       = TextureImpl::getUniqueId();
+
+    if (GLEXT_sync)
+    {
+        // Replace the fence of the previous upload from the buffer, which is complete by now
+        if (buffer.fence)
+            glCheck(GLEXT_glDeleteSync(buffer.fence));
+
+        glCheck(buffer.fence = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    }
+    else
+    {
+        // Commands are executed in order, the update is complete for any later use of the texture
+        m_stagingPool->completedTicket = buffer.ticket;
+    }
+
+    // Force an OpenGL flush, so that the texture data will appear updated
+    // in all contexts immediately (solves problems in multi-threaded apps)
+    glCheck(glFlush());
+
+    return buffer.ticket;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t Texture::updateAsync(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
+{
+    if (!pixels)
+        return 0;
+
+    const std::optional<AsyncUpdate> asyncUpdate = beginAsyncUpdate(size, dest);
+    if (!asyncUpdate)
+        return 0;
+
+    std::memcpy(asyncUpdate->pixels, pixels, std::size_t{size.x} * std::size_t{size.y} * 4);
+    return endAsyncUpdate(*asyncUpdate);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::isUpdateComplete(std::uint64_t ticket) const
+{
+    if (!m_stagingPool || (ticket <= m_stagingPool->completedTicket))
+        return true;
+
+    const TransientContextLock lock;
+    m_stagingPool->pollFences(false);
+
+    return ticket <= m_stagingPool->completedTicket;
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::waitForUpdate(std::uint64_t ticket) const
+{
+    if (!m_stagingPool || (ticket <= m_stagingPool->completedTicket))
+        return;
+
+    const TransientContextLock lock;
+    m_stagingPool->pollFences(true);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t Texture::copyToImageAsync(std::function<void(Image&&)> callback)
+{
+    // Easy case: empty texture
+    if (!m_texture)
+        return 0;
+
+    const TransientContextLock lock;
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    if (!m_readbackRing)
+        m_readbackRing = std::make_unique<ReadbackRing>();
+
+    const std::uint64_t ticket = m_readbackRing->nextTicket++;
+
+#ifndef SFML_OPENGL_ES
+
+    if (GLEXT_pixel_buffer_object)
+    {
+        // Use a free slot, or complete the oldest copy to make room for this one
+        auto&      slots = m_readbackRing->slots;
+        const auto slot  = std::min_element(slots.begin(),
+                                           slots.end(),
+                                           [](const ReadbackRing::Slot& left, const ReadbackRing::Slot& right)
+                                           { return left.ticket < right.ticket; });
+
+        if (slot->ticket)
+            m_readbackRing->results.push_back(ReadbackRing::resolve(*slot));
+
+        if (!slot->buffer)
+            glCheck(GLEXT_glGenBuffers(1, &slot->buffer));
+
+        // Make sure that the current texture binding will be preserved
+        const priv::TextureSaver save;
+
+        // Read the pixels into the bound buffer, the driver performs
+        // the transfer without blocking the thread
+        const std::size_t byteCount = std::size_t{m_actualSize.x} * std::size_t{m_actualSize.y} * 4;
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, slot->buffer));
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_PACK_BUFFER,
+                                   static_cast<GLsizeiptrARB>(byteCount),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_READ));
+        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+        glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+        if (GLEXT_sync)
+            glCheck(slot->fence = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+        // Make sure that the commands are submitted, so that the fence can be signaled
+        glCheck(glFlush());
+
+        slot->ticket        = ticket;
+        slot->size          = m_size;
+        slot->actualSize    = m_actualSize;
+        slot->pixelsFlipped = m_pixelsFlipped;
+        slot->callback      = std::move(callback);
+
+        return ticket;
+    }
+
+#endif // SFML_OPENGL_ES
+
+    // Pixel buffer objects are not supported: copy the pixels synchronously
+    m_readbackRing->results.push_back({ticket, copyToImage(), std::move(callback)});
+
+    return ticket;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> Texture::pollAsyncCopy(std::uint64_t ticket)
+{
+    if (!m_readbackRing)
+        return std::nullopt;
+
+    const TransientContextLock lock;
+    return m_readbackRing->take(ticket, false);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> Texture::waitForAsyncCopy(std::uint64_t ticket)
+{
+    if (!m_readbackRing)
+        return std::nullopt;
+
+    const TransientContextLock lock;
+    return m_readbackRing->take(ticket, true);
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::processAsyncCopies()
+{
+    if (!m_readbackRing)
+        return;
+
+    std::vector<ReadbackRing::Result> complete;
+
+    {
+        const TransientContextLock lock;
+
+        for (ReadbackRing::Slot& slot : m_readbackRing->slots)
+        {
+            if (slot.ticket && slot.callback && ReadbackRing::isComplete(slot, false))
+                complete.push_back(ReadbackRing::resolve(slot));
+        }
+    }
+
+    // Extract the results before invoking the callbacks, which may start new copies
+    auto& results = m_readbackRing->results;
+    for (auto it = results.begin(); it != results.end();)
+    {
+        if (it->callback)
+        {
+            complete.push_back(std::move(*it));
+            it = results.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for (ReadbackRing::Result& result : complete)
+        result.callback(std::move(result.image));
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::setSmooth(bool smooth)
 {
@@ -902,6 +1672,43 @@ bool Texture::generateMipmap()
 }
 
 
+////////////////////////////////////////////////////////////
+std::array<float, 16> Texture::getTextureMatrix(CoordinateType coordinateType) const
+{
+    // clang-format off
+    std::array matrix = {1.f, 0.f, 0.f, 0.f,
+                         0.f, 1.f, 0.f, 0.f,
+                         0.f, 0.f, 1.f, 0.f,
+                         0.f, 0.f, 0.f, 1.f};
+    // clang-format on
+
+    // If non-normalized coordinates (= pixels) are requested, we need to
+    // setup scale factors that convert the range [0 .. size] to [0 .. 1]
+    if (coordinateType == CoordinateType::Pixels)
+    {
+        matrix[0] = 1.f / static_cast<float>(m_actualSize.x);
+        matrix[5] = 1.f / static_cast<float>(m_actualSize.y);
+    }
+
+    // If normalized coordinates are used when NPOT textures aren't supported,
+    // then we need to setup scale factors to make the coordinates relative to the actual POT size
+    if ((coordinateType == CoordinateType::Normalized) && (m_size != m_actualSize))
+    {
+        matrix[0] = static_cast<float>(m_size.x) / static_cast<float>(m_actualSize.x);
+        matrix[5] = static_cast<float>(m_size.y) / static_cast<float>(m_actualSize.y);
+    }
+
+    // If pixels are flipped we must invert the Y axis
+    if (m_pixelsFlipped)
+    {
+        matrix[5]  = -matrix[5];
+        matrix[13] = static_cast<float>(m_size.y) / static_cast<float>(m_actualSize.y);
+    }
+
+    return matrix;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::invalidateMipmap()
 {
@@ -925,6 +1732,9 @@ void Texture::bind(const Texture* texture, CoordinateType coordinateType)
 {
     const TransientContextLock lock;
 
+    // Core profile contexts have no texture matrix, shaders receive it as a uniform instead
+    const bool loadTextureMatrix = !priv::isCoreProfileActive();
+
     if (texture && texture->m_texture)
     {
         // When debugging, ensure that the texture name is valid
@@ -934,65 +1744,31 @@ void Texture::bind(const Texture* texture, CoordinateType coordinateType)
         // Bind the texture
         glCheck(glBindTexture(GL_TEXTURE_2D, texture->m_texture));
 
-        // Check if we need to define a special texture matrix
-        if ((coordinateType == CoordinateType::Pixels) || texture->m_pixelsFlipped ||
-            ((coordinateType == CoordinateType::Normalized) && (texture->m_size != texture->m_actualSize)))
+        if (loadTextureMatrix)
         {
-            // clang-format off
-            std::array matrix = {1.f, 0.f, 0.f, 0.f,
-                                 0.f, 1.f, 0.f, 0.f,
-                                 0.f, 0.f, 1.f, 0.f,
-                                 0.f, 0.f, 0.f, 1.f};
-            // clang-format on
-
-            // If non-normalized coordinates (= pixels) are requested, we need to
-            // setup scale factors that convert the range [0 .. size] to [0 .. 1]
-            if (coordinateType == CoordinateType::Pixels)
-            {
-                matrix[0] = 1.f / static_cast<float>(texture->m_actualSize.x);
-                matrix[5] = 1.f / static_cast<float>(texture->m_actualSize.y);
-            }
-
-            // If normalized coordinates are used when NPOT textures aren't supported,
-            // then we need to setup scale factors to make the coordinates relative to the actual POT size
-            if ((coordinateType == CoordinateType::Normalized) && (texture->m_size != texture->m_actualSize))
-            {
-                matrix[0] = static_cast<float>(texture->m_size.x) / static_cast<float>(texture->m_actualSize.x);
-                matrix[5] = static_cast<float>(texture->m_size.y) / static_cast<float>(texture->m_actualSize.y);
-            }
-
-            // If pixels are flipped we must invert the Y axis
-            if (texture->m_pixelsFlipped)
-            {
-                matrix[5]  = -matrix[5];
-                matrix[13] = static_cast<float>(texture->m_size.y) / static_cast<float>(texture->m_actualSize.y);
-            }
-
-            // Load the matrix
+            // Check if we need to define a special texture matrix
+            const std::array matrix = texture->getTextureMatrix(coordinateType);
             glCheck(glMatrixMode(GL_TEXTURE));
             glCheck(glLoadMatrixf(matrix.data()));
-        }
-        else
-        {
-            // Reset the texture matrix
-            glCheck(glMatrixMode(GL_TEXTURE));
-            glCheck(glLoadIdentity());
-        }
 
-        // Go back to model-view mode (sf::RenderTarget relies on it)
-        glCheck(glMatrixMode(GL_MODELVIEW));
+            // Go back to model-view mode (sf::RenderTarget relies on it)
+            glCheck(glMatrixMode(GL_MODELVIEW));
+        }
     }
     else
     {
         // Bind no texture
         glCheck(glBindTexture(GL_TEXTURE_2D, 0));
 
-        // Reset the texture matrix
-        glCheck(glMatrixMode(GL_TEXTURE));
-        glCheck(glLoadIdentity());
+        if (loadTextureMatrix)
+        {
+            // Reset the texture matrix
+            glCheck(glMatrixMode(GL_TEXTURE));
+            glCheck(glLoadIdentity());
 
-        // Go back to model-view mode (sf::RenderTarget relies on it)
-        glCheck(glMatrixMode(GL_MODELVIEW));
+            // Go back to model-view mode (sf::RenderTarget relies on it)
+            glCheck(glMatrixMode(GL_MODELVIEW));
+        }
     }
 }
 
@@ -1018,6 +1794,23 @@ unsigned int Texture::getMaximumSize()
 }
 
 
+////////////////////////////////////////////////////////////
+bool Texture::isAsyncUpdateAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock transientLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_pixel_buffer_object != 0;
+    }();
+
+    return available;
+}
+
+
 ////////////////////////////////////////////////////////////
 Texture& Texture::operator=(const Texture& right)
 {
@@ -1041,7 +1834,10 @@ void Texture::swap(Texture& right) noexcept
     std::swap(m_pixelsFlipped, right.m_pixelsFlipped);
     std::swap(m_fboAttachment, right.m_fboAttachment);
     std::swap(m_hasMipmap, right.m_hasMipmap);
+    std::swap(m_isCompressed, right.m_isCompressed);
     std::swap(m_cacheId, right.m_cacheId);
+    std::swap(m_stagingPool, right.m_stagingPool);
+    std::swap(m_readbackRing, right.m_readbackRing);
 }
 
 
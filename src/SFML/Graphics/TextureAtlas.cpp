@@ -0,0 +1,499 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextureAtlas.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cassert>
+#include <cstddef>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TextureAtlasImpl
+{
+// Identification of the layout files, followed by the version of their format
+constexpr const char* layoutMagic   = "sfml-texture-atlas";
+constexpr unsigned    layoutVersion = 1;
+
+// Tell whether a rectangle is entirely inside another one
+bool contains(const sf::IntRect& outer, const sf::IntRect& inner)
+{
+    return (inner.position.x >= outer.position.x) && (inner.position.y >= outer.position.y) &&
+           (inner.position.x + inner.size.x <= outer.position.x + outer.size.x) &&
+           (inner.position.y + inner.size.y <= outer.position.y + outer.size.y);
+}
+
+// Find the free rectangle which leaves the shortest side after placing a slot (best short side fit)
+std::optional<sf::IntRect> findPosition(const std::vector<sf::IntRect>& freeRects, sf::Vector2i size)
+{
+    std::optional<sf::IntRect> bestRect;
+    int                        bestShortSide = std::numeric_limits<int>::max();
+    int                        bestLongSide  = std::numeric_limits<int>::max();
+
+    for (const sf::IntRect& freeRect : freeRects)
+    {
+        if ((freeRect.size.x < size.x) || (freeRect.size.y < size.y))
+            continue;
+
+        const int leftoverX = freeRect.size.x - size.x;
+        const int leftoverY = freeRect.size.y - size.y;
+        const int shortSide = std::min(leftoverX, leftoverY);
+        const int longSide  = std::max(leftoverX, leftoverY);
+
+        if ((shortSide < bestShortSide) || ((shortSide == bestShortSide) && (longSide < bestLongSide)))
+        {
+            bestRect      = sf::IntRect(freeRect.position, size);
+            bestShortSide = shortSide;
+            bestLongSide  = longSide;
+        }
+    }
+
+    return bestRect;
+}
+
+// Remove a used rectangle from the free space, which stays described by its maximal free rectangles
+void splitFreeRects(std::vector<sf::IntRect>& freeRects, const sf::IntRect& used)
+{
+    const int usedRight  = used.position.x + used.size.x;
+    const int usedBottom = used.position.y + used.size.y;
+
+    std::vector<sf::IntRect> newRects;
+
+    for (auto it = freeRects.begin(); it != freeRects.end();)
+    {
+        if (!it->findIntersection(used))
+        {
+            ++it;
+            continue;
+        }
+
+        // Keep the parts of the free rectangle on each side of the used one
+        const sf::IntRect freeRect   = *it;
+        const int         freeRight  = freeRect.position.x + freeRect.size.x;
+        const int         freeBottom = freeRect.position.y + freeRect.size.y;
+
+        if (used.position.x > freeRect.position.x)
+            newRects.emplace_back(freeRect.position,
+                                  sf::Vector2i(used.position.x - freeRect.position.x, freeRect.size.y));
+
+        if (usedRight < freeRight)
+            newRects.emplace_back(sf::Vector2i(usedRight, freeRect.position.y),
+                                  sf::Vector2i(freeRight - usedRight, freeRect.size.y));
+
+        if (used.position.y > freeRect.position.y)
+            newRects.emplace_back(freeRect.position,
+                                  sf::Vector2i(freeRect.size.x, used.position.y - freeRect.position.y));
+
+        if (usedBottom < freeBottom)
+            newRects.emplace_back(sf::Vector2i(freeRect.position.x, usedBottom),
+                                  sf::Vector2i(freeRect.size.x, freeBottom - usedBottom));
+
+        it = freeRects.erase(it);
+    }
+
+    // The remaining free rectangles are maximal, only the new ones can be
+    // contained in another rectangle (including duplicates among them)
+    for (std::size_t i = 0; i < newRects.size(); ++i)
+    {
+        bool isRedundant = false;
+
+        for (std::size_t j = 0; (j < newRects.size()) && !isRedundant; ++j)
+            isRedundant = (i != j) && contains(newRects[j], newRects[i]) && ((newRects[i] != newRects[j]) || (j < i));
+
+        for (std::size_t j = 0; (j < freeRects.size()) && !isRedundant; ++j)
+            isRedundant = contains(freeRects[j], newRects[i]);
+
+        if (!isRedundant)
+            freeRects.push_back(newRects[i]);
+    }
+}
+} // namespace TextureAtlasImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(Vector2u pageSize, unsigned int padding, bool extrude) :
+    m_pageSize(pageSize),
+    m_padding(padding),
+    m_extrude(extrude)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::Handle TextureAtlas::add(Image image)
+{
+    const Handle handle = m_entries.size();
+
+    m_entries.emplace_back();
+    m_pending.emplace_back(handle, std::move(image));
+
+    return handle;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::pack()
+{
+    const auto     border   = static_cast<int>(m_padding);
+    const Vector2i pageSize = Vector2i(m_pageSize);
+    bool           success  = true;
+
+    std::vector<std::size_t> searched;
+    searched.reserve(m_pending.size());
+
+    // If a page cannot be created, the images placed so far are removed from
+    // the pending list so that the next call doesn't pack them a second time
+    std::vector<bool> placed(m_pending.size());
+    const auto        failPacking = [this, &placed]
+    {
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < m_pending.size(); ++i)
+        {
+            if (placed[i])
+                continue;
+
+            if (kept != i)
+                m_pending[kept] = std::move(m_pending[i]);
+            ++kept;
+        }
+
+        m_pending.erase(m_pending.begin() + static_cast<std::ptrdiff_t>(kept), m_pending.end());
+        return false;
+    };
+
+    for (std::size_t i = 0; i < m_pending.size(); ++i)
+    {
+        const auto& [handle, image] = m_pending[i];
+
+        if (handle >= m_layout.size())
+        {
+            searched.push_back(i);
+            continue;
+        }
+
+        // Place the image where the layout file says if it has the same size
+        // and that area is still free, otherwise search for a new position
+        const Entry&   entry      = m_layout[handle];
+        const Vector2i imageSize  = Vector2i(image.getSize());
+        const bool     isSameSize = (entry.rect.size == imageSize) && (imageSize.x > 0) && (imageSize.y > 0);
+        const IntRect  slot(entry.rect.position - Vector2i(border, border),
+                           imageSize + Vector2i(2 * border, 2 * border));
+
+        while (isSameSize && (m_pages.size() <= entry.page))
+        {
+            if (!addPage())
+                return failPacking();
+        }
+
+        if (!isSameSize || std::none_of(m_pages[entry.page].freeRects.begin(),
+                                        m_pages[entry.page].freeRects.end(),
+                                        [&slot](const IntRect& freeRect)
+                                        { return TextureAtlasImpl::contains(freeRect, slot); }))
+        {
+            searched.push_back(i);
+            continue;
+        }
+
+        TextureAtlasImpl::splitFreeRects(m_pages[entry.page].freeRects, slot);
+        m_entries[handle] = entry;
+        upload(image, entry);
+        placed[i] = true;
+    }
+
+    // Place the largest images first, they are the hardest to fit
+    std::sort(searched.begin(),
+              searched.end(),
+              [this](std::size_t left, std::size_t right)
+              {
+                  const Vector2u leftSize  = m_pending[left].second.getSize();
+                  const Vector2u rightSize = m_pending[right].second.getSize();
+
+                  if (std::max(leftSize.x, leftSize.y) != std::max(rightSize.x, rightSize.y))
+                      return std::max(leftSize.x, leftSize.y) > std::max(rightSize.x, rightSize.y);
+
+                  return leftSize.x * leftSize.y > rightSize.x * rightSize.y;
+              });
+
+    for (const std::size_t index : searched)
+    {
+        const auto& [handle, image] = m_pending[index];
+        const Vector2i imageSize    = Vector2i(image.getSize());
+        const Vector2i slotSize     = imageSize + Vector2i(2 * border, 2 * border);
+
+        if ((imageSize.x == 0) || (imageSize.y == 0) || (slotSize.x > pageSize.x) || (slotSize.y > pageSize.y))
+        {
+            err() << "Failed to pack image in texture atlas, invalid size (" << imageSize.x << "x" << imageSize.y
+                  << ", texture size is " << m_pageSize.x << "x" << m_pageSize.y << ")" << std::endl;
+            success = false;
+            continue;
+        }
+
+        // Use the first texture with enough free space, or a new one
+        std::optional<IntRect> slot;
+        std::size_t            pageIndex = 0;
+
+        for (; (pageIndex < m_pages.size()) && !slot; ++pageIndex)
+            slot = TextureAtlasImpl::findPosition(m_pages[pageIndex].freeRects, slotSize);
+
+        if (slot)
+        {
+            --pageIndex;
+        }
+        else
+        {
+            if (!addPage())
+                return failPacking();
+
+            slot = TextureAtlasImpl::findPosition(m_pages[pageIndex].freeRects, slotSize);
+            assert(slot && "Image doesn't fit in an empty texture atlas page");
+        }
+
+        TextureAtlasImpl::splitFreeRects(m_pages[pageIndex].freeRects, *slot);
+
+        Entry& entry = m_entries[handle];
+        entry.page   = pageIndex;
+        entry.rect   = IntRect(slot->position + Vector2i(border, border), imageSize);
+        upload(image, entry);
+        placed[index] = true;
+    }
+
+    m_pending.clear();
+
+    return success;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TextureAtlas::getTexture(Handle handle) const
+{
+    assert(handle < m_entries.size() && "Invalid texture atlas handle");
+    assert(m_entries[handle].rect.size != Vector2i() && "Image was not packed in the texture atlas");
+
+    return m_pages[m_entries[handle].page].texture;
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect TextureAtlas::getTextureRect(Handle handle) const
+{
+    assert(handle < m_entries.size() && "Invalid texture atlas handle");
+
+    return m_entries[handle].rect;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureAtlas::getImageCount() const
+{
+    return m_entries.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureAtlas::getPageCount() const
+{
+    return m_pages.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TextureAtlas::getPage(std::size_t index) const
+{
+    assert(index < m_pages.size() && "Index is out of bounds");
+
+    return m_pages[index].texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::setSmooth(bool smooth)
+{
+    m_isSmooth = smooth;
+
+    for (Page& page : m_pages)
+        page.texture.setSmooth(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::saveLayoutToFile(const std::filesystem::path& filename) const
+{
+    std::ofstream file(filename);
+
+    file << TextureAtlasImpl::layoutMagic << ' ' << TextureAtlasImpl::layoutVersion << '\n'
+         << m_pageSize.x << ' ' << m_pageSize.y << ' ' << m_padding << ' ' << m_extrude << '\n'
+         << m_entries.size() << '\n';
+
+    for (const Entry& entry : m_entries)
+        file << entry.page << ' ' << entry.rect.position.x << ' ' << entry.rect.position.y << ' ' << entry.rect.size.x
+             << ' ' << entry.rect.size.y << '\n';
+
+    if (!file)
+    {
+        err() << "Failed to save texture atlas layout\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::loadLayoutFromFile(const std::filesystem::path& filename)
+{
+    std::ifstream file(filename);
+    if (!file)
+    {
+        err() << "Failed to open texture atlas layout\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    std::string  magic;
+    unsigned int version = 0;
+    Vector2u     pageSize;
+    unsigned int padding = 0;
+    bool         extrude = false;
+    std::size_t  count   = 0;
+
+    if (!(file >> magic >> version) || (magic != TextureAtlasImpl::layoutMagic) ||
+        (version != TextureAtlasImpl::layoutVersion) ||
+        !(file >> pageSize.x >> pageSize.y >> padding >> extrude >> count))
+    {
+        err() << "Failed to load texture atlas layout, invalid header\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    if ((pageSize != m_pageSize) || (padding != m_padding) || (extrude != m_extrude))
+    {
+        err() << "Failed to load texture atlas layout, it was saved with different settings\n"
+              << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    std::vector<Entry> layout;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Entry entry;
+        if (!(file >> entry.page >> entry.rect.position.x >> entry.rect.position.y >> entry.rect.size.x >>
+              entry.rect.size.y))
+        {
+            err() << "Failed to load texture atlas layout, truncated entries\n"
+                  << formatDebugPathInfo(filename) << std::endl;
+            return false;
+        }
+
+        // An image can't be on a page that wouldn't contain any other image
+        if (entry.page > i)
+            entry.rect = {};
+
+        layout.push_back(entry);
+    }
+
+    m_layout = std::move(layout);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::addPage()
+{
+    Texture texture;
+    if (!texture.resize(m_pageSize))
+    {
+        err() << "Failed to create texture atlas page" << std::endl;
+        return false;
+    }
+
+    texture.setSmooth(m_isSmooth);
+    m_pages.push_back({std::move(texture), {IntRect({0, 0}, Vector2i(m_pageSize))}});
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::upload(const Image& image, const Entry& entry)
+{
+    Texture& texture = m_pages[entry.page].texture;
+
+    if (m_padding == 0)
+    {
+        texture.update(image, Vector2u(entry.rect.position));
+        return;
+    }
+
+    // Upload the padding along with the image, so that it doesn't keep
+    // the undefined content of the texture
+    const Vector2u size = image.getSize();
+    const Vector2u slotSize(size.x + 2 * m_padding, size.y + 2 * m_padding);
+    Image          slot(slotSize, Color::Transparent);
+
+    [[maybe_unused]] const bool copied = slot.copy(image, {m_padding, m_padding});
+    assert(copied && "Failed to copy image to its texture atlas slot");
+
+    if (m_extrude)
+    {
+        // Repeat the border pixels of the image in the padding
+        for (unsigned int y = 0; y < slotSize.y; ++y)
+        {
+            const unsigned int sourceY    = std::clamp(y, m_padding, m_padding + size.y - 1);
+            const bool         isImageRow = (sourceY == y);
+
+            for (unsigned int x = 0; x < slotSize.x; ++x)
+            {
+                // Skip the pixels of the image itself
+                if (isImageRow && (x == m_padding))
+                    x += size.x;
+
+                const unsigned int sourceX = std::clamp(x, m_padding, m_padding + size.x - 1);
+                slot.setPixel({x, y}, slot.getPixel({sourceX, sourceY}));
+            }
+        }
+    }
+
+    texture.update(slot, Vector2u(entry.rect.position) - Vector2u(m_padding, m_padding));
+}
+
+} // namespace sf
@@ -0,0 +1,1143 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextureCompression.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <ostream>
+#include <utility>
+
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TextureCompressionImpl
+{
+using sf::priv::CompressedFormat;
+using sf::priv::CompressedImage;
+
+// Decoded 4x4 block of RGBA pixels, row by row
+using Block = std::array<std::uint8_t, 64>;
+
+// Signatures of the supported containers
+constexpr std::array<std::uint8_t, 4> ddsSignature = {'D', 'D', 'S', ' '};
+constexpr std::array<std::uint8_t, 12>
+    ktxSignature = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'};
+constexpr std::array<std::uint8_t, 12>
+    ktx2Signature = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+// Larger images are rejected, so that computing their size can't overflow
+constexpr std::uint32_t maxDimension = 65536;
+
+////////////////////////////////////////////////////////////
+template <std::size_t N>
+bool hasSignature(const std::uint8_t* data, std::size_t size, const std::array<std::uint8_t, N>& signature)
+{
+    return (size >= N) && std::equal(signature.begin(), signature.end(), data);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t readUint32(const std::uint8_t* data, bool bigEndian = false)
+{
+    if (bigEndian)
+        return (std::uint32_t{data[0]} << 24) | (std::uint32_t{data[1]} << 16) | (std::uint32_t{data[2]} << 8) |
+               std::uint32_t{data[3]};
+
+    return std::uint32_t{data[0]} | (std::uint32_t{data[1]} << 8) | (std::uint32_t{data[2]} << 16) |
+           (std::uint32_t{data[3]} << 24);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t readUint64(const std::uint8_t* data)
+{
+    return std::uint64_t{readUint32(data)} | (std::uint64_t{readUint32(data + 4)} << 32);
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr std::uint32_t makeFourCc(const char (&code)[5])
+{
+    return static_cast<std::uint32_t>(code[0]) | (static_cast<std::uint32_t>(code[1]) << 8) |
+           (static_cast<std::uint32_t>(code[2]) << 16) | (static_cast<std::uint32_t>(code[3]) << 24);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t getBlockSize(CompressedFormat format)
+{
+    switch (format)
+    {
+        case CompressedFormat::Bc1:
+        case CompressedFormat::Bc4:
+        case CompressedFormat::Etc2Rgb:
+            return 8;
+        default:
+            return 16;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Vector2u getNextLevelSize(sf::Vector2u size)
+{
+    return {std::max(size.x / 2, 1u), std::max(size.y / 2, 1u)};
+}
+
+
+////////////////////////////////////////////////////////////
+bool checkSize(sf::Vector2u size, const char* container)
+{
+    if ((size.x == 0) || (size.y == 0) || (size.x > maxDimension) || (size.y > maxDimension))
+    {
+        sf::err() << "Failed to load " << container << " image, invalid size (" << size.x << "x" << size.y << ")"
+                  << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<CompressedImage> loadDds(const std::uint8_t* data, std::size_t size)
+{
+    // Magic number followed by the header of 124 bytes
+    std::size_t offset = 128;
+    if ((size < offset) || (readUint32(data + 4) != 124))
+    {
+        sf::err() << "Failed to load DDS image, invalid header" << std::endl;
+        return std::nullopt;
+    }
+
+    const std::uint8_t* header          = data + 4;
+    const std::uint32_t flags           = readUint32(header + 4);
+    const std::uint32_t mipmapCount     = readUint32(header + 24);
+    const std::uint32_t pixelFormatFlag = readUint32(header + 76);
+    const std::uint32_t fourCc          = readUint32(header + 80);
+    const std::uint32_t caps2           = readUint32(header + 108);
+
+    CompressedImage image;
+    image.size = {readUint32(header + 12), readUint32(header + 8)};
+
+    if (!checkSize(image.size, "DDS"))
+        return std::nullopt;
+
+    // Cube maps and volume textures
+    if ((caps2 & 0x200u) || (caps2 & 0x200000u))
+    {
+        sf::err() << "Failed to load DDS image, only 2D textures are supported" << std::endl;
+        return std::nullopt;
+    }
+
+    // Pixel format with a four character code
+    bool isFormatSupported = (pixelFormatFlag & 0x4u) != 0;
+
+    if (isFormatSupported && (fourCc == makeFourCc("DX10")))
+    {
+        // Extended header
+        if (size < offset + 20)
+        {
+            sf::err() << "Failed to load DDS image, invalid header" << std::endl;
+            return std::nullopt;
+        }
+
+        const std::uint32_t dxgiFormat = readUint32(data + offset);
+        const std::uint32_t dimension  = readUint32(data + offset + 4);
+        const std::uint32_t miscFlags  = readUint32(data + offset + 8);
+        const std::uint32_t arraySize  = readUint32(data + offset + 12);
+        offset += 20;
+
+        if ((dimension != 3) || (miscFlags & 0x4u) || (arraySize > 1))
+        {
+            sf::err() << "Failed to load DDS image, only 2D textures are supported" << std::endl;
+            return std::nullopt;
+        }
+
+        switch (dxgiFormat)
+        {
+            // clang-format off
+            case 71: image.format = CompressedFormat::Bc1; break;
+            case 72: image.format = CompressedFormat::Bc1; image.sRgb = true; break;
+            case 74: image.format = CompressedFormat::Bc2; break;
+            case 75: image.format = CompressedFormat::Bc2; image.sRgb = true; break;
+            case 77: image.format = CompressedFormat::Bc3; break;
+            case 78: image.format = CompressedFormat::Bc3; image.sRgb = true; break;
+            case 80: image.format = CompressedFormat::Bc4; break;
+            case 83: image.format = CompressedFormat::Bc5; break;
+            case 98: image.format = CompressedFormat::Bc7; break;
+            case 99: image.format = CompressedFormat::Bc7; image.sRgb = true; break;
+            default: isFormatSupported = false; break;
+            // clang-format on
+        }
+    }
+    else if (isFormatSupported)
+    {
+        if ((fourCc == makeFourCc("DXT1")))
+            image.format = CompressedFormat::Bc1;
+        else if ((fourCc == makeFourCc("DXT2")) || (fourCc == makeFourCc("DXT3")))
+            image.format = CompressedFormat::Bc2;
+        else if ((fourCc == makeFourCc("DXT4")) || (fourCc == makeFourCc("DXT5")))
+            image.format = CompressedFormat::Bc3;
+        else if ((fourCc == makeFourCc("ATI1")) || (fourCc == makeFourCc("BC4U")))
+            image.format = CompressedFormat::Bc4;
+        else if ((fourCc == makeFourCc("ATI2")) || (fourCc == makeFourCc("BC5U")))
+            image.format = CompressedFormat::Bc5;
+        else
+            isFormatSupported = false;
+    }
+
+    if (!isFormatSupported)
+    {
+        sf::err() << "Failed to load DDS image, unsupported pixel format" << std::endl;
+        return std::nullopt;
+    }
+
+    // The levels are stored one after the other, from the largest to the smallest
+    const std::uint32_t levelCount = (flags & 0x20000u) ? std::max(mipmapCount, 1u) : 1u;
+    sf::Vector2u        levelSize  = image.size;
+
+    for (std::uint32_t level = 0; level < levelCount; ++level)
+    {
+        const std::size_t levelBytes = sf::priv::getCompressedSize(image.format, levelSize);
+        if (size - offset < levelBytes)
+        {
+            sf::err() << "Failed to load DDS image, truncated data" << std::endl;
+            return std::nullopt;
+        }
+
+        image.levels.emplace_back(data + offset, data + offset + levelBytes);
+        offset += levelBytes;
+
+        if (levelSize == sf::Vector2u(1, 1))
+            break;
+
+        levelSize = getNextLevelSize(levelSize);
+    }
+
+    return image;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<CompressedImage> loadKtx(const std::uint8_t* data, std::size_t size)
+{
+    // Signature followed by the header of 13 32-bit fields
+    std::size_t offset = 64;
+    if (size < offset)
+    {
+        sf::err() << "Failed to load KTX image, invalid header" << std::endl;
+        return std::nullopt;
+    }
+
+    // The fields are written with the endianness of the writer
+    const bool bigEndian = readUint32(data + 12) == 0x01020304u;
+    const auto readField = [data, bigEndian](std::size_t fieldOffset)
+    { return readUint32(data + fieldOffset, bigEndian); };
+
+    const std::uint32_t glType         = readField(16);
+    const std::uint32_t internalFormat = readField(28);
+    const std::uint32_t depth          = readField(44);
+    const std::uint32_t arraySize      = readField(48);
+    const std::uint32_t faceCount      = readField(52);
+    const std::uint32_t levelCount     = std::max(readField(56), 1u);
+    const std::uint32_t keyValueBytes  = readField(60);
+
+    CompressedImage image;
+    image.size = {readField(36), readField(40)};
+
+    if (!checkSize(image.size, "KTX"))
+        return std::nullopt;
+
+    if ((depth > 1) || (arraySize > 0) || (faceCount != 1))
+    {
+        sf::err() << "Failed to load KTX image, only 2D textures are supported" << std::endl;
+        return std::nullopt;
+    }
+
+    bool isFormatSupported = (glType == 0);
+
+    switch (internalFormat)
+    {
+        // clang-format off
+        case 0x83F0: // GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+        case 0x83F1: image.format = CompressedFormat::Bc1; break;
+        case 0x8C4C: // GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+        case 0x8C4D: image.format = CompressedFormat::Bc1; image.sRgb = true; break;
+        case 0x83F2: image.format = CompressedFormat::Bc2; break;
+        case 0x8C4E: image.format = CompressedFormat::Bc2; image.sRgb = true; break;
+        case 0x83F3: image.format = CompressedFormat::Bc3; break;
+        case 0x8C4F: image.format = CompressedFormat::Bc3; image.sRgb = true; break;
+        case 0x8DBB: image.format = CompressedFormat::Bc4; break;
+        case 0x8DBD: image.format = CompressedFormat::Bc5; break;
+        case 0x8E8C: image.format = CompressedFormat::Bc7; break;
+        case 0x8E8D: image.format = CompressedFormat::Bc7; image.sRgb = true; break;
+        case 0x8D64: // GL_ETC1_RGB8_OES
+        case 0x9274: image.format = CompressedFormat::Etc2Rgb; break;
+        case 0x9275: image.format = CompressedFormat::Etc2Rgb; image.sRgb = true; break;
+        case 0x9278: image.format = CompressedFormat::Etc2Rgba; break;
+        case 0x9279: image.format = CompressedFormat::Etc2Rgba; image.sRgb = true; break;
+        default: isFormatSupported = false; break;
+        // clang-format on
+    }
+
+    if (!isFormatSupported)
+    {
+        sf::err() << "Failed to load KTX image, unsupported internal format (0x" << std::hex << internalFormat
+                  << std::dec << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    // Each level is preceded by its size and padded to 4 bytes
+    if (size - offset < keyValueBytes)
+    {
+        sf::err() << "Failed to load KTX image, truncated data" << std::endl;
+        return std::nullopt;
+    }
+
+    offset += keyValueBytes;
+    sf::Vector2u levelSize = image.size;
+
+    for (std::uint32_t level = 0; level < levelCount; ++level)
+    {
+        const std::size_t levelBytes = sf::priv::getCompressedSize(image.format, levelSize);
+        if ((size - offset < 4) || (readField(offset) != levelBytes) || (size - offset - 4 < levelBytes))
+        {
+            sf::err() << "Failed to load KTX image, truncated data" << std::endl;
+            return std::nullopt;
+        }
+
+        offset += 4;
+        image.levels.emplace_back(data + offset, data + offset + levelBytes);
+        offset += std::min((levelBytes + 3) & ~std::size_t{3}, size - offset);
+
+        levelSize = getNextLevelSize(levelSize);
+    }
+
+    return image;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<CompressedImage> loadKtx2(const std::uint8_t* data, std::size_t size)
+{
+    // Signature followed by the header and the index, then one entry per level
+    constexpr std::size_t levelIndexOffset = 80;
+    if (size < levelIndexOffset)
+    {
+        sf::err() << "Failed to load KTX2 image, invalid header" << std::endl;
+        return std::nullopt;
+    }
+
+    const std::uint32_t vkFormat         = readUint32(data + 12);
+    const std::uint32_t depth            = readUint32(data + 28);
+    const std::uint32_t layerCount       = readUint32(data + 32);
+    const std::uint32_t faceCount        = readUint32(data + 36);
+    const std::uint32_t levelCount       = std::max(readUint32(data + 40), 1u);
+    const std::uint32_t supercompression = readUint32(data + 44);
+
+    CompressedImage image;
+    image.size = {readUint32(data + 20), readUint32(data + 24)};
+
+    if (!checkSize(image.size, "KTX2"))
+        return std::nullopt;
+
+    if ((depth > 0) || (layerCount > 0) || (faceCount != 1))
+    {
+        sf::err() << "Failed to load KTX2 image, only 2D textures are supported" << std::endl;
+        return std::nullopt;
+    }
+
+    if (supercompression != 0)
+    {
+        sf::err() << "Failed to load KTX2 image, supercompression (Basis Universal, Zstandard) is not supported"
+                  << std::endl;
+        return std::nullopt;
+    }
+
+    bool isFormatSupported = true;
+
+    switch (vkFormat)
+    {
+        // clang-format off
+        case 131: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+        case 133: image.format = CompressedFormat::Bc1; break;
+        case 132: // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+        case 134: image.format = CompressedFormat::Bc1; image.sRgb = true; break;
+        case 135: image.format = CompressedFormat::Bc2; break;
+        case 136: image.format = CompressedFormat::Bc2; image.sRgb = true; break;
+        case 137: image.format = CompressedFormat::Bc3; break;
+        case 138: image.format = CompressedFormat::Bc3; image.sRgb = true; break;
+        case 139: image.format = CompressedFormat::Bc4; break;
+        case 141: image.format = CompressedFormat::Bc5; break;
+        case 145: image.format = CompressedFormat::Bc7; break;
+        case 146: image.format = CompressedFormat::Bc7; image.sRgb = true; break;
+        case 147: image.format = CompressedFormat::Etc2Rgb; break;
+        case 148: image.format = CompressedFormat::Etc2Rgb; image.sRgb = true; break;
+        case 151: image.format = CompressedFormat::Etc2Rgba; break;
+        case 152: image.format = CompressedFormat::Etc2Rgba; image.sRgb = true; break;
+        default: isFormatSupported = false; break;
+        // clang-format on
+    }
+
+    if (!isFormatSupported)
+    {
+        sf::err() << "Failed to load KTX2 image, unsupported format (" << vkFormat << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    if ((size - levelIndexOffset) / 24 < levelCount)
+    {
+        sf::err() << "Failed to load KTX2 image, truncated level index" << std::endl;
+        return std::nullopt;
+    }
+
+    sf::Vector2u levelSize = image.size;
+
+    for (std::uint32_t level = 0; level < levelCount; ++level)
+    {
+        const std::uint8_t* entry       = data + levelIndexOffset + std::size_t{level} * 24;
+        const std::uint64_t levelOffset = readUint64(entry);
+        const std::uint64_t levelBytes  = readUint64(entry + 8);
+
+        if ((levelBytes != sf::priv::getCompressedSize(image.format, levelSize)) || (levelOffset > size) ||
+            (size - levelOffset < levelBytes))
+        {
+            sf::err() << "Failed to load KTX2 image, invalid level " << level << std::endl;
+            return std::nullopt;
+        }
+
+        const std::uint8_t* levelData = data + static_cast<std::size_t>(levelOffset);
+        image.levels.emplace_back(levelData, levelData + static_cast<std::size_t>(levelBytes));
+
+        levelSize = getNextLevelSize(levelSize);
+    }
+
+    return image;
+}
+
+
+////////////////////////////////////////////////////////////
+// Block decoders
+////////////////////////////////////////////////////////////
+
+// Modifiers of the ETC1/ETC2 individual and differential modes
+constexpr std::array<std::array<int, 4>, 8> etcModifiers = {{{2, 8, -2, -8},
+                                                             {5, 17, -5, -17},
+                                                             {9, 29, -9, -29},
+                                                             {13, 42, -13, -42},
+                                                             {18, 60, -18, -60},
+                                                             {24, 80, -24, -80},
+                                                             {33, 106, -33, -106},
+                                                             {47, 183, -47, -183}}};
+
+// Distances of the ETC2 T and H modes
+constexpr std::array<int, 8> etcDistances = {3, 6, 11, 16, 23, 32, 41, 64};
+
+// Modifiers of the EAC alpha channel
+constexpr std::array<std::array<int, 8>, 16> eacModifiers = {{{-3, -6, -9, -15, 2, 5, 8, 14},
+                                                              {-3, -7, -10, -13, 2, 6, 9, 12},
+                                                              {-2, -5, -8, -13, 1, 4, 7, 12},
+                                                              {-2, -4, -6, -13, 1, 3, 5, 12},
+                                                              {-3, -6, -8, -12, 2, 5, 7, 11},
+                                                              {-3, -7, -9, -11, 2, 6, 8, 10},
+                                                              {-4, -7, -8, -11, 3, 6, 7, 10},
+                                                              {-3, -5, -8, -11, 2, 4, 7, 10},
+                                                              {-2, -6, -8, -10, 1, 5, 7, 9},
+                                                              {-2, -5, -8, -10, 1, 4, 7, 9},
+                                                              {-2, -4, -8, -10, 1, 3, 7, 9},
+                                                              {-2, -5, -7, -10, 1, 4, 6, 9},
+                                                              {-3, -4, -7, -10, 2, 3, 6, 9},
+                                                              {-1, -2, -3, -10, 0, 1, 2, 9},
+                                                              {-4, -6, -8, -9, 3, 5, 7, 8},
+                                                              {-3, -5, -7, -9, 2, 4, 6, 8}}};
+
+// Bit counts of the 8 BC7 modes
+struct Bc7Mode
+{
+    unsigned int subsets;
+    unsigned int partitionBits;
+    unsigned int rotationBits;
+    unsigned int indexSelectionBits;
+    unsigned int colorBits;
+    unsigned int alphaBits;
+    unsigned int endpointPBits;
+    unsigned int sharedPBits;
+    unsigned int indexBits;
+    unsigned int secondaryIndexBits;
+};
+
+constexpr std::array<Bc7Mode, 8> bc7Modes = {{{3, 4, 0, 0, 4, 0, 1, 0, 3, 0},
+                                              {2, 6, 0, 0, 6, 0, 0, 1, 3, 0},
+                                              {3, 6, 0, 0, 5, 0, 0, 0, 2, 0},
+                                              {2, 6, 0, 0, 7, 0, 1, 0, 2, 0},
+                                              {1, 0, 2, 1, 5, 6, 0, 0, 2, 3},
+                                              {1, 0, 2, 0, 7, 8, 0, 0, 2, 2},
+                                              {1, 0, 0, 0, 7, 7, 1, 0, 4, 0},
+                                              {2, 6, 0, 0, 5, 5, 1, 0, 2, 0}}};
+
+// Interpolation weights of the BC7 indices, by index size
+constexpr std::array<std::uint8_t, 4>  bc7Weights2 = {0, 21, 43, 64};
+constexpr std::array<std::uint8_t, 8>  bc7Weights3 = {0, 9, 18, 27, 37, 46, 55, 64};
+constexpr std::array<std::uint8_t, 16> bc7Weights4 = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+// Subsets of the BC7 partitions: one bit per pixel for 2 subsets, one entry per pixel for 3 subsets
+// clang-format off
+constexpr std::array<std::uint16_t, 64> bc7Partitions2 = {
+    0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+    0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+    0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+    0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+    0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+    0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+    0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+    0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22,
+};
+constexpr std::array<std::array<std::uint8_t, 16>, 64> bc7Partitions3 = {{
+    {0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 1, 2, 2, 2, 2},
+    {0, 0, 0, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 2, 1},
+    {0, 0, 0, 0, 2, 0, 0, 1, 2, 2, 1, 1, 2, 2, 1, 1},
+    {0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 1, 0, 1, 1, 1},
+    {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2},
+    {0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 2, 2},
+    {0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1},
+    {0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1},
+    {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2},
+    {0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2},
+    {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2},
+    {0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2},
+    {0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2},
+    {0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2},
+    {0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2, 1, 2, 2, 2},
+    {0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0, 2, 2, 2, 0},
+    {0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2},
+    {0, 1, 1, 1, 0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0},
+    {0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2},
+    {0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1},
+    {0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2, 0, 2, 2, 2},
+    {0, 0, 0, 1, 0, 0, 0, 1, 2, 2, 2, 1, 2, 2, 2, 1},
+    {0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2},
+    {0, 0, 0, 0, 1, 1, 0, 0, 2, 2, 1, 0, 2, 2, 1, 0},
+    {0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1, 0, 0, 0, 0},
+    {0, 0, 1, 2, 0, 0, 1, 2, 1, 1, 2, 2, 2, 2, 2, 2},
+    {0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1, 0, 1, 1, 0},
+    {0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1},
+    {0, 0, 2, 2, 1, 1, 0, 2, 1, 1, 0, 2, 0, 0, 2, 2},
+    {0, 1, 1, 0, 0, 1, 1, 0, 2, 0, 0, 2, 2, 2, 2, 2},
+    {0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1},
+    {0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 1, 1, 2, 2, 2, 1},
+    {0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 2, 2, 2},
+    {0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 2, 0, 0, 1, 1},
+    {0, 0, 1, 1, 0, 0, 1, 2, 0, 0, 2, 2, 0, 2, 2, 2},
+    {0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0},
+    {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0},
+    {0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0},
+    {0, 1, 2, 0, 2, 0, 1, 2, 1, 2, 0, 1, 0, 1, 2, 0},
+    {0, 0, 1, 1, 2, 2, 0, 0, 1, 1, 2, 2, 0, 0, 1, 1},
+    {0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0, 1, 1},
+    {0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2},
+    {0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1},
+    {0, 0, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2, 1, 1, 2, 2},
+    {0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 1, 1},
+    {0, 2, 2, 0, 1, 2, 2, 1, 0, 2, 2, 0, 1, 2, 2, 1},
+    {0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 0, 1, 0, 1},
+    {0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1},
+    {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2},
+    {0, 2, 2, 2, 0, 1, 1, 1, 0, 2, 2, 2, 0, 1, 1, 1},
+    {0, 0, 0, 2, 1, 1, 1, 2, 0, 0, 0, 2, 1, 1, 1, 2},
+    {0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2},
+    {0, 2, 2, 2, 0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2},
+    {0, 0, 0, 2, 1, 1, 1, 2, 1, 1, 1, 2, 0, 0, 0, 2},
+    {0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2},
+    {0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2},
+    {0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2, 2, 2, 2, 2},
+    {0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2},
+    {0, 0, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2},
+    {0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1},
+    {0, 2, 2, 2, 1, 2, 2, 2, 0, 2, 2, 2, 1, 2, 2, 2},
+    {0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+    {0, 1, 1, 1, 2, 0, 1, 1, 2, 2, 0, 1, 2, 2, 2, 0},
+}};
+constexpr std::array<std::uint8_t, 64> bc7Anchors2 = {
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 2, 8, 2, 2, 8, 8, 15, 2, 8, 2, 2, 8, 8, 2, 2,
+    15, 15, 6, 8, 2, 8, 15, 15, 2, 8, 2, 2, 2, 15, 15, 6,
+    6, 2, 6, 8, 15, 15, 2, 2, 15, 15, 15, 15, 15, 2, 2, 15,
+};
+constexpr std::array<std::uint8_t, 64> bc7Anchors3a = {
+    3, 3, 15, 15, 8, 3, 15, 15, 8, 8, 6, 6, 6, 5, 3, 3,
+    3, 3, 8, 15, 3, 3, 6, 10, 5, 8, 8, 6, 8, 5, 15, 15,
+    8, 15, 3, 5, 6, 10, 8, 15, 15, 3, 15, 5, 15, 15, 15, 15,
+    3, 15, 5, 5, 5, 8, 5, 10, 5, 10, 8, 13, 15, 12, 3, 3,
+};
+constexpr std::array<std::uint8_t, 64> bc7Anchors3b = {
+    15, 8, 8, 3, 15, 15, 3, 8, 15, 15, 15, 15, 15, 15, 15, 8,
+    15, 8, 15, 3, 15, 8, 15, 8, 3, 15, 6, 10, 15, 15, 10, 8,
+    15, 3, 15, 10, 10, 8, 9, 10, 6, 15, 8, 15, 3, 6, 6, 8,
+    15, 3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3, 15, 15, 8,
+};
+// clang-format on
+
+
+////////////////////////////////////////////////////////////
+std::uint8_t clampColor(int value)
+{
+    return static_cast<std::uint8_t>(std::clamp(value, 0, 255));
+}
+
+
+////////////////////////////////////////////////////////////
+int extendBits(int value, int bits)
+{
+    // Replicate the high bits into the low bits, so that the maximum value maps to 255
+    return (value << (8 - bits)) | (value >> (2 * bits - 8));
+}
+
+
+////////////////////////////////////////////////////////////
+void decodeBc1Colors(const std::uint8_t* data, Block& block, bool allowTransparency)
+{
+    const auto color0 = static_cast<std::uint16_t>(data[0] | (data[1] << 8));
+    const auto color1 = static_cast<std::uint16_t>(data[2] | (data[3] << 8));
+
+    std::array<std::array<int, 4>, 4> palette{};
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        const int color = (i == 0) ? color0 : color1;
+        palette[i]      = {extendBits(color >> 11, 5),
+                           extendBits((color >> 5) & 0x3F, 6),
+                           extendBits(color & 0x1F, 5),
+                           255};
+    }
+
+    // BC1 blocks with color0 <= color1 have 3 colors and a transparent black
+    const bool hasTransparency = allowTransparency && (color0 <= color1);
+    for (std::size_t c = 0; c < 3; ++c)
+    {
+        if (hasTransparency)
+        {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+        else
+        {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+    }
+    palette[2][3] = 255;
+    palette[3][3] = hasTransparency ? 0 : 255;
+
+    const std::uint32_t indices = readUint32(data + 4);
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        const auto& color = palette[(indices >> (2 * i)) & 3];
+        for (std::size_t c = 0; c < 4; ++c)
+            block[i * 4 + c] = static_cast<std::uint8_t>(color[c]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void decodeBc2Alpha(const std::uint8_t* data, Block& block)
+{
+    for (std::size_t i = 0; i < 16; ++i)
+        block[i * 4 + 3] = static_cast<std::uint8_t>(((data[i / 2] >> ((i % 2) * 4)) & 0xF) * 17);
+}
+
+
+////////////////////////////////////////////////////////////
+void decodeBc4Channel(const std::uint8_t* data, Block& block, std::size_t channel)
+{
+    std::array<int, 8> values{data[0], data[1]};
+    if (values[0] > values[1])
+    {
+        for (int i = 1; i < 7; ++i)
+            values[static_cast<std::size_t>(i) + 1] = ((7 - i) * values[0] + i * values[1]) / 7;
+    }
+    else
+    {
+        for (int i = 1; i < 5; ++i)
+            values[static_cast<std::size_t>(i) + 1] = ((5 - i) * values[0] + i * values[1]) / 5;
+        values[6] = 0;
+        values[7] = 255;
+    }
+
+    std::uint64_t indices = 0;
+    for (std::size_t i = 0; i < 6; ++i)
+        indices |= std::uint64_t{data[2 + i]} << (8 * i);
+
+    for (std::size_t i = 0; i < 16; ++i)
+        block[i * 4 + channel] = static_cast<std::uint8_t>(values[(indices >> (3 * i)) & 7]);
+}
+
+
+////////////////////////////////////////////////////////////
+void decodeEtc2Colors(const std::uint8_t* data, Block& block)
+{
+    using Color = std::array<int, 3>;
+
+    // Pixels are numbered column by column, the high and low bits of their index are stored separately
+    const std::uint32_t indexBits  = readUint32(data + 4, true);
+    const auto          pixelIndex = [indexBits](std::size_t x, std::size_t y)
+    {
+        const std::size_t i = x * 4 + y;
+        return (((indexBits >> (i + 16)) & 1) << 1) | ((indexBits >> i) & 1);
+    };
+
+    const auto setPixel = [&block](std::size_t x, std::size_t y, const Color& color, int modifier)
+    {
+        std::uint8_t* pixel = &block[(y * 4 + x) * 4];
+        for (std::size_t c = 0; c < 3; ++c)
+            pixel[c] = clampColor(color[c] + modifier);
+        pixel[3] = 255;
+    };
+
+    // Modes which paint the block with 4 colors
+    const auto paint = [&](const std::array<Color, 4>& colors)
+    {
+        for (std::size_t x = 0; x < 4; ++x)
+            for (std::size_t y = 0; y < 4; ++y)
+                setPixel(x, y, colors[pixelIndex(x, y)], 0);
+    };
+
+    const auto offset = [](const Color& color, int distance)
+    { return Color{color[0] + distance, color[1] + distance, color[2] + distance}; };
+
+    const bool differential = (data[3] & 2) != 0;
+    const bool flipped      = (data[3] & 1) != 0;
+
+    std::array<Color, 2> baseColors{};
+    if (differential)
+    {
+        // The second color is a signed 3-bit offset from the first one; an overflow selects one of the ETC2 modes
+        Color first{};
+        Color second{};
+        for (std::size_t c = 0; c < 3; ++c)
+        {
+            const int delta = data[c] & 7;
+            first[c]        = data[c] >> 3;
+            second[c]       = first[c] + (delta >= 4 ? delta - 8 : delta);
+        }
+
+        if ((second[0] < 0) || (second[0] > 31))
+        {
+            // T mode
+            const Color color1 = {extendBits(((data[0] >> 1) & 0xC) | (data[0] & 3), 4),
+                                  extendBits(data[1] >> 4, 4),
+                                  extendBits(data[1] & 0xF, 4)};
+            const Color color2 = {extendBits(data[2] >> 4, 4),
+                                  extendBits(data[2] & 0xF, 4),
+                                  extendBits(data[3] >> 4, 4)};
+            const int   distance = etcDistances[static_cast<std::size_t>(((data[3] >> 1) & 6) | (data[3] & 1))];
+            paint({color1, offset(color2, distance), color2, offset(color2, -distance)});
+            return;
+        }
+
+        if ((second[1] < 0) || (second[1] > 31))
+        {
+            // H mode
+            const int r1 = (data[0] >> 3) & 0xF;
+            const int g1 = ((data[0] & 7) << 1) | ((data[1] >> 4) & 1);
+            const int b1 = (data[1] & 8) | ((data[1] & 3) << 1) | (data[2] >> 7);
+            const int r2 = (data[2] >> 3) & 0xF;
+            const int g2 = ((data[2] & 7) << 1) | (data[3] >> 7);
+            const int b2 = (data[3] >> 3) & 0xF;
+
+            const Color color1 = {extendBits(r1, 4), extendBits(g1, 4), extendBits(b1, 4)};
+            const Color color2 = {extendBits(r2, 4), extendBits(g2, 4), extendBits(b2, 4)};
+            const bool  isFirstGreater = ((r1 << 8) | (g1 << 4) | b1) >= ((r2 << 8) | (g2 << 4) | b2);
+            const int   distance       = etcDistances[static_cast<std::size_t>(
+                ((data[3] & 4) | ((data[3] & 1) << 1)) | (isFirstGreater ? 1 : 0))];
+            paint({offset(color1, distance),
+                   offset(color1, -distance),
+                   offset(color2, distance),
+                   offset(color2, -distance)});
+            return;
+        }
+
+        if ((second[2] < 0) || (second[2] > 31))
+        {
+            // Planar mode, the colors are interpolated between the origin, horizontal and vertical colors
+            const Color origin     = {extendBits((data[0] >> 1) & 0x3F, 6),
+                                      extendBits(((data[0] & 1) << 6) | (data[1] >> 1), 7),
+                                      extendBits(((data[1] & 1) << 5) | (data[2] & 0x18) | ((data[2] & 3) << 1) |
+                                                     (data[3] >> 7),
+                                                 6)};
+            const Color horizontal = {extendBits(((data[3] >> 1) & 0x3E) | (data[3] & 1), 6),
+                                      extendBits(data[4] >> 1, 7),
+                                      extendBits(((data[4] & 1) << 5) | (data[5] >> 3), 6)};
+            const Color vertical   = {extendBits(((data[5] & 7) << 3) | (data[6] >> 5), 6),
+                                      extendBits(((data[6] & 0x1F) << 2) | (data[7] >> 6), 7),
+                                      extendBits(data[7] & 0x3F, 6)};
+
+            for (int x = 0; x < 4; ++x)
+            {
+                for (int y = 0; y < 4; ++y)
+                {
+                    Color color{};
+                    for (std::size_t c = 0; c < 3; ++c)
+                    {
+                        const int gradient = x * (horizontal[c] - origin[c]) + y * (vertical[c] - origin[c]);
+                        color[c]           = (gradient + 4 * origin[c] + 2) >> 2;
+                    }
+                    setPixel(static_cast<std::size_t>(x), static_cast<std::size_t>(y), color, 0);
+                }
+            }
+            return;
+        }
+
+        for (std::size_t c = 0; c < 3; ++c)
+        {
+            baseColors[0][c] = extendBits(first[c], 5);
+            baseColors[1][c] = extendBits(second[c], 5);
+        }
+    }
+    else
+    {
+        for (std::size_t c = 0; c < 3; ++c)
+        {
+            baseColors[0][c] = extendBits(data[c] >> 4, 4);
+            baseColors[1][c] = extendBits(data[c] & 0xF, 4);
+        }
+    }
+
+    // The block is split in two halves, side by side or on top of each other
+    const std::array<std::size_t, 2> tables = {static_cast<std::size_t>(data[3] >> 5),
+                                               static_cast<std::size_t>((data[3] >> 2) & 7)};
+    for (std::size_t x = 0; x < 4; ++x)
+    {
+        for (std::size_t y = 0; y < 4; ++y)
+        {
+            const std::size_t half = flipped ? (y / 2) : (x / 2);
+            setPixel(x, y, baseColors[half], etcModifiers[tables[half]][pixelIndex(x, y)]);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void decodeEacAlpha(const std::uint8_t* data, Block& block)
+{
+    const int   base       = data[0];
+    const int   multiplier = data[1] >> 4;
+    const auto& modifiers  = eacModifiers[data[1] & 0xF];
+
+    std::uint64_t indices = 0;
+    for (std::size_t i = 2; i < 8; ++i)
+        indices = (indices << 8) | data[i];
+
+    // Pixels are numbered column by column, the first one in the highest bits
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        const auto index                    = static_cast<std::size_t>((indices >> (45 - 3 * i)) & 7);
+        block[((i % 4) * 4 + i / 4) * 4 + 3] = clampColor(base + modifiers[index] * multiplier);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+class BitReader
+{
+public:
+    explicit BitReader(const std::uint8_t* data) : m_data(data)
+    {
+    }
+
+    unsigned int read(unsigned int count)
+    {
+        unsigned int value = 0;
+        for (unsigned int i = 0; i < count; ++i, ++m_position)
+            value |= ((m_data[m_position / 8] >> (m_position % 8)) & 1u) << i;
+        return value;
+    }
+
+private:
+    const std::uint8_t* m_data;
+    unsigned int        m_position{};
+};
+
+
+////////////////////////////////////////////////////////////
+int interpolateBc7(int endpoint0, int endpoint1, unsigned int index, unsigned int bits)
+{
+    const int weight = (bits == 2) ? bc7Weights2[index] : (bits == 3) ? bc7Weights3[index] : bc7Weights4[index];
+    return ((64 - weight) * endpoint0 + weight * endpoint1 + 32) >> 6;
+}
+
+
+////////////////////////////////////////////////////////////
+void decodeBc7(const std::uint8_t* data, Block& block)
+{
+    // The mode is given by the position of the lowest set bit
+    std::size_t modeIndex = 0;
+    while ((modeIndex < bc7Modes.size()) && !(data[0] & (1u << modeIndex)))
+        ++modeIndex;
+
+    // Reserved mode, decoded as transparent black
+    if (modeIndex == bc7Modes.size())
+    {
+        block.fill(0);
+        return;
+    }
+
+    const Bc7Mode& mode = bc7Modes[modeIndex];
+    BitReader      reader(data);
+    reader.read(static_cast<unsigned int>(modeIndex) + 1);
+
+    const unsigned int partition      = reader.read(mode.partitionBits);
+    const unsigned int rotation       = reader.read(mode.rotationBits);
+    const unsigned int indexSelection = reader.read(mode.indexSelectionBits);
+
+    // Two endpoints per subset, stored channel by channel
+    const std::size_t                 endpointCount = mode.subsets * 2;
+    std::array<std::array<int, 4>, 6> endpoints{};
+    for (std::size_t c = 0; c < 4; ++c)
+    {
+        const unsigned int bits = (c < 3) ? mode.colorBits : mode.alphaBits;
+        for (std::size_t e = 0; e < endpointCount; ++e)
+            endpoints[e][c] = static_cast<int>(reader.read(bits));
+    }
+
+    std::array<int, 6> pBits{};
+    for (std::size_t e = 0; e < endpointCount; e += 2)
+    {
+        if (mode.endpointPBits)
+        {
+            pBits[e]     = static_cast<int>(reader.read(1));
+            pBits[e + 1] = static_cast<int>(reader.read(1));
+        }
+        else if (mode.sharedPBits)
+        {
+            pBits[e] = pBits[e + 1] = static_cast<int>(reader.read(1));
+        }
+    }
+
+    // Expand the endpoints to 8 bits, the p-bit being the lowest bit of the stored value
+    const bool hasPBits = mode.endpointPBits || mode.sharedPBits;
+    for (std::size_t e = 0; e < endpointCount; ++e)
+    {
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            int bits = static_cast<int>((c < 3) ? mode.colorBits : mode.alphaBits);
+            if (bits == 0)
+            {
+                endpoints[e][c] = 255;
+                continue;
+            }
+
+            if (hasPBits)
+            {
+                endpoints[e][c] = (endpoints[e][c] << 1) | pBits[e];
+                ++bits;
+            }
+
+            endpoints[e][c] = extendBits(endpoints[e][c], bits);
+        }
+    }
+
+    // Subset of each pixel; the first pixel of each subset (anchor) has its index stored with one bit less
+    std::array<std::size_t, 16> subsets{};
+    std::array<bool, 16>        anchors{};
+    anchors[0] = true;
+    if (mode.subsets == 2)
+    {
+        for (std::size_t i = 0; i < 16; ++i)
+            subsets[i] = (bc7Partitions2[partition] >> i) & 1u;
+        anchors[bc7Anchors2[partition]] = true;
+    }
+    else if (mode.subsets == 3)
+    {
+        for (std::size_t i = 0; i < 16; ++i)
+            subsets[i] = bc7Partitions3[partition][i];
+        anchors[bc7Anchors3a[partition]] = true;
+        anchors[bc7Anchors3b[partition]] = true;
+    }
+
+    std::array<unsigned int, 16> indices{};
+    std::array<unsigned int, 16> secondaryIndices{};
+    for (std::size_t i = 0; i < 16; ++i)
+        indices[i] = reader.read(mode.indexBits - (anchors[i] ? 1 : 0));
+    if (mode.secondaryIndexBits)
+    {
+        for (std::size_t i = 0; i < 16; ++i)
+            secondaryIndices[i] = reader.read(mode.secondaryIndexBits - (i == 0 ? 1 : 0));
+    }
+
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        const auto& endpoint0 = endpoints[subsets[i] * 2];
+        const auto& endpoint1 = endpoints[subsets[i] * 2 + 1];
+
+        // Modes with two sets of indices use one for the color and the other one for the alpha
+        unsigned int colorIndex = indices[i];
+        unsigned int colorBits  = mode.indexBits;
+        unsigned int alphaIndex = indices[i];
+        unsigned int alphaBits  = mode.indexBits;
+        if (mode.secondaryIndexBits)
+        {
+            alphaIndex = secondaryIndices[i];
+            alphaBits  = mode.secondaryIndexBits;
+            if (indexSelection)
+            {
+                std::swap(colorIndex, alphaIndex);
+                std::swap(colorBits, alphaBits);
+            }
+        }
+
+        std::array<int, 4> color{};
+        for (std::size_t c = 0; c < 3; ++c)
+            color[c] = interpolateBc7(endpoint0[c], endpoint1[c], colorIndex, colorBits);
+        color[3] = interpolateBc7(endpoint0[3], endpoint1[3], alphaIndex, alphaBits);
+
+        // Rotation swaps the alpha channel with one of the color channels
+        if (rotation)
+            std::swap(color[3], color[rotation - 1]);
+
+        for (std::size_t c = 0; c < 4; ++c)
+            block[i * 4 + c] = static_cast<std::uint8_t>(color[c]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void decodeBlock(CompressedFormat format, const std::uint8_t* data, Block& block)
+{
+    switch (format)
+    {
+        case CompressedFormat::Bc1:
+            decodeBc1Colors(data, block, true);
+            break;
+        case CompressedFormat::Bc2:
+            decodeBc1Colors(data + 8, block, false);
+            decodeBc2Alpha(data, block);
+            break;
+        case CompressedFormat::Bc3:
+            decodeBc1Colors(data + 8, block, false);
+            decodeBc4Channel(data, block, 3);
+            break;
+        case CompressedFormat::Bc4:
+        case CompressedFormat::Bc5:
+            for (std::size_t i = 0; i < 16; ++i)
+            {
+                block[i * 4 + 1] = 0;
+                block[i * 4 + 2] = 0;
+                block[i * 4 + 3] = 255;
+            }
+            decodeBc4Channel(data, block, 0);
+            if (format == CompressedFormat::Bc5)
+                decodeBc4Channel(data + 8, block, 1);
+            break;
+        case CompressedFormat::Bc7:
+            decodeBc7(data, block);
+            break;
+        case CompressedFormat::Etc2Rgb:
+            decodeEtc2Colors(data, block);
+            break;
+        case CompressedFormat::Etc2Rgba:
+            decodeEtc2Colors(data + 8, block);
+            decodeEacAlpha(data, block);
+            break;
+    }
+}
+} // namespace TextureCompressionImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool isCompressedImage(const void* data, std::size_t size)
+{
+    using namespace TextureCompressionImpl;
+
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    return hasSignature(bytes, size, ddsSignature) || hasSignature(bytes, size, ktxSignature) ||
+           hasSignature(bytes, size, ktx2Signature);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<CompressedImage> loadCompressedImage(const void* data, std::size_t size)
+{
+    using namespace TextureCompressionImpl;
+
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    if (hasSignature(bytes, size, ddsSignature))
+        return loadDds(bytes, size);
+    if (hasSignature(bytes, size, ktxSignature))
+        return loadKtx(bytes, size);
+    if (hasSignature(bytes, size, ktx2Signature))
+        return loadKtx2(bytes, size);
+
+    err() << "Failed to load compressed image, unknown container" << std::endl;
+    return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t getCompressedSize(CompressedFormat format, Vector2u size)
+{
+    return std::size_t{(size.x + 3) / 4} * std::size_t{(size.y + 3) / 4} * TextureCompressionImpl::getBlockSize(format);
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> decompress(CompressedFormat format, Vector2u size, const std::uint8_t* blocks)
+{
+    using namespace TextureCompressionImpl;
+
+    std::vector<std::uint8_t> pixels(std::size_t{size.x} * size.y * 4);
+    const std::size_t         blockSize = getBlockSize(format);
+    Block                     block{};
+
+    for (unsigned int blockY = 0; blockY < size.y; blockY += 4)
+    {
+        for (unsigned int blockX = 0; blockX < size.x; blockX += 4)
+        {
+            decodeBlock(format, blocks, block);
+            blocks += blockSize;
+
+            // Blocks on the right and bottom edges may be partially outside the image
+            const std::size_t width  = std::min(size.x - blockX, 4u);
+            const std::size_t height = std::min(size.y - blockY, 4u);
+            for (std::size_t y = 0; y < height; ++y)
+                std::memcpy(&pixels[((blockY + y) * size.x + blockX) * 4], &block[y * 16], width * 4);
+        }
+    }
+
+    return pixels;
+}
+
+} // namespace sf::priv
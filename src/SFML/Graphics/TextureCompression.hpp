@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Block compressed pixel formats
+///
+/// ETC1 data is loaded as ETC2 RGB, which is a superset of it.
+///
+////////////////////////////////////////////////////////////
+enum class CompressedFormat
+{
+    Bc1,     //!< DXT1, RGB with optional 1-bit alpha, 8 bytes per block
+    Bc2,     //!< DXT3, RGB with explicit 4-bit alpha, 16 bytes per block
+    Bc3,     //!< DXT5, RGB with interpolated alpha, 16 bytes per block
+    Bc4,     //!< RGTC1, single red channel, 8 bytes per block
+    Bc5,     //!< RGTC2, red and green channels, 16 bytes per block
+    Bc7,     //!< BPTC, high quality RGBA, 16 bytes per block
+    Etc2Rgb, //!< ETC2 RGB, 8 bytes per block
+    Etc2Rgba //!< ETC2 RGB with EAC alpha, 16 bytes per block
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Compressed image read from a DDS, KTX or KTX2 container
+///
+////////////////////////////////////////////////////////////
+struct CompressedImage
+{
+    CompressedFormat                       format{}; //!< Format of the blocks
+    bool                                   sRgb{};   //!< Does the container declare sRGB encoded colors?
+    Vector2u                               size;     //!< Size of the base level, in pixels
+    std::vector<std::vector<std::uint8_t>> levels;   //!< Blocks of each mipmap level, base level first
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether data starts with the signature of a supported container
+///
+/// \param data Pointer to the file data in memory
+/// \param size Size of the data, in bytes
+///
+/// \return `true` if the data is a DDS, KTX or KTX2 file
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isCompressedImage(const void* data, std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Read a compressed image from a DDS, KTX or KTX2 file in memory
+///
+/// Only 2D textures with one of the supported block formats
+/// are accepted. Errors are reported to `sf::err()`.
+///
+/// \param data Pointer to the file data in memory
+/// \param size Size of the data, in bytes
+///
+/// \return Compressed image, or `std::nullopt` if the file is invalid or unsupported
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::optional<CompressedImage> loadCompressedImage(const void* data, std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of bytes of a compressed image level
+///
+/// \param format Format of the blocks
+/// \param size   Size of the level, in pixels
+///
+/// \return Size of the blocks of the level, in bytes
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t getCompressedSize(CompressedFormat format, Vector2u size);
+
+////////////////////////////////////////////////////////////
+/// \brief Decode a compressed image level to 32-bit RGBA pixels
+///
+/// Used when the graphics driver doesn't support the format.
+/// Single and dual channel formats are decoded like the
+/// driver samples them: missing color channels are 0 and
+/// alpha is opaque.
+///
+/// \param format Format of the blocks
+/// \param size   Size of the level, in pixels
+/// \param blocks Blocks of the level, `getCompressedSize(format, size)` bytes
+///
+/// \return Decoded pixels
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::vector<std::uint8_t> decompress(CompressedFormat format, Vector2u size, const std::uint8_t* blocks);
+
+} // namespace sf::priv
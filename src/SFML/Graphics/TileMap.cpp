@@ -0,0 +1,274 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TileMap.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <ostream>
+
+#include <cassert>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TileMap::TileMap(const Texture& tileset,
+                 Vector2u       tileSize,
+                 Vector2u       mapSize,
+                 std::size_t    layerCount,
+                 Vector2u       chunkSize) :
+m_tileset(&tileset),
+m_tileSize(tileSize),
+m_mapSize(mapSize),
+m_chunkSize(chunkSize),
+m_chunkCount((mapSize.x + chunkSize.x - 1) / chunkSize.x, (mapSize.y + chunkSize.y - 1) / chunkSize.y),
+m_layerCount(layerCount),
+m_tiles(layerCount * mapSize.x * mapSize.y, EmptyTile),
+m_chunks(layerCount * m_chunkCount.x * m_chunkCount.y)
+{
+    assert(tileSize.x > 0 && tileSize.y > 0 && "Tile size must be positive");
+    assert(chunkSize.x > 0 && chunkSize.y > 0 && "Chunk size must be positive");
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTile(std::size_t layer, Vector2u position, unsigned int tile)
+{
+    assert(layer < m_layerCount && "Layer is out of bounds");
+    assert(position.x < m_mapSize.x && position.y < m_mapSize.y && "Position is out of bounds");
+
+    unsigned int& current = m_tiles[(layer * m_mapSize.y + position.y) * m_mapSize.x + position.x];
+    if (current == tile)
+        return;
+
+    current = tile;
+
+    const std::size_t chunk = (position.y / m_chunkSize.y) * m_chunkCount.x + position.x / m_chunkSize.x;
+    m_chunks[layer * m_chunkCount.x * m_chunkCount.y + chunk].dirty = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTiles(std::size_t layer, const unsigned int* tiles)
+{
+    assert(layer < m_layerCount && "Layer is out of bounds");
+    assert(tiles && "Tiles must not be null");
+
+    const std::size_t layerSize = std::size_t{m_mapSize.x} * m_mapSize.y;
+    std::copy(tiles, tiles + layerSize, m_tiles.begin() + static_cast<std::ptrdiff_t>(layer * layerSize));
+
+    const std::size_t chunksPerLayer = std::size_t{m_chunkCount.x} * m_chunkCount.y;
+    for (std::size_t i = 0; i < chunksPerLayer; ++i)
+        m_chunks[layer * chunksPerLayer + i].dirty = true;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TileMap::getTile(std::size_t layer, Vector2u position) const
+{
+    assert(layer < m_layerCount && "Layer is out of bounds");
+    assert(position.x < m_mapSize.x && position.y < m_mapSize.y && "Position is out of bounds");
+
+    return m_tiles[(layer * m_mapSize.y + position.y) * m_mapSize.x + position.x];
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTileset(const Texture& tileset)
+{
+    // The texture coordinates depend on the size of the tileset
+    if ((m_tileset != &tileset) || (m_tileset->getSize() != tileset.getSize()))
+    {
+        for (Chunk& chunk : m_chunks)
+            chunk.dirty = true;
+    }
+
+    m_tileset = &tileset;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TileMap::getTileset() const
+{
+    return *m_tileset;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getTileSize() const
+{
+    return m_tileSize;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getMapSize() const
+{
+    return m_mapSize;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getChunkSize() const
+{
+    return m_chunkSize;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TileMap::getLayerCount() const
+{
+    return m_layerCount;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getLocalBounds() const
+{
+    return {{0.f, 0.f}, Vector2f(m_mapSize.componentWiseMul(m_tileSize))};
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::draw(RenderTarget& target, RenderStates states) const
+{
+    states.transform *= getTransform();
+    states.texture = m_tileset;
+
+    const std::size_t chunksPerLayer = std::size_t{m_chunkCount.x} * m_chunkCount.y;
+
+    // Find the visible chunks once, they are the same for all the layers
+    std::vector<bool> visible(chunksPerLayer);
+    for (std::size_t i = 0; i < chunksPerLayer; ++i)
+        visible[i] = !target.cull(getChunkBounds(i), states, m_layerCount);
+
+    // Layers are drawn one after another so that they overlap across chunk boundaries
+    for (std::size_t layer = 0; layer < m_layerCount; ++layer)
+    {
+        for (std::size_t i = 0; i < chunksPerLayer; ++i)
+        {
+            if (!visible[i])
+                continue;
+
+            const Chunk& chunk = m_chunks[layer * chunksPerLayer + i];
+            if (chunk.dirty)
+                updateChunk(layer, i);
+
+            if (chunk.vertexCount == 0)
+                continue;
+
+            if (chunk.vertices.empty())
+                target.draw(*chunk.buffer, 0, chunk.vertexCount, states);
+            else
+                target.draw(chunk.vertices.data(), chunk.vertices.size(), PrimitiveType::Triangles, states);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getChunkBounds(std::size_t index) const
+{
+    const Vector2u start(static_cast<unsigned int>(index % m_chunkCount.x) * m_chunkSize.x,
+                         static_cast<unsigned int>(index / m_chunkCount.x) * m_chunkSize.y);
+    const Vector2u end(std::min(start.x + m_chunkSize.x, m_mapSize.x), std::min(start.y + m_chunkSize.y, m_mapSize.y));
+
+    return {Vector2f(start.componentWiseMul(m_tileSize)), Vector2f((end - start).componentWiseMul(m_tileSize))};
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::updateChunk(std::size_t layer, std::size_t index) const
+{
+    const Vector2u start(static_cast<unsigned int>(index % m_chunkCount.x) * m_chunkSize.x,
+                         static_cast<unsigned int>(index / m_chunkCount.x) * m_chunkSize.y);
+    const Vector2u end(std::min(start.x + m_chunkSize.x, m_mapSize.x), std::min(start.y + m_chunkSize.y, m_mapSize.y));
+    const unsigned int columns = std::max(m_tileset->getSize().x / m_tileSize.x, 1u);
+    const Vector2f     tileSize(m_tileSize);
+
+    // Build two triangles per non-empty tile
+    m_vertices.clear();
+    for (unsigned int y = start.y; y < end.y; ++y)
+    {
+        for (unsigned int x = start.x; x < end.x; ++x)
+        {
+            const unsigned int tile = m_tiles[(layer * m_mapSize.y + y) * m_mapSize.x + x];
+            if (tile == EmptyTile)
+                continue;
+
+            const Vector2f position  = Vector2f(Vector2u(x, y)).componentWiseMul(tileSize);
+            const Vector2f texCoords = Vector2f(Vector2u(tile % columns, tile / columns)).componentWiseMul(tileSize);
+            const Vector2f right(tileSize.x, 0.f);
+            const Vector2f down(0.f, tileSize.y);
+
+            const Vertex topLeft{position, Color::White, texCoords};
+            const Vertex topRight{position + right, Color::White, texCoords + right};
+            const Vertex bottomLeft{position + down, Color::White, texCoords + down};
+            const Vertex bottomRight{position + tileSize, Color::White, texCoords + tileSize};
+
+            m_vertices.insert(m_vertices.end(), {topLeft, topRight, bottomLeft, bottomLeft, topRight, bottomRight});
+        }
+    }
+
+    Chunk& chunk = m_chunks[layer * m_chunkCount.x * m_chunkCount.y + index];
+
+    chunk.vertexCount = m_vertices.size();
+    chunk.dirty       = false;
+    chunk.vertices.clear();
+
+    if (m_vertices.empty())
+        return;
+
+    // Upload the vertices to the static buffer of the chunk, growing it if needed
+    if (VertexBuffer::isAvailable())
+    {
+        if (!chunk.buffer)
+            chunk.buffer.emplace(PrimitiveType::Triangles, VertexBuffer::Usage::Static);
+
+        if (((chunk.buffer->getVertexCount() >= m_vertices.size()) || chunk.buffer->create(m_vertices.size())) &&
+            chunk.buffer->update(m_vertices.data(), m_vertices.size(), 0))
+            return;
+
+        err() << "Failed to upload the vertices of a tile map chunk, drawing it from client memory" << std::endl;
+    }
+
+    chunk.vertices = m_vertices;
+}
+
+} // namespace sf
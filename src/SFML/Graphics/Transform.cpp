@@ -26,11 +26,258 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 
 #include <SFML/System/Angle.hpp>
 
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <type_traits>
+
 #include <cmath>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SFML_TRANSFORM_SSE2
+#include <emmintrin.h>
+#elif (defined(__aarch64__) && defined(__ARM_NEON) && !defined(__ARM_BIG_ENDIAN)) || defined(_M_ARM64)
+#define SFML_TRANSFORM_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TransformImpl
+{
+////////////////////////////////////////////////////////////
+// Vector operations on the coordinates of 2 interleaved points
+// or on one coordinate of 4 points
+////////////////////////////////////////////////////////////
+#if defined(SFML_TRANSFORM_SSE2)
+
+#define SFML_TRANSFORM_SIMD
+
+using VecF = __m128;
+
+// clang-format off
+VecF splat(float value)           { return _mm_set1_ps(value); }
+VecF add(VecF a, VecF b)          { return _mm_add_ps(a, b); }
+VecF mul(VecF a, VecF b)          { return _mm_mul_ps(a, b); }
+VecF min(VecF a, VecF b)          { return _mm_min_ps(a, b); }
+VecF max(VecF a, VecF b)          { return _mm_max_ps(a, b); }
+void store(float* values, VecF v) { _mm_storeu_ps(values, v); }
+// clang-format on
+
+VecF load(const sf::Vector2f& first, const sf::Vector2f& second)
+{
+    const VecF low = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&first));
+    return _mm_loadh_pi(low, reinterpret_cast<const __m64*>(&second));
+}
+
+void store(sf::Vector2f& first, sf::Vector2f& second, VecF v)
+{
+    _mm_storel_pi(reinterpret_cast<__m64*>(&first), v);
+    _mm_storeh_pi(reinterpret_cast<__m64*>(&second), v);
+}
+
+// Split 4 interleaved points into their x and y coordinates
+void deinterleave(VecF first, VecF second, VecF& x, VecF& y)
+{
+    x = _mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0));
+    y = _mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+// Merge the x and y coordinates of 4 points into interleaved points
+void interleave(VecF x, VecF y, VecF& first, VecF& second)
+{
+    first  = _mm_unpacklo_ps(x, y);
+    second = _mm_unpackhi_ps(x, y);
+}
+
+#elif defined(SFML_TRANSFORM_NEON)
+
+#define SFML_TRANSFORM_SIMD
+
+using VecF = float32x4_t;
+
+// clang-format off
+VecF splat(float value)           { return vdupq_n_f32(value); }
+VecF add(VecF a, VecF b)          { return vaddq_f32(a, b); }
+VecF mul(VecF a, VecF b)          { return vmulq_f32(a, b); }
+VecF min(VecF a, VecF b)          { return vminq_f32(a, b); }
+VecF max(VecF a, VecF b)          { return vmaxq_f32(a, b); }
+void store(float* values, VecF v) { vst1q_f32(values, v); }
+// clang-format on
+
+VecF load(const sf::Vector2f& first, const sf::Vector2f& second)
+{
+    return vcombine_f32(vld1_f32(&first.x), vld1_f32(&second.x));
+}
+
+void store(sf::Vector2f& first, sf::Vector2f& second, VecF v)
+{
+    vst1_f32(&first.x, vget_low_f32(v));
+    vst1_f32(&second.x, vget_high_f32(v));
+}
+
+// Split 4 interleaved points into their x and y coordinates
+void deinterleave(VecF first, VecF second, VecF& x, VecF& y)
+{
+    const float32x4x2_t result = vuzpq_f32(first, second);
+    x                          = result.val[0];
+    y                          = result.val[1];
+}
+
+// Merge the x and y coordinates of 4 points into interleaved points
+void interleave(VecF x, VecF y, VecF& first, VecF& second)
+{
+    const float32x4x2_t result = vzipq_f32(x, y);
+    first                      = result.val[0];
+    second                     = result.val[1];
+}
+
+#endif
+
+////////////////////////////////////////////////////////////
+// clang-format off
+const sf::Vector2f& getPosition(const sf::Vector2f& point) { return point; }
+sf::Vector2f&       getPosition(sf::Vector2f& point)       { return point; }
+const sf::Vector2f& getPosition(const sf::Vertex& vertex)  { return vertex.position; }
+sf::Vector2f&       getPosition(sf::Vertex& vertex)        { return vertex.position; }
+// clang-format on
+
+
+////////////////////////////////////////////////////////////
+// Transform the positions of an array of points or vertices, optionally writing them and computing their bounds
+//
+// Only the affine part of the matrix is used, like Transform::transformPoint does:
+// x' = a * x + c * y + tx and y' = b * x + d * y + ty
+template <bool Write, bool Bound, typename Element>
+sf::FloatRect transformElements(const float* matrix, const Element* input, std::size_t count, Element* output)
+{
+    const float a  = matrix[0];
+    const float b  = matrix[1];
+    const float c  = matrix[4];
+    const float d  = matrix[5];
+    const float tx = matrix[12];
+    const float ty = matrix[13];
+
+    sf::Vector2f minimum(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    sf::Vector2f maximum(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+
+    std::size_t i = 0;
+
+#ifdef SFML_TRANSFORM_SIMD
+
+    // Number of points processed at once
+    constexpr std::size_t lanes = 4;
+
+    const VecF va  = splat(a);
+    const VecF vb  = splat(b);
+    const VecF vc  = splat(c);
+    const VecF vd  = splat(d);
+    const VecF vtx = splat(tx);
+    const VecF vty = splat(ty);
+
+    VecF minX = splat(minimum.x);
+    VecF minY = splat(minimum.y);
+    VecF maxX = splat(maximum.x);
+    VecF maxY = splat(maximum.y);
+
+    for (; i + lanes <= count; i += lanes)
+    {
+        const Element* source = input + i;
+
+        VecF x;
+        VecF y;
+        deinterleave(load(getPosition(source[0]), getPosition(source[1])),
+                     load(getPosition(source[2]), getPosition(source[3])),
+                     x,
+                     y);
+
+        const VecF resultX = add(add(mul(va, x), mul(vc, y)), vtx);
+        const VecF resultY = add(add(mul(vb, x), mul(vd, y)), vty);
+
+        if constexpr (Bound)
+        {
+            minX = min(minX, resultX);
+            minY = min(minY, resultY);
+            maxX = max(maxX, resultX);
+            maxY = max(maxY, resultY);
+        }
+
+        if constexpr (Write)
+        {
+            Element* destination = output + i;
+
+            if constexpr (!std::is_same_v<Element, sf::Vector2f>)
+            {
+                if (destination != source)
+                {
+                    for (std::size_t j = 0; j < lanes; ++j)
+                    {
+                        destination[j].color     = source[j].color;
+                        destination[j].texCoords = source[j].texCoords;
+                    }
+                }
+            }
+
+            VecF first;
+            VecF second;
+            interleave(resultX, resultY, first, second);
+            store(getPosition(destination[0]), getPosition(destination[1]), first);
+            store(getPosition(destination[2]), getPosition(destination[3]), second);
+        }
+    }
+
+    if constexpr (Bound)
+    {
+        std::array<float, lanes> values{};
+
+        store(values.data(), minX);
+        minimum.x = *std::min_element(values.begin(), values.end());
+        store(values.data(), minY);
+        minimum.y = *std::min_element(values.begin(), values.end());
+        store(values.data(), maxX);
+        maximum.x = *std::max_element(values.begin(), values.end());
+        store(values.data(), maxY);
+        maximum.y = *std::max_element(values.begin(), values.end());
+    }
+
+#endif
+
+    for (; i < count; ++i)
+    {
+        const sf::Vector2f point  = getPosition(input[i]);
+        const sf::Vector2f result = {a * point.x + c * point.y + tx, b * point.x + d * point.y + ty};
+
+        if constexpr (Bound)
+        {
+            minimum.x = std::min(minimum.x, result.x);
+            minimum.y = std::min(minimum.y, result.y);
+            maximum.x = std::max(maximum.x, result.x);
+            maximum.y = std::max(maximum.y, result.y);
+        }
+
+        if constexpr (Write)
+        {
+            if constexpr (!std::is_same_v<Element, sf::Vector2f>)
+                output[i] = input[i];
+
+            getPosition(output[i]) = result;
+        }
+    }
+
+    if (!Bound || (count == 0))
+        return {};
+
+    return {minimum, maximum - minimum};
+}
+} // namespace TransformImpl
+} // namespace
+
 
 namespace sf
 {
@@ -67,4 +314,38 @@ Transform& Transform::rotate(Angle angle, Vector2f center)
     return combine(rotation);
 }
 
+
+////////////////////////////////////////////////////////////
+void Transform::transformPoints(const Vector2f* points, std::size_t count, Vector2f* result) const
+{
+    TransformImpl::transformElements<true, false>(m_matrix.data(), points, count, result);
+}
+
+
+////////////////////////////////////////////////////////////
+void Transform::transformVertices(const Vertex* vertices, std::size_t count, Vertex* result) const
+{
+    TransformImpl::transformElements<true, false>(m_matrix.data(), vertices, count, result);
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect Transform::getTransformedBounds(const Vector2f* points, std::size_t count, Vector2f* result) const
+{
+    if (result)
+        return TransformImpl::transformElements<true, true>(m_matrix.data(), points, count, result);
+
+    return TransformImpl::transformElements<false, true>(m_matrix.data(), points, count, result);
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect Transform::getTransformedBounds(const Vertex* vertices, std::size_t count, Vertex* result) const
+{
+    if (result)
+        return TransformImpl::transformElements<true, true>(m_matrix.data(), vertices, count, result);
+
+    return TransformImpl::transformElements<false, true>(m_matrix.data(), vertices, count, result);
+}
+
 } // namespace sf
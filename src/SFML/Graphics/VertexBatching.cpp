@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/VertexBatching.hpp>
+
+#include <cassert>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+PrimitiveType getListPrimitiveType(PrimitiveType type)
+{
+    switch (type)
+    {
+        case PrimitiveType::Points:
+            return PrimitiveType::Points;
+        case PrimitiveType::Lines:
+        case PrimitiveType::LineStrip:
+            return PrimitiveType::Lines;
+        case PrimitiveType::Triangles:
+        case PrimitiveType::TriangleStrip:
+        case PrimitiveType::TriangleFan:
+            return PrimitiveType::Triangles;
+    }
+
+    assert(false);
+    return PrimitiveType::Triangles;
+}
+
+
+////////////////////////////////////////////////////////////
+void appendListVertices(std::vector<Vertex>& list,
+                        const Vertex*        vertices,
+                        std::size_t          vertexCount,
+                        PrimitiveType        type,
+                        const Transform&     transform)
+{
+    const std::size_t first  = list.size();
+    const auto        append = [&](std::size_t index) { list.push_back(vertices[index]); };
+
+    switch (type)
+    {
+        case PrimitiveType::Points:
+            list.insert(list.end(), vertices, vertices + vertexCount);
+            break;
+        case PrimitiveType::Lines:
+            // Incomplete trailing primitives are ignored by OpenGL, drop them so they don't shift the next ones
+            list.insert(list.end(), vertices, vertices + (vertexCount - vertexCount % 2));
+            break;
+        case PrimitiveType::Triangles:
+            list.insert(list.end(), vertices, vertices + (vertexCount - vertexCount % 3));
+            break;
+        case PrimitiveType::LineStrip:
+            for (std::size_t i = 1; i < vertexCount; ++i)
+            {
+                append(i - 1);
+                append(i);
+            }
+            break;
+        case PrimitiveType::TriangleStrip:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                append(i - 2);
+                append(i - 1);
+                append(i);
+            }
+            break;
+        case PrimitiveType::TriangleFan:
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                append(0);
+                append(i - 1);
+                append(i);
+            }
+            break;
+    }
+
+    // The appended vertices are transformed in place, several at once
+    transform.transformVertices(list.data() + first, list.size() - first, list.data() + first);
+}
+
+} // namespace sf::priv
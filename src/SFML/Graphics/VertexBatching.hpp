@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Transform;
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+// Helpers used to merge several draws into one
+//
+// Primitives of different draws can only share a draw call
+// when they are stored as lists: strips and fans are
+// converted, and the vertices are transformed beforehand.
+////////////////////////////////////////////////////////////
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Get the list type that primitives of a given type are stored as
+///
+/// \param type Type of primitives
+///
+/// \return `Points`, `Lines` or `Triangles`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] PrimitiveType getListPrimitiveType(PrimitiveType type);
+
+////////////////////////////////////////////////////////////
+/// \brief Transform primitives and append them as a list
+///
+/// Strips and fans are converted to lists, incomplete
+/// trailing primitives are dropped.
+///
+/// \param list        Vertices to append to
+/// \param vertices    Pointer to the vertices of the primitives
+/// \param vertexCount Number of vertices in the array
+/// \param type        Type of primitives
+/// \param transform   Transform to apply to the appended vertices
+///
+////////////////////////////////////////////////////////////
+void appendListVertices(std::vector<Vertex>& list,
+                        const Vertex*        vertices,
+                        std::size_t          vertexCount,
+                        PrimitiveType        type,
+                        const Transform&     transform);
+
+} // namespace sf::priv
@@ -33,8 +33,12 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
+#include <array>
+#include <limits>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 #include <cstddef>
 #include <cstring>
@@ -45,6 +49,9 @@ namespace
 // A nested named namespace is used here to allow unity builds of SFML.
 namespace VertexBufferImpl
 {
+// Number of segments of a ring-buffered Stream buffer: one being written, up to two still in flight
+constexpr std::size_t streamSegmentCount = 3;
+
 GLenum usageToGlEnum(sf::VertexBuffer::Usage usage)
 {
     switch (usage)
@@ -57,12 +64,93 @@ GLenum usageToGlEnum(sf::VertexBuffer::Usage usage)
             return GLEXT_GL_STREAM_DRAW;
     }
 }
+
+// Tell whether the ranges cover every vertex of a buffer of the given size
+bool coversBuffer(const sf::VertexBuffer::UpdateRange* ranges, std::size_t rangeCount, std::size_t size)
+{
+    if (rangeCount == 1)
+        return (ranges[0].offset == 0) && (ranges[0].vertexCount >= size);
+
+    std::vector<std::pair<std::size_t, std::size_t>> spans;
+    spans.reserve(rangeCount);
+    for (std::size_t i = 0; i < rangeCount; ++i)
+        spans.emplace_back(ranges[i].offset, ranges[i].offset + ranges[i].vertexCount);
+
+    std::sort(spans.begin(), spans.end());
+
+    std::size_t end = 0;
+    for (const auto& [first, last] : spans)
+    {
+        if (first > end)
+            return false;
+
+        end = std::max(end, last);
+    }
+
+    return end >= size;
+}
 } // namespace VertexBufferImpl
 } // namespace
 
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+struct VertexBuffer::StreamRing
+{
+    StreamRing() = default;
+
+    ~StreamRing()
+    {
+        const TransientContextLock lock;
+
+        for (const GLsync fence : fences)
+        {
+            if (fence)
+                glCheck(GLEXT_glDeleteSync(fence));
+        }
+    }
+
+    // clang-format off
+    StreamRing(const StreamRing&)            = delete;
+    StreamRing& operator=(const StreamRing&) = delete;
+    // clang-format on
+
+    // Move to the next segment once the GPU is done reading it, return the previous one
+    std::size_t advance()
+    {
+        const std::size_t previous = segment;
+        segment                    = (segment + 1) % fences.size();
+
+        // The draws issued so far are the last ones reading the previous segment
+        // The fence only orders them if they were issued in the current context, see Usage::Stream
+        if (fences[previous])
+            glCheck(GLEXT_glDeleteSync(fences[previous]));
+
+        glCheck(fences[previous] = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+        // This only blocks if the GPU is a whole ring behind
+        if (fences[segment])
+        {
+            glCheck(GLEXT_glClientWaitSync(fences[segment],
+                                           GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT,
+                                           std::numeric_limits<GLuint64>::max()));
+            glCheck(GLEXT_glDeleteSync(fences[segment]));
+            fences[segment] = nullptr;
+        }
+
+        return previous;
+    }
+
+    std::array<GLsync, VertexBufferImpl::streamSegmentCount> fences{};  //!< Signaled once each segment is drawn
+    std::size_t                                              segment{}; //!< Segment holding the latest data
+};
+
+
+////////////////////////////////////////////////////////////
+VertexBuffer::VertexBuffer() = default;
+
+
 ////////////////////////////////////////////////////////////
 VertexBuffer::VertexBuffer(PrimitiveType type) : m_primitiveType(type)
 {
@@ -131,14 +219,9 @@ bool VertexBuffer::create(std::size_t vertexCount)
     }
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
-    glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                               static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
-                               nullptr,
-                               VertexBufferImpl::usageToGlEnum(m_usage)));
+    allocate(vertexCount);
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
-    m_size = vertexCount;
-
     return true;
 }
 
@@ -174,22 +257,42 @@ bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsig
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
 
-    // Check if we need to resize or orphan the buffer
-    if (vertexCount >= m_size)
-    {
-        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
-                                   nullptr,
-                                   VertexBufferImpl::usageToGlEnum(m_usage)));
+    // Check if we need to resize or orphan the buffer, ring-buffered buffers don't need orphaning
+    if ((vertexCount > m_size) || ((vertexCount == m_size) && !m_streamRing))
+        allocate(vertexCount);
+
+    const UpdateRange range{vertices, vertexCount, offset};
+    write(&range, 1);
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
-        m_size = vertexCount;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::update(const UpdateRange* ranges, std::size_t rangeCount)
+{
+    // Sanity checks
+    if (!m_buffer)
+        return false;
+
+    if (!ranges && rangeCount)
+        return false;
+
+    for (std::size_t i = 0; i < rangeCount; ++i)
+    {
+        if (!ranges[i].vertices || (ranges[i].offset + ranges[i].vertexCount > m_size))
+            return false;
     }
 
-    glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
-                                  static_cast<GLintptrARB>(sizeof(Vertex) * offset),
-                                  static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
-                                  vertices));
+    if (!rangeCount)
+        return true;
 
+    const TransientContextLock contextLock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+    write(ranges, rangeCount);
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
     return true;
@@ -215,14 +318,30 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 
     if (GLEXT_copy_buffer)
     {
+        std::size_t vertexCount = vertexBuffer.m_size;
+
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, vertexBuffer.m_buffer));
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, m_buffer));
 
+        if (m_streamRing)
+        {
+            // Copy to the next segment, without spilling into the one after it
+            const std::size_t previous = m_streamRing->advance();
+            vertexCount                = std::min(vertexCount, m_size);
+
+            if (vertexCount < m_size)
+                glCheck(GLEXT_glCopyBufferSubData(GLEXT_GL_COPY_WRITE_BUFFER,
+                                                  GLEXT_GL_COPY_WRITE_BUFFER,
+                                                  static_cast<GLintptr>(sizeof(Vertex) * previous * m_size),
+                                                  static_cast<GLintptr>(sizeof(Vertex) * getSegmentOffset()),
+                                                  static_cast<GLsizeiptr>(sizeof(Vertex) * m_size)));
+        }
+
         glCheck(GLEXT_glCopyBufferSubData(GLEXT_GL_COPY_READ_BUFFER,
                                           GLEXT_GL_COPY_WRITE_BUFFER,
-                                          0,
-                                          0,
-                                          static_cast<GLsizeiptr>(sizeof(Vertex) * vertexBuffer.m_size)));
+                                          static_cast<GLintptr>(sizeof(Vertex) * vertexBuffer.getSegmentOffset()),
+                                          static_cast<GLintptr>(sizeof(Vertex) * getSegmentOffset()),
+                                          static_cast<GLsizeiptr>(sizeof(Vertex) * vertexCount)));
 
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, 0));
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, 0));
@@ -242,7 +361,9 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 
     const void* const source = glCheck(GLEXT_glMapBuffer(GLEXT_GL_ARRAY_BUFFER, GLEXT_GL_READ_ONLY));
 
-    std::memcpy(destination, source, sizeof(Vertex) * vertexBuffer.m_size);
+    std::memcpy(destination,
+                static_cast<const std::byte*>(source) + sizeof(Vertex) * vertexBuffer.getSegmentOffset(),
+                sizeof(Vertex) * vertexBuffer.m_size);
 
     const GLboolean sourceResult = glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
 
@@ -276,6 +397,7 @@ void VertexBuffer::swap(VertexBuffer& right) noexcept
     std::swap(m_buffer, right.m_buffer);
     std::swap(m_primitiveType, right.m_primitiveType);
     std::swap(m_usage, right.m_usage);
+    std::swap(m_streamRing, right.m_streamRing);
 }
 
 
@@ -286,6 +408,13 @@ unsigned int VertexBuffer::getNativeHandle() const
 }
 
 
+////////////////////////////////////////////////////////////
+std::size_t VertexBuffer::getSegmentOffset() const
+{
+    return m_streamRing ? m_streamRing->segment * m_size : 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 void VertexBuffer::bind(const VertexBuffer* vertexBuffer)
 {
@@ -343,6 +472,26 @@ bool VertexBuffer::isAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+bool VertexBuffer::isStreamRingAvailable()
+{
+    static const bool available = []
+    {
+        if (!isAvailable())
+            return false;
+
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_sync && GLEXT_copy_buffer && GLEXT_map_buffer_range;
+    }();
+
+    return available;
+}
+
+
 ////////////////////////////////////////////////////////////
 void VertexBuffer::draw(RenderTarget& target, RenderStates states) const
 {
@@ -351,6 +500,85 @@ void VertexBuffer::draw(RenderTarget& target, RenderStates states) const
 }
 
 
+////////////////////////////////////////////////////////////
+void VertexBuffer::allocate(std::size_t vertexCount)
+{
+    // Re-specifying the storage drops the previous segments and their fences
+    if ((m_usage == Usage::Stream) && isStreamRingAvailable())
+        m_streamRing = std::make_unique<StreamRing>();
+    else
+        m_streamRing.reset();
+
+    const std::size_t segmentCount = m_streamRing ? VertexBufferImpl::streamSegmentCount : 1;
+
+    glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                               static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount * segmentCount),
+                               nullptr,
+                               VertexBufferImpl::usageToGlEnum(m_usage)));
+
+    m_size = vertexCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexBuffer::write(const UpdateRange* ranges, std::size_t rangeCount)
+{
+    std::size_t segmentOffset = 0;
+
+    if (m_streamRing && m_size)
+    {
+        const std::size_t previous = m_streamRing->advance();
+        segmentOffset              = getSegmentOffset();
+
+        if (VertexBufferImpl::coversBuffer(ranges, rangeCount, m_size))
+        {
+            // Nothing reads the new segment anymore, so it can be mapped without waiting for the driver
+            void* destination = nullptr;
+            glCheck(destination = GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER,
+                                                         static_cast<GLintptr>(sizeof(Vertex) * segmentOffset),
+                                                         static_cast<GLsizeiptr>(sizeof(Vertex) * m_size),
+                                                         GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_INVALIDATE_RANGE_BIT |
+                                                             GLEXT_GL_MAP_UNSYNCHRONIZED_BIT));
+
+            if (destination)
+            {
+                for (std::size_t i = 0; i < rangeCount; ++i)
+                    std::memcpy(static_cast<std::byte*>(destination) + sizeof(Vertex) * ranges[i].offset,
+                                ranges[i].vertices,
+                                sizeof(Vertex) * ranges[i].vertexCount);
+
+                GLboolean result = GL_FALSE;
+                glCheck(result = GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
+
+                // The contents are only lost in rare cases such as a display mode change, write them again
+                if (result == GL_TRUE)
+                    return;
+            }
+        }
+        else
+        {
+            // Carry the vertices which aren't written over from the previous segment, without a round trip to the CPU
+            glCheck(GLEXT_glCopyBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                              GLEXT_GL_ARRAY_BUFFER,
+                                              static_cast<GLintptr>(sizeof(Vertex) * previous * m_size),
+                                              static_cast<GLintptr>(sizeof(Vertex) * segmentOffset),
+                                              static_cast<GLsizeiptr>(sizeof(Vertex) * m_size)));
+        }
+    }
+
+    for (std::size_t i = 0; i < rangeCount; ++i)
+    {
+        if (!ranges[i].vertexCount)
+            continue;
+
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                      static_cast<GLintptrARB>(sizeof(Vertex) * (segmentOffset + ranges[i].offset)),
+                                      static_cast<GLsizeiptrARB>(sizeof(Vertex) * ranges[i].vertexCount),
+                                      ranges[i].vertices));
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void swap(VertexBuffer& left, VertexBuffer& right) noexcept
 {
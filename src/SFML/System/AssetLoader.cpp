@@ -0,0 +1,206 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2025 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/AssetLoader.hpp>
+#include <SFML/System/Clock.hpp>
+
+#include <algorithm>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+AssetLoader::AssetLoader(unsigned int threadCount)
+{
+    if (threadCount == 0)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    m_threads.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i)
+        m_threads.emplace_back(&AssetLoader::run, this);
+}
+
+
+////////////////////////////////////////////////////////////
+AssetLoader::~AssetLoader()
+{
+    {
+        const std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+    m_taskCondition.notify_all();
+
+    for (std::thread& thread : m_threads)
+        thread.join();
+
+    // Destroying the pending tasks breaks the promises of their futures
+    m_tasks.clear();
+    m_finalizers.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t AssetLoader::update(Time timeLimit)
+{
+    const Clock clock;
+    std::size_t count = 0;
+
+    while (true)
+    {
+        std::function<void()> finalizer;
+        {
+            const std::lock_guard lock(m_mutex);
+            if (m_finalizers.empty())
+                break;
+
+            finalizer = std::move(m_finalizers.front());
+            m_finalizers.pop_front();
+        }
+
+        finalizer();
+        ++count;
+
+        if ((timeLimit != Time::Zero) && (clock.getElapsedTime() >= timeLimit))
+            break;
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+void AssetLoader::wait()
+{
+    std::unique_lock lock(m_mutex);
+
+    while (m_completedCount < m_taskCount)
+    {
+        if (m_finalizers.empty())
+        {
+            m_updateCondition.wait(lock);
+            continue;
+        }
+
+        const std::function<void()> finalizer = std::move(m_finalizers.front());
+        m_finalizers.pop_front();
+
+        lock.unlock();
+        finalizer();
+        lock.lock();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t AssetLoader::getTaskCount() const
+{
+    const std::lock_guard lock(m_mutex);
+    return m_taskCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t AssetLoader::getCompletedCount() const
+{
+    const std::lock_guard lock(m_mutex);
+    return m_completedCount;
+}
+
+
+////////////////////////////////////////////////////////////
+float AssetLoader::getProgress() const
+{
+    const std::lock_guard lock(m_mutex);
+    if (m_taskCount == 0)
+        return 1.f;
+
+    return static_cast<float>(m_completedCount) / static_cast<float>(m_taskCount);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int AssetLoader::getThreadCount() const
+{
+    return static_cast<unsigned int>(m_threads.size());
+}
+
+
+////////////////////////////////////////////////////////////
+void AssetLoader::enqueue(std::function<void()> task)
+{
+    {
+        const std::lock_guard lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+        ++m_taskCount;
+    }
+    m_taskCondition.notify_one();
+}
+
+
+////////////////////////////////////////////////////////////
+void AssetLoader::enqueueFinalizer(std::function<void()> finalizer)
+{
+    {
+        const std::lock_guard lock(m_mutex);
+        m_finalizers.push_back(std::move(finalizer));
+    }
+    m_updateCondition.notify_all();
+}
+
+
+////////////////////////////////////////////////////////////
+void AssetLoader::complete()
+{
+    {
+        const std::lock_guard lock(m_mutex);
+        ++m_completedCount;
+    }
+    m_updateCondition.notify_all();
+}
+
+
+////////////////////////////////////////////////////////////
+void AssetLoader::run()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock lock(m_mutex);
+            m_taskCondition.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+            if (m_stopping)
+                return;
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+
+        task();
+    }
+}
+
+} // namespace sf
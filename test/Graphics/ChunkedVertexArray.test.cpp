@@ -0,0 +1,170 @@
+#include <SFML/Graphics/ChunkedVertexArray.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <array>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::ChunkedVertexArray")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::ChunkedVertexArray>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::ChunkedVertexArray>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::ChunkedVertexArray>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::ChunkedVertexArray>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::ChunkedVertexArray chunkedVertexArray;
+            CHECK(chunkedVertexArray.getVertexCount() == 0);
+            CHECK(chunkedVertexArray.getChunkCount() == 0);
+            CHECK(chunkedVertexArray.getPrimitiveType() == sf::PrimitiveType::Triangles);
+            CHECK(chunkedVertexArray.getChunkSize() == sf::Vector2f(512, 512));
+            CHECK(chunkedVertexArray.getBounds() == sf::FloatRect({0, 0}, {0, 0}));
+        }
+
+        SECTION("Explicit constructor")
+        {
+            const sf::ChunkedVertexArray chunkedVertexArray(sf::PrimitiveType::Lines, {100, 50});
+            CHECK(chunkedVertexArray.getVertexCount() == 0);
+            CHECK(chunkedVertexArray.getChunkCount() == 0);
+            CHECK(chunkedVertexArray.getPrimitiveType() == sf::PrimitiveType::Lines);
+            CHECK(chunkedVertexArray.getChunkSize() == sf::Vector2f(100, 50));
+        }
+    }
+
+    SECTION("Append primitives")
+    {
+        sf::ChunkedVertexArray chunkedVertexArray(sf::PrimitiveType::Triangles, {100, 100});
+
+        const std::array vertices = {sf::Vertex{{10, 10}},
+                                     sf::Vertex{{20, 10}},
+                                     sf::Vertex{{10, 20}},
+                                     sf::Vertex{{150, 10}},
+                                     sf::Vertex{{160, 10}},
+                                     sf::Vertex{{150, 20}},
+                                     sf::Vertex{{-50, -50}},
+                                     sf::Vertex{{-40, -50}},
+                                     sf::Vertex{{-50, -40}},
+                                     sf::Vertex{{0, 0}}};
+        chunkedVertexArray.append(vertices.data(), vertices.size());
+        CHECK(chunkedVertexArray.getVertexCount() == 9);
+        CHECK(chunkedVertexArray.getChunkCount() == 3);
+        CHECK(chunkedVertexArray.getBounds() == sf::FloatRect({-50, -50}, {210, 70}));
+
+        // Primitives are stored in the chunk containing their center
+        const std::array overlapping = {sf::Vertex{{90, 90}}, sf::Vertex{{105, 90}}, sf::Vertex{{90, 105}}};
+        chunkedVertexArray.append(overlapping.data(), overlapping.size());
+        CHECK(chunkedVertexArray.getVertexCount() == 12);
+        CHECK(chunkedVertexArray.getChunkCount() == 3);
+        CHECK(chunkedVertexArray.getBounds() == sf::FloatRect({-50, -50}, {210, 155}));
+
+        chunkedVertexArray.append(nullptr, 3);
+        CHECK(chunkedVertexArray.getVertexCount() == 12);
+    }
+
+    SECTION("Append strips and fans")
+    {
+        const std::array vertices = {sf::Vertex{{0, 0}},
+                                     sf::Vertex{{10, 0}},
+                                     sf::Vertex{{0, 10}},
+                                     sf::Vertex{{10, 10}},
+                                     sf::Vertex{{0, 20}}};
+
+        sf::ChunkedVertexArray lineStrip(sf::PrimitiveType::LineStrip);
+        lineStrip.append(vertices.data(), vertices.size());
+        CHECK(lineStrip.getVertexCount() == 8);
+        CHECK(lineStrip.getPrimitiveType() == sf::PrimitiveType::LineStrip);
+
+        sf::ChunkedVertexArray triangleStrip(sf::PrimitiveType::TriangleStrip);
+        triangleStrip.append(vertices.data(), vertices.size());
+        CHECK(triangleStrip.getVertexCount() == 9);
+
+        sf::ChunkedVertexArray triangleFan(sf::PrimitiveType::TriangleFan);
+        triangleFan.append(vertices.data(), vertices.size());
+        CHECK(triangleFan.getVertexCount() == 9);
+        CHECK(triangleFan.getChunkCount() == 1);
+        CHECK(triangleFan.getBounds() == sf::FloatRect({0, 0}, {10, 20}));
+
+        // Strips need at least one complete primitive
+        triangleStrip.append(vertices.data(), 2);
+        CHECK(triangleStrip.getVertexCount() == 9);
+    }
+
+    SECTION("Clear")
+    {
+        sf::ChunkedVertexArray chunkedVertexArray(sf::PrimitiveType::Points, {10, 10});
+        const std::array       vertices = {sf::Vertex{{5, 5}}, sf::Vertex{{15, 5}}, sf::Vertex{{25, 5}}};
+        chunkedVertexArray.append(vertices.data(), vertices.size());
+        CHECK(chunkedVertexArray.getChunkCount() == 3);
+
+        chunkedVertexArray.clear();
+        CHECK(chunkedVertexArray.getVertexCount() == 0);
+        CHECK(chunkedVertexArray.getChunkCount() == 0);
+        CHECK(chunkedVertexArray.getBounds() == sf::FloatRect({0, 0}, {0, 0}));
+    }
+}
+
+TEST_CASE("[Graphics] sf::ChunkedVertexArray drawing", runDisplayTests())
+{
+    // One chunk inside the target and two far outside of it
+    sf::ChunkedVertexArray chunkedVertexArray(sf::PrimitiveType::Triangles, {100, 100});
+    const std::array       vertices = {sf::Vertex{{10, 10}, sf::Color::Red},
+                                       sf::Vertex{{90, 10}, sf::Color::Red},
+                                       sf::Vertex{{10, 90}, sf::Color::Red},
+                                       sf::Vertex{{1010, 10}, sf::Color::Red},
+                                       sf::Vertex{{1090, 10}, sf::Color::Red},
+                                       sf::Vertex{{1010, 90}, sf::Color::Red},
+                                       sf::Vertex{{-990, 10}, sf::Color::Red},
+                                       sf::Vertex{{-910, 10}, sf::Color::Red},
+                                       sf::Vertex{{-990, 90}, sf::Color::Red}};
+    chunkedVertexArray.append(vertices.data(), vertices.size());
+    REQUIRE(chunkedVertexArray.getChunkCount() == 3);
+
+    sf::RenderTexture renderTexture({100, 100});
+
+    SECTION("Chunks outside the view are skipped")
+    {
+        renderTexture.clear();
+        renderTexture.draw(chunkedVertexArray);
+        renderTexture.display();
+        CHECK(renderTexture.getFrameStatistics().drawCalls == 1);
+        CHECK(renderTexture.getFrameStatistics().culledDraws == 2);
+        CHECK(renderTexture.getFrameStatistics().vertices == 3);
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({20, 20}) == sf::Color::Red);
+    }
+
+    SECTION("Nothing is drawn when all chunks are outside the view")
+    {
+        sf::View view = renderTexture.getView();
+        view.move({0, 500});
+        renderTexture.setView(view);
+
+        renderTexture.clear();
+        renderTexture.draw(chunkedVertexArray);
+        renderTexture.display();
+        CHECK(renderTexture.getFrameStatistics().drawCalls == 0);
+        CHECK(renderTexture.getFrameStatistics().culledDraws == 3);
+    }
+
+    SECTION("Culling enabled on the target")
+    {
+        // The chunks outside the view are skipped before reaching the target, they are only counted once
+        renderTexture.setCullingEnabled(true);
+        renderTexture.clear();
+        renderTexture.draw(chunkedVertexArray);
+        renderTexture.display();
+        CHECK(renderTexture.getFrameStatistics().drawCalls == 1);
+        CHECK(renderTexture.getFrameStatistics().culledDraws == 2);
+    }
+}
@@ -0,0 +1,181 @@
+#include <SFML/Graphics/CommandList.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <array>
+#include <type_traits>
+
+namespace
+{
+const std::array<sf::Vertex, 3> triangle{sf::Vertex{{0, 0}, sf::Color::Red},
+                                         sf::Vertex{{2, 0}, sf::Color::Red},
+                                         sf::Vertex{{0, 2}, sf::Color::Red}};
+} // namespace
+
+TEST_CASE("[Graphics] sf::CommandList")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::CommandList>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::CommandList>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::CommandList>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::CommandList>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::CommandList commandList;
+        CHECK(commandList.getCommandCount() == 0);
+        CHECK(commandList.getVertexCount() == 0);
+        CHECK(commandList.getLayer() == 0);
+    }
+
+    SECTION("draw()")
+    {
+        sf::CommandList commandList;
+        commandList.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles);
+        CHECK(commandList.getCommandCount() == 1);
+        CHECK(commandList.getVertexCount() == 3);
+
+        // Draws which only differ by their transform are merged
+        sf::RenderStates states;
+        states.transform.translate({2, 0});
+        commandList.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles, states);
+        CHECK(commandList.getCommandCount() == 1);
+        CHECK(commandList.getVertexCount() == 6);
+
+        // Strips are converted to lists
+        const std::array<sf::Vertex, 4> strip{};
+        commandList.draw(strip.data(), strip.size(), sf::PrimitiveType::TriangleStrip);
+        CHECK(commandList.getCommandCount() == 1);
+        CHECK(commandList.getVertexCount() == 12);
+
+        // Other states can't be merged
+        const sf::RenderStates additive(sf::BlendAdd);
+        commandList.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles, additive);
+        CHECK(commandList.getCommandCount() == 2);
+        commandList.draw(triangle.data(), 2, sf::PrimitiveType::Lines);
+        CHECK(commandList.getCommandCount() == 3);
+        CHECK(commandList.getVertexCount() == 17);
+
+        // Nothing to draw
+        commandList.draw(nullptr, 3, sf::PrimitiveType::Triangles);
+        commandList.draw(triangle.data(), 2, sf::PrimitiveType::Triangles);
+        CHECK(commandList.getCommandCount() == 3);
+        CHECK(commandList.getVertexCount() == 17);
+
+        sf::VertexArray vertexArray(sf::PrimitiveType::Lines, 4);
+        commandList.draw(vertexArray);
+        CHECK(commandList.getCommandCount() == 3);
+        CHECK(commandList.getVertexCount() == 21);
+    }
+
+    SECTION("Set view and layer")
+    {
+        sf::CommandList commandList;
+        commandList.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles);
+        commandList.setView(sf::View({0, 0}, {100, 100}));
+        commandList.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles);
+        CHECK(commandList.getCommandCount() == 2);
+
+        commandList.setLayer(3);
+        CHECK(commandList.getLayer() == 3);
+        commandList.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles);
+        CHECK(commandList.getCommandCount() == 3);
+    }
+
+    SECTION("sort()")
+    {
+        sf::CommandList commandList;
+        for (int i = 0; i < 4; ++i)
+        {
+            commandList.setLayer(i % 2);
+            commandList.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles);
+        }
+        CHECK(commandList.getCommandCount() == 4);
+
+        commandList.sort();
+        CHECK(commandList.getCommandCount() == 2);
+        CHECK(commandList.getVertexCount() == 12);
+
+        // Draws don't move across view changes
+        commandList.setView(sf::View({0, 0}, {100, 100}));
+        commandList.setLayer(0);
+        commandList.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles);
+        commandList.sort();
+        CHECK(commandList.getCommandCount() == 3);
+    }
+
+    SECTION("append()")
+    {
+        sf::CommandList first;
+        first.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles);
+
+        sf::CommandList second;
+        second.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles);
+        second.setView(sf::View({0, 0}, {100, 100}));
+        second.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles);
+
+        first.append(second);
+        CHECK(first.getCommandCount() == 2);
+        CHECK(first.getVertexCount() == 9);
+        CHECK(second.getCommandCount() == 2);
+
+        // The view of the next draws isn't changed
+        first.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles);
+        CHECK(first.getCommandCount() == 3);
+
+        // The first command of the copy is merged with the last one
+        first.append(first);
+        CHECK(first.getCommandCount() == 5);
+        CHECK(first.getVertexCount() == 24);
+    }
+
+    SECTION("clear()")
+    {
+        sf::CommandList commandList;
+        commandList.setLayer(2);
+        commandList.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles);
+        commandList.clear();
+        CHECK(commandList.getCommandCount() == 0);
+        CHECK(commandList.getVertexCount() == 0);
+        CHECK(commandList.getLayer() == 0);
+    }
+}
+
+TEST_CASE("[Graphics] sf::CommandList submission", runDisplayTests())
+{
+    sf::RenderTexture renderTexture({4, 4});
+    const sf::View    initialView = renderTexture.getView();
+
+    sf::CommandList  commandList;
+    sf::RenderStates states;
+    commandList.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles);
+    states.transform.translate({2, 2});
+    commandList.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles, states);
+
+    // Zoom on the top-left quarter
+    commandList.setView(sf::View({1, 1}, {2, 2}));
+    commandList.draw(triangle.data(), triangle.size(), sf::PrimitiveType::Triangles, sf::RenderStates(sf::BlendAdd));
+    CHECK(commandList.getCommandCount() == 2);
+
+    renderTexture.clear();
+    commandList.submit(renderTexture);
+    renderTexture.display();
+
+    CHECK(renderTexture.getView().getCenter() == initialView.getCenter());
+    CHECK(renderTexture.getView().getSize() == initialView.getSize());
+
+    const sf::Image image = renderTexture.getTexture().copyToImage();
+    CHECK(image.getPixel({0, 0}) == sf::Color::Red);
+    CHECK(image.getPixel({1, 1}) == sf::Color::Red);
+    CHECK(image.getPixel({2, 2}) == sf::Color::Red);
+    CHECK(image.getPixel({3, 1}) == sf::Color::Black);
+    CHECK(image.getPixel({3, 3}) == sf::Color::Black);
+}
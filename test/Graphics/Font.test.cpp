@@ -11,7 +11,10 @@
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <chrono>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Graphics] sf::Font", runDisplayTests())
 {
@@ -252,6 +255,81 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
         }
     }
 
+    SECTION("Glyph atlas")
+    {
+        const sf::Font font("Graphics/tuffy.ttf");
+        CHECK(font.getAtlasStatistics().textureCount == 0);
+        CHECK(font.getTextureCount(24) == 1);
+        CHECK(font.getAtlasStatistics(24).textureCount == 1);
+        CHECK(font.getAtlasStatistics(24).glyphCount == 0);
+
+        std::vector<sf::IntRect> textureRects;
+        for (char32_t codePoint = U'A'; codePoint <= U'z'; ++codePoint)
+        {
+            const auto& glyph = font.getGlyph(codePoint, 24, false);
+            CHECK(glyph.textureIndex == 0);
+            if (glyph.textureRect.size != sf::Vector2i())
+                textureRects.push_back(glyph.textureRect);
+        }
+
+        for (std::size_t i = 0; i < textureRects.size(); ++i)
+            for (std::size_t j = i + 1; j < textureRects.size(); ++j)
+                CHECK(!textureRects[i].findIntersection(textureRects[j]).has_value());
+
+        const auto statistics = font.getAtlasStatistics(24);
+        CHECK(statistics.textureCount == 1);
+        CHECK(statistics.glyphCount == textureRects.size());
+        CHECK(statistics.usedArea > 0);
+        CHECK(statistics.usedArea + statistics.wastedArea <= statistics.textureArea);
+        CHECK(font.getAtlasStatistics().glyphCount == statistics.glyphCount);
+    }
+
+    SECTION("Distance field")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+        CHECK(!font.isDistanceFieldEnabled());
+        font.setDistanceFieldEnabled(true);
+        CHECK(font.isDistanceFieldEnabled());
+
+        const auto& small = font.getGlyph(U'A', 16, false);
+        const auto& large = font.getGlyph(U'A', 32, false);
+        CHECK(small.textureRect == large.textureRect);
+        CHECK(small.bounds.size * 2.f == large.bounds.size);
+        CHECK(small.advance * 2.f == large.advance);
+        CHECK(&font.getTexture(16) == &font.getTexture(32));
+        CHECK(font.getTexture(16).isSmooth());
+        CHECK(font.getAtlasStatistics().textureCount == 1);
+        CHECK(font.getAtlasStatistics().glyphCount == 1);
+
+        font.setDistanceFieldEnabled(false);
+        CHECK(&font.getTexture(16) != &font.getTexture(32));
+    }
+
+    SECTION("Asynchronous loading")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+        CHECK(!font.isAsyncLoadingEnabled());
+        font.setAsyncLoadingEnabled(true);
+        CHECK(font.isAsyncLoadingEnabled());
+
+        font.preloadGlyphs(U"ABC", 24);
+        const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (font.getPendingGlyphCount() > 0 && std::chrono::steady_clock::now() < timeout)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        CHECK(font.getPendingGlyphCount() == 0);
+        CHECK(font.getGlyph(U'A', 24, false).textureRect.size != sf::Vector2i());
+        CHECK(font.getGlyph(U'B', 24, false).advance > 0);
+
+        const sf::Font copy(font); // NOLINT(performance-unnecessary-copy-initialization)
+        CHECK(copy.isAsyncLoadingEnabled());
+        CHECK(copy.getGlyph(U'C', 24, false).textureRect == font.getGlyph(U'C', 24, false).textureRect);
+
+        font.setAsyncLoadingEnabled(false);
+        CHECK(!font.isAsyncLoadingEnabled());
+        CHECK(font.getGlyph(U'D', 24, false).textureRect.size != sf::Vector2i());
+    }
+
     SECTION("Set/get smooth")
     {
         sf::Font font("Graphics/tuffy.ttf");
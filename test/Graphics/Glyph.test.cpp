@@ -23,5 +23,6 @@ TEST_CASE("[Graphics] sf::Glyph")
         STATIC_CHECK(glyph.rsbDelta == 0);
         STATIC_CHECK(glyph.bounds == sf::FloatRect());
         STATIC_CHECK(glyph.textureRect == sf::IntRect());
+        STATIC_CHECK(glyph.textureIndex == 0);
     }
 }
@@ -4,6 +4,7 @@
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
@@ -745,4 +746,181 @@ TEST_CASE("[Graphics] sf::Image")
 
         CHECK(image.getPixel(sf::Vector2u(0, 9)) == sf::Color::Green);
     }
+
+    SECTION("Large image")
+    {
+        // Odd sizes leave pixels for the scalar code, and the image is large enough to be split across threads
+        const sf::Vector2u size(2045, 1031);
+        const auto         colorAt = [](unsigned int x, unsigned int y)
+        {
+            return sf::Color(static_cast<std::uint8_t>(x),
+                             static_cast<std::uint8_t>(y),
+                             static_cast<std::uint8_t>(x ^ y),
+                             static_cast<std::uint8_t>(x + y));
+        };
+
+        sf::Image image(size);
+        for (unsigned int y = 0; y < size.y; ++y)
+            for (unsigned int x = 0; x < size.x; ++x)
+                image.setPixel({x, y}, colorAt(x, y));
+
+        SECTION("Flip")
+        {
+            image.flipHorizontally();
+            image.flipVertically();
+            CHECK(image.getPixel({0, 0}) == colorAt(size.x - 1, size.y - 1));
+            CHECK(image.getPixel({517, 3}) == colorAt(size.x - 518, size.y - 4));
+            CHECK(image.getPixel({2044, 1030}) == colorAt(0, 0));
+        }
+
+        SECTION("Copy with alpha")
+        {
+            sf::Image destination(size, sf::Color(255, 0, 0, 128));
+            CHECK(destination.copy(image, {0, 0}, {}, true));
+
+            // Same as the blending of a single pixel
+            for (const sf::Vector2u position : {sf::Vector2u(0, 0), sf::Vector2u(3, 1), sf::Vector2u(2044, 1030)})
+            {
+                sf::Image pixel({1, 1}, sf::Color(255, 0, 0, 128));
+                CHECK(pixel.copy(sf::Image({1, 1}, colorAt(position.x, position.y)), {0, 0}, {}, true));
+                CHECK(destination.getPixel(position) == pixel.getPixel({0, 0}));
+            }
+        }
+
+        SECTION("Mask")
+        {
+            image.createMaskFromColor(colorAt(1000, 500), 7);
+            CHECK(image.getPixel({1000, 500}) == sf::Color(232, 244, 28, 7));
+            CHECK(image.getPixel({999, 500}) == colorAt(999, 500));
+        }
+    }
+
+    SECTION("fill()")
+    {
+        sf::Image image({10, 10}, sf::Color::Red);
+
+        image.fill(sf::Color::Blue, {{8, 7}, {20, 20}});
+        CHECK(image.getPixel({8, 7}) == sf::Color::Blue);
+        CHECK(image.getPixel({9, 9}) == sf::Color::Blue);
+        CHECK(image.getPixel({7, 7}) == sf::Color::Red);
+        CHECK(image.getPixel({8, 6}) == sf::Color::Red);
+
+        image.fill(sf::Color::Green, {{20, 20}, {5, 5}});
+        CHECK(image.getPixel({9, 9}) == sf::Color::Blue);
+
+        image.fill(sf::Color::Green);
+        CHECK(image.getPixel({0, 0}) == sf::Color::Green);
+        CHECK(image.getPixel({9, 9}) == sf::Color::Green);
+    }
+
+    SECTION("Premultiply and unpremultiply alpha")
+    {
+        sf::Image image({5, 1}, sf::Color(200, 100, 50, 128));
+        image.setPixel({4, 0}, sf::Color(200, 100, 50, 0));
+
+        image.premultiplyAlpha();
+        CHECK(image.getPixel({0, 0}) == sf::Color(100, 50, 25, 128));
+        CHECK(image.getPixel({4, 0}) == sf::Color(0, 0, 0, 0));
+
+        image.unpremultiplyAlpha();
+        CHECK(image.getPixel({0, 0}) == sf::Color(199, 100, 50, 128));
+        CHECK(image.getPixel({4, 0}) == sf::Color(0, 0, 0, 0));
+    }
+
+    SECTION("resample()")
+    {
+        CHECK(!sf::Image().resample({10, 10}));
+        CHECK(!sf::Image({10, 10}).resample({0, 10}));
+
+        // Left half is transparent, right half is opaque green
+        sf::Image image({64, 32}, sf::Color(0, 255, 0));
+        image.fill(sf::Color::Transparent, {{0, 0}, {32, 32}});
+
+        for (const auto filter : {sf::Image::ResamplingFilter::Box,
+                                  sf::Image::ResamplingFilter::Bilinear,
+                                  sf::Image::ResamplingFilter::Lanczos})
+        {
+            sf::Image resampled = image;
+            REQUIRE(resampled.resample({16, 8}, filter));
+            CHECK(resampled.getSize() == sf::Vector2u(16, 8));
+            CHECK(resampled.getPixel({0, 0}) == sf::Color::Transparent);
+            CHECK(resampled.getPixel({15, 7}) == sf::Color(0, 255, 0));
+
+            // Transparent pixels don't darken the edge
+            const sf::Color edge = resampled.getPixel({8, 4});
+            CHECK(edge.r == 0);
+            CHECK(edge.g == 255);
+            CHECK(edge.b == 0);
+        }
+
+        sf::Image gradient({2, 1}, sf::Color::Black);
+        gradient.setPixel({1, 0}, sf::Color::White);
+        REQUIRE(gradient.resample({4, 1}, sf::Image::ResamplingFilter::Bilinear));
+        CHECK(gradient.getPixel({0, 0}) == sf::Color::Black);
+        CHECK(gradient.getPixel({1, 0}) == sf::Color(64, 64, 64));
+        CHECK(gradient.getPixel({2, 0}) == sf::Color(191, 191, 191));
+        CHECK(gradient.getPixel({3, 0}) == sf::Color::White);
+    }
+}
+
+TEST_CASE("[Graphics] sf::Image benchmark", "[.benchmark]")
+{
+    // Compositing of 4K images
+    const sf::Vector2u size(3840, 2160);
+    sf::Image          image(size, sf::Color(200, 100, 50, 128));
+    const sf::Image    overlay(size, sf::Color(20, 40, 60, 100));
+
+    BENCHMARK("copy() with alpha")
+    {
+        return image.copy(overlay, {0, 0}, {}, true);
+    };
+
+    BENCHMARK("copy() without alpha")
+    {
+        return image.copy(overlay, {0, 0});
+    };
+
+    BENCHMARK("createMaskFromColor()")
+    {
+        image.createMaskFromColor(sf::Color(200, 100, 50, 128), 64);
+    };
+
+    BENCHMARK("flipHorizontally()")
+    {
+        image.flipHorizontally();
+    };
+
+    BENCHMARK("flipVertically()")
+    {
+        image.flipVertically();
+    };
+
+    BENCHMARK("fill()")
+    {
+        image.fill(sf::Color::Cyan);
+    };
+
+    BENCHMARK("premultiplyAlpha() and unpremultiplyAlpha()")
+    {
+        image.premultiplyAlpha();
+        image.unpremultiplyAlpha();
+    };
+
+    BENCHMARK("resample() to 1080p, box")
+    {
+        sf::Image copy = image;
+        return copy.resample({1920, 1080}, sf::Image::ResamplingFilter::Box);
+    };
+
+    BENCHMARK("resample() to 1080p, bilinear")
+    {
+        sf::Image copy = image;
+        return copy.resample({1920, 1080}, sf::Image::ResamplingFilter::Bilinear);
+    };
+
+    BENCHMARK("resample() to 1080p, Lanczos")
+    {
+        sf::Image copy = image;
+        return copy.resample({1920, 1080}, sf::Image::ResamplingFilter::Lanczos);
+    };
 }
@@ -0,0 +1,197 @@
+#include <SFML/Graphics/IndexBuffer.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::IndexBuffer", "[.display]")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::IndexBuffer>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::IndexBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::IndexBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::IndexBuffer>);
+    }
+
+    // Skip tests if index buffers aren't available
+    if (!sf::IndexBuffer::isAvailable())
+        return;
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::IndexBuffer indexBuffer;
+            CHECK(indexBuffer.getIndexCount() == 0);
+            CHECK(indexBuffer.getNativeHandle() == 0);
+            CHECK(indexBuffer.getFormat() == sf::IndexBuffer::Format::UInt16);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Static);
+        }
+
+        SECTION("Usage constructor")
+        {
+            const sf::IndexBuffer indexBuffer(sf::IndexBuffer::Usage::Stream);
+            CHECK(indexBuffer.getIndexCount() == 0);
+            CHECK(indexBuffer.getNativeHandle() == 0);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Stream);
+        }
+    }
+
+    SECTION("create()")
+    {
+        sf::IndexBuffer indexBuffer;
+        CHECK(indexBuffer.create(6));
+        CHECK(indexBuffer.getIndexCount() == 6);
+        CHECK(indexBuffer.getFormat() == sf::IndexBuffer::Format::UInt16);
+        CHECK(indexBuffer.getNativeHandle() != 0);
+
+        if (sf::IndexBuffer::isUInt32Available())
+        {
+            CHECK(indexBuffer.create(12, sf::IndexBuffer::Format::UInt32));
+            CHECK(indexBuffer.getIndexCount() == 12);
+            CHECK(indexBuffer.getFormat() == sf::IndexBuffer::Format::UInt32);
+        }
+    }
+
+    SECTION("update()")
+    {
+        sf::IndexBuffer                    indexBuffer;
+        const std::array<std::uint16_t, 6> indices16{0, 1, 2, 2, 1, 3};
+        const std::array<std::uint32_t, 6> indices32{0, 1, 2, 2, 1, 3};
+
+        CHECK(!indexBuffer.update(indices16.data(), indices16.size()));
+
+        REQUIRE(indexBuffer.create(indices16.size()));
+        CHECK(indexBuffer.update(indices16.data(), indices16.size()));
+        CHECK(indexBuffer.update(indices16.data(), 3, 3));
+        CHECK(!indexBuffer.update(indices16.data(), 6, 3));
+        CHECK(!indexBuffer.update(static_cast<const std::uint16_t*>(nullptr), 6));
+
+        // The indices must match the format of the buffer
+        CHECK(!indexBuffer.update(indices32.data(), indices32.size()));
+
+        // Larger arrays grow the buffer
+        const std::array<std::uint16_t, 12> moreIndices{};
+        CHECK(indexBuffer.update(moreIndices.data(), moreIndices.size()));
+        CHECK(indexBuffer.getIndexCount() == 12);
+    }
+
+    SECTION("Move semantics")
+    {
+        sf::IndexBuffer indexBuffer(sf::IndexBuffer::Usage::Dynamic);
+        REQUIRE(indexBuffer.create(6));
+        const unsigned int handle = indexBuffer.getNativeHandle();
+
+        sf::IndexBuffer moved(std::move(indexBuffer));
+        CHECK(moved.getNativeHandle() == handle);
+        CHECK(moved.getIndexCount() == 6);
+        CHECK(moved.getUsage() == sf::IndexBuffer::Usage::Dynamic);
+
+        sf::IndexBuffer assigned;
+        assigned = std::move(moved);
+        CHECK(assigned.getNativeHandle() == handle);
+        CHECK(assigned.getIndexCount() == 6);
+    }
+
+    SECTION("Indexed drawing")
+    {
+        // A quad covering the left half of the target, made of 4 shared vertices
+        const std::array vertices = {sf::Vertex{{0, 0}, sf::Color::Red},
+                                     sf::Vertex{{0, 4}, sf::Color::Red},
+                                     sf::Vertex{{2, 0}, sf::Color::Red},
+                                     sf::Vertex{{2, 4}, sf::Color::Red}};
+        const std::array<std::uint16_t, 6> indices{0, 1, 2, 2, 1, 3};
+
+        sf::RenderTexture renderTexture({4, 4});
+
+        SECTION("Client memory")
+        {
+            renderTexture.clear();
+            renderTexture.draw(vertices.data(),
+                               vertices.size(),
+                               indices.data(),
+                               indices.size(),
+                               sf::PrimitiveType::Triangles);
+            renderTexture.display();
+        }
+
+        SECTION("Buffers")
+        {
+            sf::VertexBuffer vertexBuffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static);
+            REQUIRE(vertexBuffer.create(vertices.size()));
+            REQUIRE(vertexBuffer.update(vertices.data()));
+
+            sf::IndexBuffer indexBuffer;
+            REQUIRE(indexBuffer.create(indices.size()));
+            REQUIRE(indexBuffer.update(indices.data(), indices.size()));
+
+            renderTexture.clear();
+            renderTexture.draw(vertexBuffer, indexBuffer);
+            renderTexture.display();
+        }
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({0, 1}) == sf::Color::Red);
+        CHECK(image.getPixel({1, 3}) == sf::Color::Red);
+        CHECK(image.getPixel({3, 1}) == sf::Color::Black);
+    }
+
+    SECTION("Primitive restart")
+    {
+        if (!sf::IndexBuffer::isPrimitiveRestartAvailable() || !sf::IndexBuffer::isUInt32Available())
+            return;
+
+        // Two strips separated by a restart index, the column between them must stay empty
+        const std::array vertices = {sf::Vertex{{0, 0}, sf::Color::Red},
+                                     sf::Vertex{{0, 4}, sf::Color::Red},
+                                     sf::Vertex{{2, 0}, sf::Color::Red},
+                                     sf::Vertex{{2, 4}, sf::Color::Red},
+                                     sf::Vertex{{3, 0}, sf::Color::Red},
+                                     sf::Vertex{{3, 4}, sf::Color::Red},
+                                     sf::Vertex{{4, 0}, sf::Color::Red},
+                                     sf::Vertex{{4, 4}, sf::Color::Red}};
+        const std::array<std::uint16_t, 9> indices16{0, 1, 2, 3, 0xFFFF, 4, 5, 6, 7};
+        const std::array<std::uint32_t, 9> indices32{0, 1, 2, 3, 0xFFFFFFFF, 4, 5, 6, 7};
+
+        // The shader pipeline of core profiles streams and rebases the indices
+        sf::ContextSettings settings;
+        if (GENERATE(false, true))
+            settings.attributeFlags = sf::ContextSettings::Attribute::Core;
+
+        sf::RenderTexture renderTexture({4, 4}, settings);
+        renderTexture.clear();
+
+        // Draw twice so that the streamed vertices don't start at the beginning of the buffer
+        for (int i = 0; i < 2; ++i)
+        {
+            renderTexture.draw(vertices.data(),
+                               vertices.size(),
+                               indices16.data(),
+                               indices16.size(),
+                               sf::PrimitiveType::TriangleStrip);
+            renderTexture.draw(vertices.data(),
+                               vertices.size(),
+                               indices32.data(),
+                               indices32.size(),
+                               sf::PrimitiveType::TriangleStrip);
+        }
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({0, 1}) == sf::Color::Red);
+        CHECK(image.getPixel({1, 3}) == sf::Color::Red);
+        CHECK(image.getPixel({2, 1}) == sf::Color::Black);
+        CHECK(image.getPixel({3, 2}) == sf::Color::Red);
+    }
+}
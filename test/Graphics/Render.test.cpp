@@ -1,7 +1,11 @@
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/SpriteBatch.hpp>
 #include <SFML/Graphics/StencilMode.hpp>
+#include <SFML/Graphics/Texture.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -237,4 +241,175 @@ TEST_CASE("[Graphics] Render Tests", runDisplayTests())
             }
         }
     }
+
+    SECTION("Batching")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.setBatchingEnabled(true);
+        renderTexture.clear(sf::Color::Red);
+
+        sf::RectangleShape left({50, 100});
+        left.setFillColor(sf::Color::Green);
+        sf::RectangleShape right({50, 100});
+        right.setPosition({50, 0});
+        right.setFillColor(sf::Color::Blue);
+
+        renderTexture.draw(left);
+        renderTexture.draw(right);
+        CHECK(renderTexture.getBatchStatistics().batchedDraws == 2);
+        CHECK(renderTexture.getBatchStatistics().flushes == 0);
+
+        renderTexture.display();
+        CHECK(renderTexture.getBatchStatistics().flushes == 1);
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 50}) == sf::Color::Blue);
+
+        SECTION("Incompatible states flush the batch")
+        {
+            renderTexture.draw(left);
+            renderTexture.draw(right, sf::BlendAdd);
+            CHECK(renderTexture.getBatchStatistics().flushes == 2);
+            renderTexture.display();
+            CHECK(renderTexture.getBatchStatistics().flushes == 3);
+        }
+    }
+
+    SECTION("Frame statistics")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear();
+
+        sf::RectangleShape shape({50, 50});
+        renderTexture.draw(shape);
+        renderTexture.draw(shape);
+
+        // Statistics are only published once the frame is completed
+        CHECK(renderTexture.getFrameStatistics().drawCalls == 0);
+
+        renderTexture.display();
+        const auto& statistics = renderTexture.getFrameStatistics();
+        CHECK(statistics.drawCalls == 2);
+        CHECK(statistics.vertices == 12);
+        CHECK(statistics.viewApplications >= 1);
+        CHECK(statistics.stateChangesAvoided > 0);
+
+        // Counters are reset at the end of every frame
+        renderTexture.display();
+        CHECK(renderTexture.getFrameStatistics().drawCalls == 0);
+    }
+
+    SECTION("Shader pipeline")
+    {
+        sf::ContextSettings settings;
+        settings.attributeFlags = sf::ContextSettings::Attribute::Core;
+        sf::RenderTexture renderTexture({100, 100}, settings);
+        renderTexture.clear(sf::Color::Red);
+
+        sf::RectangleShape shape({50, 100});
+        shape.setFillColor(sf::Color::Green);
+        renderTexture.draw(shape);
+
+        sf::Image image({1, 1}, sf::Color::Blue);
+        const sf::Texture texture(image);
+        sf::Sprite        sprite(texture);
+        sprite.setPosition({50, 0});
+        sprite.setScale({50, 100});
+        renderTexture.draw(sprite);
+        renderTexture.display();
+
+        const sf::Image result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({25, 50}) == sf::Color::Green);
+        CHECK(result.getPixel({75, 50}) == sf::Color::Blue);
+    }
+
+    SECTION("Shader pipeline with a reloaded shader")
+    {
+        if (!sf::Shader::isAvailable())
+            return;
+
+        static constexpr auto colorVertexSource = R"(#version 150
+in vec2 sf_position;
+in vec4 sf_color;
+uniform mat4 sf_modelViewProjection;
+out vec4 color;
+
+void main()
+{
+    gl_Position = sf_modelViewProjection * vec4(sf_position, 0.0, 1.0);
+    color = sf_color;
+}
+)";
+
+        // Declaring another attribute first changes the locations of the program
+        static constexpr auto blueVertexSource = R"(#version 150
+in vec2 sf_texCoords;
+in vec2 sf_position;
+uniform mat4 sf_modelViewProjection;
+out vec4 color;
+
+void main()
+{
+    gl_Position = sf_modelViewProjection * vec4(sf_position + sf_texCoords * 0.0, 0.0, 1.0);
+    color = vec4(0.0, 0.0, 1.0, 1.0);
+}
+)";
+
+        static constexpr auto fragmentSource = R"(#version 150
+in vec4 color;
+out vec4 fragColor;
+
+void main()
+{
+    fragColor = color;
+}
+)";
+
+        sf::ContextSettings settings;
+        settings.attributeFlags = sf::ContextSettings::Attribute::Core;
+        sf::RenderTexture renderTexture({100, 100}, settings);
+        renderTexture.clear(sf::Color::Red);
+
+        sf::Shader shader;
+        REQUIRE(shader.loadFromMemory(colorVertexSource, fragmentSource));
+
+        sf::RectangleShape shape({50, 100});
+        shape.setFillColor(sf::Color::Green);
+        renderTexture.draw(shape, &shader);
+
+        // The locations cached for the first program must not be reused
+        REQUIRE(shader.loadFromMemory(blueVertexSource, fragmentSource));
+        shape.setPosition({50, 0});
+        renderTexture.draw(shape, &shader);
+        renderTexture.display();
+
+        const sf::Image result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({25, 50}) == sf::Color::Green);
+        CHECK(result.getPixel({75, 50}) == sf::Color::Blue);
+    }
+
+    SECTION("Sprite batch")
+    {
+        sf::Image image({2, 1});
+        image.setPixel({0, 0}, sf::Color::Green);
+        image.setPixel({1, 0}, sf::Color::Blue);
+        const sf::Texture texture(image);
+
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        sf::SpriteBatch batch(texture);
+        batch.add(sf::Transform().scale({50, 100}), {{0, 0}, {1, 1}});
+        batch.add(sf::Transform().translate({50, 0}).scale({50, 100}), {{1, 0}, {1, 1}});
+        renderTexture.draw(batch);
+        renderTexture.display();
+
+        // Both instances are rendered in a single draw call, whichever path is used
+        CHECK(renderTexture.getFrameStatistics().drawCalls == 1);
+
+        const sf::Image result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({25, 50}) == sf::Color::Green);
+        CHECK(result.getPixel({75, 50}) == sf::Color::Blue);
+    }
 }
@@ -4,6 +4,7 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include <SystemUtil.hpp>
+#include <array>
 #include <type_traits>
 
 class RenderTarget : public sf::RenderTarget
@@ -11,6 +12,8 @@ class RenderTarget : public sf::RenderTarget
 public:
     RenderTarget() = default;
 
+    using sf::RenderTarget::endFrame;
+
 private:
     sf::Vector2u getSize() const override
     {
@@ -61,6 +64,81 @@ TEST_CASE("[Graphics] sf::RenderTarget")
         CHECK(renderTarget.setActive(true));
     }
 
+    SECTION("Batching")
+    {
+        RenderTarget renderTarget;
+        CHECK(!renderTarget.isBatchingEnabled());
+        CHECK(renderTarget.getBatchStatistics().batchedDraws == 0);
+        CHECK(renderTarget.getBatchStatistics().batchedVertices == 0);
+        CHECK(renderTarget.getBatchStatistics().flushes == 0);
+
+        renderTarget.setBatchingEnabled(true);
+        CHECK(renderTarget.isBatchingEnabled());
+
+        // Flushing an empty batch is a no-op
+        renderTarget.flush();
+        CHECK(renderTarget.getBatchStatistics().flushes == 0);
+
+        renderTarget.setBatchingEnabled(false);
+        CHECK(!renderTarget.isBatchingEnabled());
+    }
+
+    SECTION("Batch statistics")
+    {
+        RenderTarget renderTarget;
+        renderTarget.setBatchingEnabled(true);
+
+        // Strips are expanded to lists when they are appended
+        const std::array<sf::Vertex, 4>
+            vertices{sf::Vertex{{0, 0}}, sf::Vertex{{10, 0}}, sf::Vertex{{0, 10}}, sf::Vertex{{10, 10}}};
+        renderTarget.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TriangleStrip);
+        CHECK(renderTarget.getBatchStatistics().batchedDraws == 1);
+        CHECK(renderTarget.getBatchStatistics().batchedVertices == 6);
+        CHECK(renderTarget.getBatchStatistics().flushes == 0);
+    }
+
+    SECTION("Frame statistics")
+    {
+        const RenderTarget renderTarget;
+        const auto&        statistics = renderTarget.getFrameStatistics();
+        CHECK(statistics.drawCalls == 0);
+        CHECK(statistics.vertices == 0);
+        CHECK(statistics.stateChangesApplied == 0);
+        CHECK(statistics.stateChangesAvoided == 0);
+        CHECK(statistics.textureBinds == 0);
+        CHECK(statistics.shaderBinds == 0);
+        CHECK(statistics.viewApplications == 0);
+        CHECK(statistics.culledDraws == 0);
+        CHECK(statistics.gpuTime == sf::Time::Zero);
+        CHECK(!renderTarget.isGpuTimingEnabled());
+    }
+
+    SECTION("Culling")
+    {
+        RenderTarget renderTarget;
+        CHECK(!renderTarget.isCullingEnabled());
+
+        renderTarget.setCullingEnabled(true);
+        CHECK(renderTarget.isCullingEnabled());
+
+        CHECK(renderTarget.isVisible({{100, 100}, {50, 50}}));
+        CHECK(renderTarget.isVisible({{-10, -10}, {20, 20}}));
+        CHECK(!renderTarget.isVisible({{1100, 100}, {50, 50}}));
+        CHECK(!renderTarget.isVisible({{-100, -100}, {50, 50}}));
+        CHECK(renderTarget.isVisible({{1100, 100}, {50, 50}}, sf::Transform().translate({-500, 0})));
+
+        // Hidden groups of draw calls are counted as culled
+        CHECK(!renderTarget.cull({{100, 100}, {50, 50}}, sf::RenderStates::Default));
+        CHECK(renderTarget.cull({{1100, 100}, {50, 50}}, sf::RenderStates::Default, 2));
+
+        // Culled draws don't reach OpenGL
+        const std::array vertices = {sf::Vertex{{2000, 0}}, sf::Vertex{{2100, 0}}, sf::Vertex{{2000, 100}}};
+        renderTarget.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles);
+        renderTarget.endFrame();
+        CHECK(renderTarget.getFrameStatistics().culledDraws == 3);
+        CHECK(renderTarget.getFrameStatistics().drawCalls == 0);
+    }
+
     const auto makeView = [](const auto& viewport)
     {
         sf::View view;
@@ -1,12 +1,19 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+
 #include <SFML/System/Exception.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <WindowUtil.hpp>
+#include <optional>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Graphics] sf::RenderTexture", runDisplayTests())
 {
@@ -125,4 +132,80 @@ TEST_CASE("[Graphics] sf::RenderTexture", runDisplayTests())
         const sf::RenderTexture renderTexture({64, 64});
         CHECK(renderTexture.getTexture().getSize() == sf::Vector2u(64, 64));
     }
+
+    SECTION("copyToImageAsync()")
+    {
+        sf::RenderTexture renderTexture({64, 64});
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.display();
+
+        const std::uint64_t ticket = renderTexture.copyToImageAsync();
+        CHECK(ticket != 0);
+
+        const std::optional<sf::Image> image = renderTexture.waitForAsyncCopy(ticket);
+        REQUIRE(image);
+        CHECK(image->getSize() == sf::Vector2u(64, 64));
+        CHECK(image->getPixel(sf::Vector2u(0, 0)) == sf::Color::Red);
+        CHECK(!renderTexture.pollAsyncCopy(ticket));
+    }
+}
+
+TEST_CASE("[Graphics] sf::RenderTexture benchmark", runDisplayTests() + "[.benchmark]")
+{
+    // Every thread renders into its own render texture, so the
+    // throughput should scale with the number of threads as long
+    // as no global lock is taken on the draw path
+    const auto renderFrames = [](std::size_t threadCount)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back(
+                []
+                {
+                    sf::RenderTexture  renderTexture({256, 256});
+                    sf::RectangleShape shape({8, 8});
+
+                    for (int frame = 0; frame < 20; ++frame)
+                    {
+                        renderTexture.clear();
+                        for (int draw = 0; draw < 1000; ++draw)
+                        {
+                            const auto column = static_cast<float>(draw % 32);
+                            const auto row    = static_cast<float>(draw / 32);
+                            shape.setPosition({column * 8.f, row * 8.f});
+                            renderTexture.draw(shape);
+                        }
+                        renderTexture.display();
+                    }
+
+                    (void)renderTexture.setActive(false);
+                });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+    };
+
+    BENCHMARK("1 thread")
+    {
+        renderFrames(1);
+    };
+
+    BENCHMARK("2 threads")
+    {
+        renderFrames(2);
+    };
+
+    BENCHMARK("4 threads")
+    {
+        renderFrames(4);
+    };
+
+    BENCHMARK("8 threads")
+    {
+        renderFrames(8);
+    };
 }
@@ -1,11 +1,18 @@
 #include <SFML/Graphics/Shader.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
+
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <filesystem>
 #include <type_traits>
 
 namespace
@@ -103,6 +110,31 @@ void main()
 }
 )";
 
+constexpr auto colorSource = R"(
+uniform vec4 color;
+
+void main()
+{
+    gl_FragColor = color;
+}
+)";
+
+constexpr auto uniformBlockSource = R"(
+#version 140
+
+layout(std140) uniform Frame
+{
+    vec4 color;
+};
+
+out vec4 fragColor;
+
+void main()
+{
+    fragColor = color;
+}
+)";
+
 #ifdef SFML_RUN_DISPLAY_TESTS
 #ifdef SFML_OPENGL_ES
 constexpr bool skipShaderDummyTest = false;
@@ -482,4 +514,96 @@ TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
             CHECK(static_cast<bool>(shader.getNativeHandle()) == sf::Shader::isGeometryAvailable());
         }
     }
+
+    SECTION("getUniformHandle()")
+    {
+        CHECK(!sf::Shader::UniformHandle().isValid());
+        CHECK(!sf::Shader().getUniformHandle("color").isValid());
+
+        if (!sf::Shader::isAvailable())
+            return;
+
+        sf::Shader shader(std::string_view(colorSource), sf::Shader::Type::Fragment);
+        CHECK(shader.getUniformHandle("color").isValid());
+        CHECK(!shader.getUniformHandle("does_not_exist").isValid());
+
+        // Values set through handles are uploaded when the shader is used
+        sf::RenderTexture renderTexture({4, 4});
+        sf::RectangleShape rectangle({4, 4});
+        const sf::Shader::UniformHandle color = shader.getUniformHandle("color");
+        shader.setUniform(color, sf::Glsl::Vec4(sf::Color::Red));
+        shader.setUniform(color, sf::Glsl::Vec4(sf::Color::Green));
+        renderTexture.clear();
+        renderTexture.draw(rectangle, &shader);
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({1, 1}) == sf::Color::Green);
+
+        // Handles resolved before the shader is loaded again are ignored
+        REQUIRE(shader.loadFromMemory(colorSource, sf::Shader::Type::Fragment));
+        shader.setUniform(color, sf::Glsl::Vec4(sf::Color::Blue));
+        shader.setUniform(shader.getUniformHandle("color"), sf::Glsl::Vec4(sf::Color::Yellow));
+        renderTexture.clear();
+        renderTexture.draw(rectangle, &shader);
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({1, 1}) == sf::Color::Yellow);
+    }
+
+    SECTION("setUniformBlock()")
+    {
+        if (!sf::Shader::isAvailable() || !sf::UniformBuffer::isAvailable())
+            return;
+
+        sf::UniformBuffer buffer;
+        REQUIRE(buffer.create(sizeof(sf::Glsl::Vec4)));
+
+        // The same buffer is shared by both shaders
+        sf::Shader shader1(std::string_view(uniformBlockSource), sf::Shader::Type::Fragment);
+        sf::Shader shader2(std::string_view(uniformBlockSource), sf::Shader::Type::Fragment);
+        shader1.setUniformBlock("Frame", buffer);
+        shader2.setUniformBlock("Frame", buffer);
+
+        const sf::Glsl::Vec4 color(sf::Color::Magenta);
+        REQUIRE(buffer.update(&color, sizeof(color)));
+
+        sf::RenderTexture renderTexture({4, 4});
+        for (const sf::Shader* shader : {&shader1, &shader2})
+        {
+            renderTexture.clear();
+            renderTexture.draw(sf::RectangleShape({4, 4}), shader);
+            renderTexture.display();
+            CHECK(renderTexture.getTexture().copyToImage().getPixel({1, 1}) == sf::Color::Magenta);
+        }
+    }
+
+    SECTION("Binary cache")
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "sfml-shader-cache-test";
+        std::filesystem::remove_all(directory);
+
+        CHECK(sf::Shader::getBinaryCacheDirectory().empty());
+        sf::Shader::setBinaryCacheDirectory(directory);
+        CHECK(sf::Shader::getBinaryCacheDirectory() == directory);
+
+        const sf::Shader::BinaryCacheStatistics before = sf::Shader::getBinaryCacheStatistics();
+        sf::Shader                              shader;
+        CHECK(shader.loadFromMemory(colorSource, sf::Shader::Type::Fragment) == sf::Shader::isAvailable());
+        CHECK(shader.loadFromMemory(colorSource, sf::Shader::Type::Fragment) == sf::Shader::isAvailable());
+        const sf::Shader::BinaryCacheStatistics after = sf::Shader::getBinaryCacheStatistics();
+
+        if (sf::Shader::isBinaryCacheAvailable())
+        {
+            // The first load compiles and saves the program, the second one reads it back
+            CHECK(after.misses == before.misses + 1);
+            CHECK(after.hits == before.hits + 1);
+            CHECK(shader.getNativeHandle() != 0);
+        }
+        else
+        {
+            CHECK(after.misses == before.misses);
+            CHECK(after.hits == before.hits);
+        }
+
+        sf::Shader::setBinaryCacheDirectory({});
+        std::filesystem::remove_all(directory);
+    }
 }
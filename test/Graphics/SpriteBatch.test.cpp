@@ -0,0 +1,108 @@
+#include <SFML/Graphics/SpriteBatch.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Transform.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::SpriteBatch", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_constructible_v<sf::SpriteBatch, sf::Texture&&>);
+        STATIC_CHECK(!std::is_constructible_v<sf::SpriteBatch, const sf::Texture&&>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::SpriteBatch>);
+    }
+
+    const sf::Texture texture(sf::Vector2u(64, 64));
+
+    SECTION("Construction")
+    {
+        const sf::SpriteBatch batch(texture);
+        CHECK(&batch.getTexture() == &texture);
+        CHECK(batch.getInstanceCount() == 0);
+        CHECK(batch.getLocalBounds() == sf::FloatRect());
+        CHECK(batch.getGlobalBounds() == sf::FloatRect());
+    }
+
+    SECTION("Set/get texture")
+    {
+        sf::SpriteBatch   batch(texture);
+        const sf::Texture otherTexture(sf::Vector2u(64, 64));
+        batch.setTexture(otherTexture);
+        CHECK(&batch.getTexture() == &otherTexture);
+    }
+
+    SECTION("Add instances")
+    {
+        sf::SpriteBatch batch(texture);
+        CHECK(batch.add(sf::Transform::Identity, {{0, 0}, {16, 16}}) == 0);
+        CHECK(batch.add(sf::Transform().translate({10, 20}), {{16, 0}, {8, 4}}, sf::Color::Red) == 1);
+        CHECK(batch.getInstanceCount() == 2);
+
+        CHECK(batch.getInstanceTransform(0) == sf::Transform::Identity);
+        CHECK(batch.getInstanceTextureRect(0) == sf::IntRect({0, 0}, {16, 16}));
+        CHECK(batch.getInstanceColor(0) == sf::Color::White);
+
+        CHECK(batch.getInstanceTransform(1) == sf::Transform().translate({10, 20}));
+        CHECK(batch.getInstanceTextureRect(1) == sf::IntRect({16, 0}, {8, 4}));
+        CHECK(batch.getInstanceColor(1) == sf::Color::Red);
+    }
+
+    SECTION("Add sprite")
+    {
+        sf::Sprite sprite(texture, {{4, 8}, {12, 16}});
+        sprite.setPosition({5, 6});
+        sprite.setColor(sf::Color::Cyan);
+
+        sf::SpriteBatch batch(texture);
+        CHECK(batch.add(sprite) == 0);
+        CHECK(batch.getInstanceTransform(0) == sprite.getTransform());
+        CHECK(batch.getInstanceTextureRect(0) == sprite.getTextureRect());
+        CHECK(batch.getInstanceColor(0) == sf::Color::Cyan);
+        CHECK(batch.getLocalBounds() == sprite.getGlobalBounds());
+    }
+
+    SECTION("Set instance properties")
+    {
+        sf::SpriteBatch batch(texture);
+        batch.add(sf::Transform::Identity, {{0, 0}, {16, 16}});
+
+        batch.setInstanceTransform(0, sf::Transform().scale({2, 3}));
+        batch.setInstanceTextureRect(0, {{1, 2}, {3, 4}});
+        batch.setInstanceColor(0, sf::Color::Magenta);
+        CHECK(batch.getInstanceTransform(0) == sf::Transform().scale({2, 3}));
+        CHECK(batch.getInstanceTextureRect(0) == sf::IntRect({1, 2}, {3, 4}));
+        CHECK(batch.getInstanceColor(0) == sf::Color::Magenta);
+    }
+
+    SECTION("Clear")
+    {
+        sf::SpriteBatch batch(texture);
+        batch.reserve(10);
+        batch.add(sf::Transform::Identity, {{0, 0}, {16, 16}});
+        batch.clear();
+        CHECK(batch.getInstanceCount() == 0);
+        CHECK(batch.getLocalBounds() == sf::FloatRect());
+    }
+
+    SECTION("Get bounds")
+    {
+        sf::SpriteBatch batch(texture);
+        batch.add(sf::Transform::Identity, {{0, 0}, {10, 10}});
+        batch.add(sf::Transform().translate({20, 30}), {{0, 0}, {-10, -20}});
+        CHECK(batch.getLocalBounds() == sf::FloatRect({0, 0}, {30, 50}));
+
+        batch.setPosition({100, 200});
+        CHECK(batch.getGlobalBounds() == sf::FloatRect({100, 200}, {30, 50}));
+    }
+}
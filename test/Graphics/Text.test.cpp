@@ -2,12 +2,19 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 // Allow testing deprecated functions
 #ifdef _MSC_VER
@@ -100,6 +107,43 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
         CHECK(text.getString() == "abcdefghijklmnopqrstuvwxyz");
     }
 
+    SECTION("Append string")
+    {
+        const auto alignment = GENERATE(sf::Text::LineAlignment::Default, sf::Text::LineAlignment::Center);
+
+        sf::Text text(font, "First line\nSecond");
+        text.setStyle(sf::Text::Underlined);
+        text.setOutlineThickness(1);
+        text.setLineAlignment(alignment);
+        (void)text.getShapedGlyphs();
+
+        text.appendString(U" line, the longest one\n\u05e9\u05dc\u05d5\u05dd");
+        text.setString(text.getString() + "\nLast line");
+        CHECK(text.getString() == U"First line\nSecond line, the longest one\n\u05e9\u05dc\u05d5\u05dd\nLast line");
+
+        // The incremental layout must match the layout of the whole string
+        sf::Text reference(font, text.getString());
+        reference.setStyle(sf::Text::Underlined);
+        reference.setOutlineThickness(1);
+        reference.setLineAlignment(alignment);
+
+        CHECK(text.getLocalBounds() == reference.getLocalBounds());
+        CHECK(text.getShapedGlyphs().size() == reference.getShapedGlyphs().size());
+        for (std::size_t i = 0; i < reference.getShapedGlyphs().size(); ++i)
+        {
+            CHECK(text.getShapedGlyphs()[i].cluster == reference.getShapedGlyphs()[i].cluster);
+            CHECK(text.getShapedGlyphs()[i].position == reference.getShapedGlyphs()[i].position);
+        }
+
+        REQUIRE(text.getVertexData().getVertexCount() == reference.getVertexData().getVertexCount());
+        for (std::size_t i = 0; i < reference.getVertexData().getVertexCount(); ++i)
+            CHECK(text.getVertexData()[i].position == reference.getVertexData()[i].position);
+
+        REQUIRE(text.getOutlineVertexData().getVertexCount() == reference.getOutlineVertexData().getVertexCount());
+        for (std::size_t i = 0; i < reference.getOutlineVertexData().getVertexCount(); ++i)
+            CHECK(text.getOutlineVertexData()[i].position == reference.getOutlineVertexData()[i].position);
+    }
+
     SECTION("Set/get font")
     {
         sf::Text       text(font);
@@ -229,4 +273,111 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
             CHECK_THAT(text.getGlobalBounds(), equalsApprox(sf::FloatRect({69, 205}, {32, 13}), 1.f));
         }
     }
+
+    SECTION("Draw distance field glyphs")
+    {
+        sf::Font distanceFieldFont("Graphics/tuffy.ttf");
+        distanceFieldFont.setDistanceFieldEnabled(true);
+        sf::Text text(distanceFieldFont, "Hello", 32);
+        text.setOutlineThickness(2);
+
+        // Both the fixed-function and the shader pipeline have their own shader variant
+        sf::ContextSettings settings;
+        if (GENERATE(false, true))
+            settings.attributeFlags = sf::ContextSettings::Attribute::Core;
+
+        sf::RenderTexture renderTexture({128, 64}, settings);
+        renderTexture.clear(sf::Color::Black);
+        renderTexture.draw(text);
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        bool            drawn = false;
+        for (unsigned int y = 0; y < image.getSize().y; ++y)
+            for (unsigned int x = 0; x < image.getSize().x; ++x)
+                drawn = drawn || (image.getPixel({x, y}) != sf::Color::Black);
+        CHECK(drawn);
+    }
+}
+
+TEST_CASE("[Graphics] sf::Text benchmark", runDisplayTests() + "[.benchmark]")
+{
+    const sf::Font font("Graphics/tuffy.ttf");
+
+    // Log view made of 10000 lines, a new one being appended every frame
+    std::string log;
+    for (int i = 0; i < 10000; ++i)
+        log += "[" + std::to_string(i) + "] The quick brown fox jumps over the lazy dog\n";
+
+    sf::Text text(font, log, 16);
+    (void)text.getLocalBounds();
+
+    int frame = 0;
+
+    BENCHMARK("Append a line")
+    {
+        text.appendString("[frame " + std::to_string(frame++) + "] The quick brown fox jumps over the lazy dog\n");
+        return text.getLocalBounds();
+    };
+
+    BENCHMARK("Lay out the whole log")
+    {
+        const sf::Text logView(font, log, 16);
+        return logView.getLocalBounds();
+    };
+}
+
+TEST_CASE("[Graphics] sf::Text multithreaded shaping benchmark", runDisplayTests() + "[.benchmark]")
+{
+    const sf::Font font("Graphics/tuffy.ttf");
+
+    // Texts laid out on several threads share the same shaper, which
+    // should not serialize them; the glyphs are loaded beforehand since
+    // fonts cannot load glyphs from several threads at the same time
+    const sf::String paragraph = "The quick brown fox jumps over the lazy dog, 0123456789 times.\n[]()";
+    font.preloadGlyphs(paragraph, 24);
+
+    const auto shapeTexts = [&](std::size_t threadCount)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back(
+                [&]
+                {
+                    sf::Text paragraphText(font, paragraph, 24);
+
+                    for (int j = 0; j < 200; ++j)
+                    {
+                        paragraphText.setString(j % 2 ? paragraph : "()" + paragraph);
+                        (void)paragraphText.getLocalBounds();
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+    };
+
+    BENCHMARK("Shape on 1 thread")
+    {
+        shapeTexts(1);
+    };
+
+    BENCHMARK("Shape on 2 threads")
+    {
+        shapeTexts(2);
+    };
+
+    BENCHMARK("Shape on 4 threads")
+    {
+        shapeTexts(4);
+    };
+
+    BENCHMARK("Shape on 8 threads")
+    {
+        shapeTexts(8);
+    };
 }
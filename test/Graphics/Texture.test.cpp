@@ -5,13 +5,19 @@
 
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/MemoryInputStream.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <algorithm>
 #include <array>
+#include <optional>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
 {
@@ -234,6 +240,265 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         CHECK(texture.getNativeHandle() != 0);
     }
 
+    SECTION("Compressed images")
+    {
+        std::vector<std::uint8_t> data;
+        const auto                append = [&data](std::uint32_t value)
+        {
+            for (int i = 0; i < 4; ++i)
+                data.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+        };
+
+        SECTION("DDS")
+        {
+            // 8x8 BC1 image with 4 mipmap levels, all solid red
+            data = {'D', 'D', 'S', ' '};
+            append(124);     // Header size
+            append(0x21007); // Flags, with the mipmap count
+            append(8);       // Height
+            append(8);       // Width
+            append(0);       // Pitch
+            append(0);       // Depth
+            append(4);       // Mipmap count
+            for (int i = 0; i < 11; ++i)
+                append(0);
+            append(32);                                          // Pixel format size
+            append(0x4);                                         // Four character code
+            append('D' | ('X' << 8) | ('T' << 16) | ('1' << 24)); // DXT1
+            for (int i = 0; i < 10; ++i)
+                append(0);
+            REQUIRE(data.size() == 128);
+
+            for (int block = 0; block < 4 + 1 + 1 + 1; ++block)
+                data.insert(data.end(), {0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
+
+            sf::Texture texture;
+            REQUIRE(texture.loadFromMemory(data.data(), data.size()));
+            CHECK(texture.getSize() == sf::Vector2u(8, 8));
+            CHECK(!texture.isSrgb());
+            const sf::Image image = texture.copyToImage();
+            CHECK(image.getPixel({0, 0}) == sf::Color::Red);
+            CHECK(image.getPixel({7, 7}) == sf::Color::Red);
+
+            // Sub-areas are decoded on the CPU
+            REQUIRE(texture.loadFromMemory(data.data(), data.size(), false, {{2, 2}, {4, 3}}));
+            CHECK(texture.getSize() == sf::Vector2u(4, 3));
+            CHECK(texture.copyToImage().getPixel({3, 2}) == sf::Color::Red);
+
+            // Streams are read like memory
+            sf::MemoryInputStream stream(data.data(), data.size());
+            REQUIRE(texture.loadFromStream(stream));
+            CHECK(texture.getSize() == sf::Vector2u(8, 8));
+
+            // Truncated mipmap chain
+            CHECK(!texture.loadFromMemory(data.data(), data.size() - 1));
+            CHECK(texture.getSize() == sf::Vector2u(8, 8));
+        }
+
+        SECTION("KTX2")
+        {
+            // 4x4 ETC2 RGB image, a single block of red
+            data = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+            append(147); // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+            append(1);   // Type size
+            append(4);   // Width
+            append(4);   // Height
+            append(0);   // Depth
+            append(0);   // Layer count
+            append(1);   // Face count
+            append(1);   // Level count
+            for (int i = 0; i < 9; ++i)
+                append(0); // Supercompression, descriptors and key/value data
+            REQUIRE(data.size() == 80);
+            append(104); // Level offset
+            append(0);
+            append(8); // Level size
+            append(0);
+            append(8); // Uncompressed level size
+            append(0);
+            data.insert(data.end(), {0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
+
+            sf::Texture texture;
+            REQUIRE(texture.loadFromMemory(data.data(), data.size()));
+            CHECK(texture.getSize() == sf::Vector2u(4, 4));
+            const sf::Color pixel = texture.copyToImage().getPixel({1, 2});
+            CHECK(pixel.r == 255);
+            CHECK(pixel.g <= 2);
+            CHECK(pixel.b <= 2);
+
+            // Supercompressed data isn't supported
+            data[44] = 2;
+            CHECK(!texture.loadFromMemory(data.data(), data.size()));
+        }
+
+        SECTION("KTX")
+        {
+            // 8x8 BC1 image with 2 mipmap levels, all solid green
+            const auto writeKtx = [&data](bool bigEndian)
+            {
+                const auto appendField = [&data, bigEndian](std::uint32_t value)
+                {
+                    for (int i = 0; i < 4; ++i)
+                        data.push_back(static_cast<std::uint8_t>(value >> ((bigEndian ? 3 - i : i) * 8)));
+                };
+
+                data = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'};
+                appendField(0x04030201); // Endianness
+                appendField(0);          // Type
+                appendField(1);          // Type size
+                appendField(0);          // Format
+                appendField(0x83F1);     // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+                appendField(0x1908);     // GL_RGBA
+                appendField(8);          // Width
+                appendField(8);          // Height
+                appendField(0);          // Depth
+                appendField(0);          // Array size
+                appendField(1);          // Face count
+                appendField(2);          // Level count
+                appendField(0);          // Key/value data size
+
+                appendField(32);
+                for (int block = 0; block < 4; ++block)
+                    data.insert(data.end(), {0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
+                appendField(8);
+                data.insert(data.end(), {0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
+            };
+
+            sf::Texture texture;
+            writeKtx(false);
+            REQUIRE(texture.loadFromMemory(data.data(), data.size()));
+            CHECK(texture.getSize() == sf::Vector2u(8, 8));
+            CHECK(texture.copyToImage().getPixel({5, 6}) == sf::Color::Green);
+
+            writeKtx(true);
+            REQUIRE(texture.loadFromMemory(data.data(), data.size(), false, {{1, 1}, {6, 6}}));
+            CHECK(texture.getSize() == sf::Vector2u(6, 6));
+            CHECK(texture.copyToImage().getPixel({5, 5}) == sf::Color::Green);
+
+            // Only compressed internal formats are supported
+            data[19] = 1;
+            CHECK(!texture.loadFromMemory(data.data(), data.size()));
+            CHECK(texture.getSize() == sf::Vector2u(6, 6));
+        }
+
+        SECTION("Decoders")
+        {
+            // 4x4 KTX2 image made of a single block
+            const auto writeKtx2 = [&data, &append](std::uint32_t vkFormat, const std::vector<std::uint8_t>& block)
+            {
+                data = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+                append(vkFormat);
+                append(1); // Type size
+                append(4); // Width
+                append(4); // Height
+                append(0); // Depth
+                append(0); // Layer count
+                append(1); // Face count
+                append(1); // Level count
+                for (int i = 0; i < 9; ++i)
+                    append(0); // Supercompression, descriptors and key/value data
+                append(104); // Level offset
+                append(0);
+                append(static_cast<std::uint32_t>(block.size())); // Level size
+                append(0);
+                append(static_cast<std::uint32_t>(block.size())); // Uncompressed level size
+                append(0);
+                data.insert(data.end(), block.begin(), block.end());
+            };
+
+            // Loading a part of the image always decodes the blocks on the CPU
+            const auto decode = [&data]
+            {
+                sf::Texture texture;
+                REQUIRE(texture.loadFromMemory(data.data(), data.size(), false, {{0, 0}, {4, 3}}));
+                return texture.copyToImage();
+            };
+
+            // Color block of red, blue and their two interpolations, one row each
+            const std::vector<std::uint8_t> colorBlock = {0x00, 0xF8, 0x1F, 0x00, 0x00, 0x55, 0xAA, 0xFF};
+
+            SECTION("BC2")
+            {
+                // Explicit alpha, each pixel has its index as 4-bit alpha
+                std::vector<std::uint8_t> block = {0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE};
+                block.insert(block.end(), colorBlock.begin(), colorBlock.end());
+                writeKtx2(135, block);
+
+                const sf::Image image = decode();
+                CHECK(image.getPixel({0, 0}) == sf::Color(255, 0, 0, 0));
+                CHECK(image.getPixel({3, 0}) == sf::Color(255, 0, 0, 51));
+                CHECK(image.getPixel({1, 1}) == sf::Color(0, 0, 255, 85));
+                CHECK(image.getPixel({2, 2}) == sf::Color(170, 0, 85, 170));
+            }
+
+            SECTION("BC3")
+            {
+                // Interpolated alpha between 255 and 0, with indices 0, 1 and 7 for the first pixels
+                std::vector<std::uint8_t> block = {0xFF, 0x00, 0xC8, 0x01, 0x00, 0x00, 0x00, 0x00};
+                block.insert(block.end(), colorBlock.begin(), colorBlock.end());
+                writeKtx2(137, block);
+
+                const sf::Image image = decode();
+                CHECK(image.getPixel({0, 0}) == sf::Color(255, 0, 0, 255));
+                CHECK(image.getPixel({1, 0}) == sf::Color(255, 0, 0, 0));
+                CHECK(image.getPixel({2, 0}) == sf::Color(255, 0, 0, 36));
+                CHECK(image.getPixel({0, 2}) == sf::Color(170, 0, 85, 255));
+            }
+
+            SECTION("BC4")
+            {
+                // Red between 0 and 255 in 6 value mode, with indices 1, 6, 7 and 2 for the first pixels
+                writeKtx2(139, {0x00, 0xFF, 0xF1, 0x05, 0x00, 0x00, 0x00, 0x00});
+
+                const sf::Image image = decode();
+                CHECK(image.getPixel({0, 0}) == sf::Color(255, 0, 0));
+                CHECK(image.getPixel({1, 0}) == sf::Color(0, 0, 0));
+                CHECK(image.getPixel({2, 0}) == sf::Color(255, 0, 0));
+                CHECK(image.getPixel({3, 0}) == sf::Color(51, 0, 0));
+                CHECK(image.getPixel({2, 2}) == sf::Color(0, 0, 0));
+            }
+
+            SECTION("BC5")
+            {
+                // Same red channel as above, green is a single value
+                writeKtx2(141, {0x00, 0xFF, 0xF1, 0x05, 0x00, 0x00, 0x00, 0x00,
+                               0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
+
+                const sf::Image image = decode();
+                CHECK(image.getPixel({0, 0}) == sf::Color(255, 255, 0));
+                CHECK(image.getPixel({1, 0}) == sf::Color(0, 255, 0));
+                CHECK(image.getPixel({3, 0}) == sf::Color(51, 255, 0));
+            }
+
+            SECTION("BC7")
+            {
+                // Mode 6, endpoints (255, 1, 1, 255) and (0, 0, 0, 0), indices 0, 15 and 8 for the first pixels
+                writeKtx2(145, {0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x80,
+                               0xF0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
+
+                const sf::Image image = decode();
+                CHECK(image.getPixel({0, 0}) == sf::Color(255, 1, 1, 255));
+                CHECK(image.getPixel({1, 0}) == sf::Color(0, 0, 0, 0));
+                CHECK(image.getPixel({2, 0}) == sf::Color(120, 0, 0, 120));
+                CHECK(image.getPixel({3, 2}) == sf::Color(255, 1, 1, 255));
+            }
+
+            SECTION("ETC2 RGBA")
+            {
+                // EAC alpha with base 128, multiplier 2 and the first modifier table, indices 7 and 3
+                // for the pixels at (0, 0) and (1, 0), then a differential color block of red
+                writeKtx2(151, {0x80, 0x20, 0xE0, 0x06, 0x00, 0x00, 0x00, 0x00,
+                               0xF8, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00});
+
+                const sf::Image image = decode();
+                CHECK(image.getPixel({0, 0}) == sf::Color(255, 2, 2, 156));
+                CHECK(image.getPixel({1, 0}) == sf::Color(255, 2, 2, 98));
+                CHECK(image.getPixel({0, 1}) == sf::Color(255, 2, 2, 122));
+                CHECK(image.getPixel({3, 2}) == sf::Color(255, 2, 2, 122));
+            }
+        }
+    }
+
     SECTION("loadFromImage()")
     {
         SECTION("Empty image")
@@ -359,6 +624,68 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         }
     }
 
+    SECTION("Asynchronous update")
+    {
+        static constexpr std::array<std::uint8_t, 8> magentaCyan = {0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF};
+
+        sf::Texture texture(sf::Vector2u(2, 2));
+        CHECK(!texture.beginAsyncUpdate(sf::Vector2u(2, 1), sf::Vector2u(1, 0)));
+        CHECK(texture.updateAsync(nullptr, sf::Vector2u(2, 1), sf::Vector2u(0, 0)) == 0);
+
+        // Fill the staging memory from a thread without an OpenGL context
+        const auto asyncUpdate = texture.beginAsyncUpdate(sf::Vector2u(2, 1), sf::Vector2u(0, 1));
+        REQUIRE(asyncUpdate);
+        std::thread([&] { std::copy(magentaCyan.begin(), magentaCyan.end(), asyncUpdate->pixels); }).join();
+
+        const std::uint64_t first  = texture.endAsyncUpdate(*asyncUpdate);
+        const std::uint64_t second = texture.updateAsync(magentaCyan.data(), sf::Vector2u(2, 1), sf::Vector2u(0, 0));
+        CHECK(first != 0);
+        CHECK(second > first);
+
+        texture.waitForUpdate(second);
+        CHECK(texture.isUpdateComplete(first));
+        CHECK(texture.isUpdateComplete(second));
+
+        const sf::Image image = texture.copyToImage();
+        CHECK(image.getPixel(sf::Vector2u(0, 0)) == sf::Color::Magenta);
+        CHECK(image.getPixel(sf::Vector2u(1, 0)) == sf::Color::Cyan);
+        CHECK(image.getPixel(sf::Vector2u(0, 1)) == sf::Color::Magenta);
+        CHECK(image.getPixel(sf::Vector2u(1, 1)) == sf::Color::Cyan);
+    }
+
+    SECTION("Asynchronous copy")
+    {
+        static constexpr std::array<std::uint8_t, 8> magentaCyan = {0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF};
+
+        CHECK(sf::Texture().copyToImageAsync() == 0);
+
+        sf::Texture texture(sf::Vector2u(2, 1));
+        texture.update(magentaCyan.data());
+
+        // Start more copies than can be in flight at the same time
+        std::vector<std::uint64_t> tickets;
+        for (int i = 0; i < 5; ++i)
+            tickets.push_back(texture.copyToImageAsync());
+
+        for (const std::uint64_t ticket : tickets)
+        {
+            const std::optional<sf::Image> image = texture.waitForAsyncCopy(ticket);
+            REQUIRE(image);
+            CHECK(image->getSize() == sf::Vector2u(2, 1));
+            CHECK(image->getPixel(sf::Vector2u(0, 0)) == sf::Color::Magenta);
+            CHECK(image->getPixel(sf::Vector2u(1, 0)) == sf::Color::Cyan);
+
+            // Each copy is delivered only once
+            CHECK(!texture.pollAsyncCopy(ticket));
+        }
+
+        std::optional<sf::Image> delivered;
+        texture.copyToImageAsync([&](sf::Image&& image) { delivered = std::move(image); });
+        while (!delivered)
+            texture.processAsyncCopies();
+        CHECK(delivered->getPixel(sf::Vector2u(1, 0)) == sf::Color::Cyan);
+    }
+
     SECTION("Set/get smooth")
     {
         sf::Texture texture(sf::Vector2u(64, 64));
@@ -421,3 +748,29 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         CHECK(sf::Texture::getMaximumSize() > 0);
     }
 }
+
+TEST_CASE("[Graphics] sf::Texture benchmark", runDisplayTests() + "[.benchmark]")
+{
+    // Stream 4K video frames, as a player running at 60 Hz would
+    const sf::Vector2u        frameSize(3840, 2160);
+    std::vector<std::uint8_t> frame(std::size_t{frameSize.x} * frameSize.y * 4, 0x80);
+    sf::Texture               texture(frameSize);
+
+    BENCHMARK("Synchronous update")
+    {
+        texture.update(frame.data());
+    };
+
+    BENCHMARK("Asynchronous update")
+    {
+        texture.updateAsync(frame.data(), frameSize, sf::Vector2u(0, 0));
+    };
+
+    BENCHMARK("Asynchronous update filled by a worker thread")
+    {
+        // The decoder writes the frame directly into the staging memory
+        const auto asyncUpdate = texture.beginAsyncUpdate(frameSize, sf::Vector2u(0, 0));
+        std::thread([&] { std::copy(frame.begin(), frame.end(), asyncUpdate->pixels); }).join();
+        return texture.endAsyncUpdate(*asyncUpdate);
+    };
+}
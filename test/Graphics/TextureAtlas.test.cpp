@@ -0,0 +1,130 @@
+#include <SFML/Graphics/TextureAtlas.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <filesystem>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[Graphics] sf::TextureAtlas", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::TextureAtlas>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::TextureAtlas>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::TextureAtlas>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::TextureAtlas>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::TextureAtlas atlas;
+        CHECK(atlas.getImageCount() == 0);
+        CHECK(atlas.getPageCount() == 0);
+    }
+
+    SECTION("pack()")
+    {
+        sf::TextureAtlas atlas({64, 64}, 1, false);
+
+        std::vector<sf::TextureAtlas::Handle> handles;
+        for (unsigned int i = 0; i < 12; ++i)
+        {
+            const sf::Color color(0, 0, static_cast<std::uint8_t>(i));
+            handles.push_back(atlas.add(sf::Image({8 + i, 16 - i}, color)));
+        }
+
+        CHECK(atlas.getImageCount() == 12);
+        REQUIRE(atlas.pack());
+        CHECK(atlas.getPageCount() == 1);
+
+        const sf::Image page = atlas.getPage(0).copyToImage();
+        for (std::size_t i = 0; i < handles.size(); ++i)
+        {
+            const sf::IntRect rect = atlas.getTextureRect(handles[i]);
+            CHECK(&atlas.getTexture(handles[i]) == &atlas.getPage(0));
+            CHECK(rect.size == sf::Vector2i(8 + static_cast<int>(i), 16 - static_cast<int>(i)));
+            CHECK(page.getPixel(sf::Vector2u(rect.position)).b == i);
+            CHECK(page.getPixel(sf::Vector2u(rect.position + rect.size - sf::Vector2i(1, 1))).b == i);
+
+            // Images don't overlap, padding included
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                const sf::IntRect other = atlas.getTextureRect(handles[j]);
+                CHECK(!rect.findIntersection({other.position - sf::Vector2i(1, 1), other.size + sf::Vector2i(2, 2)}));
+            }
+        }
+
+        // Images added later go to the free space or to new textures
+        const sf::Texture& firstPage = atlas.getPage(0);
+        const auto         large     = atlas.add(sf::Image({60, 60}, sf::Color::Red));
+        CHECK(!atlas.getTextureRect(large).size.x);
+        REQUIRE(atlas.pack());
+        CHECK(atlas.getPageCount() == 2);
+        CHECK(&atlas.getPage(0) == &firstPage);
+        CHECK(&atlas.getTexture(large) == &atlas.getPage(1));
+
+        // Images larger than a texture are rejected
+        const auto tooLarge = atlas.add(sf::Image({64, 64}, sf::Color::Red));
+        CHECK(!atlas.pack());
+        CHECK(atlas.getTextureRect(tooLarge) == sf::IntRect());
+    }
+
+    SECTION("Extrusion")
+    {
+        sf::Image image({2, 2}, sf::Color::Red);
+        image.setPixel({1, 1}, sf::Color::Green);
+
+        sf::TextureAtlas atlas({16, 16}, 2, true);
+        const auto       handle = atlas.add(image);
+        REQUIRE(atlas.pack());
+
+        const sf::Image   page = atlas.getPage(0).copyToImage();
+        const sf::IntRect rect = atlas.getTextureRect(handle);
+        const auto        at   = [&](int x, int y)
+        { return page.getPixel(sf::Vector2u(rect.position + sf::Vector2i(x, y))); };
+        CHECK(at(-2, -2) == sf::Color::Red);
+        CHECK(at(-1, 0) == sf::Color::Red);
+        CHECK(at(3, 3) == sf::Color::Green);
+        CHECK(at(1, 3) == sf::Color::Green);
+        CHECK(at(3, 0) == sf::Color::Red);
+    }
+
+    SECTION("Layout file")
+    {
+        const auto filename = std::filesystem::temp_directory_path() / "test.layout";
+
+        std::vector<sf::IntRect> rects;
+        {
+            sf::TextureAtlas atlas({128, 128});
+            for (unsigned int i = 0; i < 20; ++i)
+                (void)atlas.add(sf::Image({4 + i * 2, 4 + (i % 5) * 3}, sf::Color::Blue));
+            REQUIRE(atlas.pack());
+            REQUIRE(atlas.saveLayoutToFile(filename));
+
+            for (std::size_t i = 0; i < atlas.getImageCount(); ++i)
+                rects.push_back(atlas.getTextureRect(i));
+        }
+
+        CHECK(!sf::TextureAtlas({256, 256}).loadLayoutFromFile(filename));
+        CHECK(!sf::TextureAtlas().loadLayoutFromFile("does/not/exist.layout"));
+
+        // Images are placed where the layout says
+        sf::TextureAtlas atlas({128, 128});
+        REQUIRE(atlas.loadLayoutFromFile(filename));
+        for (unsigned int i = 0; i < 20; ++i)
+            (void)atlas.add(sf::Image({4 + i * 2, 4 + (i % 5) * 3}, sf::Color::Blue));
+        REQUIRE(atlas.pack());
+
+        for (std::size_t i = 0; i < rects.size(); ++i)
+            CHECK(atlas.getTextureRect(i) == rects[i]);
+
+        CHECK(std::filesystem::remove(filename));
+    }
+}
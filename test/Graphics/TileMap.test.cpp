@@ -0,0 +1,126 @@
+#include <SFML/Graphics/TileMap.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <array>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TileMap", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_constructible_v<sf::TileMap, sf::Texture&&, sf::Vector2u, sf::Vector2u>);
+        STATIC_CHECK(!std::is_constructible_v<sf::TileMap, const sf::Texture&&, sf::Vector2u, sf::Vector2u>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::TileMap>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::TileMap>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TileMap>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TileMap>);
+    }
+
+    // Tile 0 is red, tile 1 is green, tile 2 is blue
+    sf::Image image({6, 2});
+    for (unsigned int x = 0; x < 6; ++x)
+    {
+        for (unsigned int y = 0; y < 2; ++y)
+            image.setPixel({x, y}, std::array{sf::Color::Red, sf::Color::Green, sf::Color::Blue}[x / 2]);
+    }
+    const sf::Texture tileset(image);
+
+    SECTION("Construction")
+    {
+        const sf::TileMap tileMap(tileset, {2, 2}, {3, 5});
+        CHECK(&tileMap.getTileset() == &tileset);
+        CHECK(tileMap.getTileSize() == sf::Vector2u(2, 2));
+        CHECK(tileMap.getMapSize() == sf::Vector2u(3, 5));
+        CHECK(tileMap.getChunkSize() == sf::Vector2u(32, 32));
+        CHECK(tileMap.getLayerCount() == 1);
+        CHECK(tileMap.getTile(0, {2, 4}) == sf::TileMap::EmptyTile);
+        CHECK(tileMap.getLocalBounds() == sf::FloatRect({0, 0}, {6, 10}));
+        CHECK(tileMap.getGlobalBounds() == sf::FloatRect({0, 0}, {6, 10}));
+    }
+
+    SECTION("Set/get tiles")
+    {
+        sf::TileMap tileMap(tileset, {2, 2}, {3, 2}, 2, {2, 2});
+        CHECK(tileMap.getLayerCount() == 2);
+        CHECK(tileMap.getChunkSize() == sf::Vector2u(2, 2));
+
+        tileMap.setTile(1, {2, 1}, 2);
+        CHECK(tileMap.getTile(1, {2, 1}) == 2);
+        CHECK(tileMap.getTile(0, {2, 1}) == sf::TileMap::EmptyTile);
+
+        const std::array<unsigned int, 6> tiles{0, 1, 2, 2, 1, 0};
+        tileMap.setTiles(0, tiles.data());
+        CHECK(tileMap.getTile(0, {0, 0}) == 0);
+        CHECK(tileMap.getTile(0, {2, 0}) == 2);
+        CHECK(tileMap.getTile(0, {0, 1}) == 2);
+        CHECK(tileMap.getTile(1, {2, 1}) == 2);
+    }
+
+    SECTION("Set/get tileset")
+    {
+        const sf::Texture otherTileset(sf::Vector2u(64, 64));
+        sf::TileMap       tileMap(tileset, {2, 2}, {3, 2});
+        tileMap.setTileset(otherTileset);
+        CHECK(&tileMap.getTileset() == &otherTileset);
+    }
+
+    SECTION("Get global bounds")
+    {
+        sf::TileMap tileMap(tileset, {2, 2}, {3, 5});
+        tileMap.setPosition({10, 20});
+        tileMap.setScale({2, 2});
+        CHECK(tileMap.getGlobalBounds() == sf::FloatRect({10, 20}, {12, 20}));
+    }
+
+    SECTION("Draw")
+    {
+        sf::RenderTexture renderTexture({6, 4});
+
+        // Two chunks in each layer, the second chunk is one tile wide
+        sf::TileMap                       tileMap(tileset, {2, 2}, {3, 2}, 2, {2, 2});
+        const std::array<unsigned int, 6> ground{0, 0, 0, 0, 0, sf::TileMap::EmptyTile};
+        tileMap.setTiles(0, ground.data());
+        tileMap.setTile(1, {1, 0}, 1);
+
+        renderTexture.clear();
+        renderTexture.draw(tileMap);
+        renderTexture.display();
+
+        sf::Image result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({0, 0}) == sf::Color::Red);
+        CHECK(result.getPixel({3, 1}) == sf::Color::Green);
+        CHECK(result.getPixel({5, 1}) == sf::Color::Red);
+        CHECK(result.getPixel({5, 3}) == sf::Color::Black);
+
+        // Edited chunks are rebuilt on the next draw
+        tileMap.setTile(0, {2, 1}, 2);
+        tileMap.setTile(1, {1, 0}, sf::TileMap::EmptyTile);
+
+        renderTexture.clear();
+        renderTexture.draw(tileMap);
+        renderTexture.display();
+
+        result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({3, 1}) == sf::Color::Red);
+        CHECK(result.getPixel({5, 3}) == sf::Color::Blue);
+
+        // Nothing is drawn once the map is moved out of the view
+        tileMap.setPosition({-6, 0});
+        renderTexture.clear();
+        renderTexture.draw(tileMap);
+        renderTexture.display();
+
+        result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({0, 0}) == sf::Color::Black);
+        CHECK(result.getPixel({5, 3}) == sf::Color::Black);
+        CHECK(renderTexture.getFrameStatistics().drawCalls == 0);
+        CHECK(renderTexture.getFrameStatistics().culledDraws == 4);
+    }
+}
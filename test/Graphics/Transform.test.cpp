@@ -1,7 +1,11 @@
 #include <SFML/Graphics/Transform.hpp>
 
+// Other 1st party headers
+#include <SFML/Graphics/Vertex.hpp>
+
 #include <SFML/System/Angle.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
@@ -10,6 +14,7 @@
 #include <vector>
 
 #include <cassert>
+#include <cstdint>
 
 TEST_CASE("[Graphics] sf::Transform")
 {
@@ -86,6 +91,69 @@ TEST_CASE("[Graphics] sf::Transform")
                      sf::FloatRect({303.0f, 904.0f}, {600.0f, 1800.0f}));
     }
 
+    SECTION("Bulk transformations")
+    {
+        constexpr sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f);
+
+        // Odd counts exercise both the vectorized and the scalar paths
+        std::vector<sf::Vector2f> points;
+        std::vector<sf::Vertex>   vertices;
+        for (int i = 0; i < 11; ++i)
+        {
+            const sf::Vector2f point(static_cast<float>(i - 5), static_cast<float>(i * i));
+            points.push_back(point);
+            vertices.push_back({point, sf::Color(static_cast<std::uint8_t>(i), 2, 3), {static_cast<float>(i), 1.0f}});
+        }
+
+        SECTION("transformPoints()")
+        {
+            std::vector<sf::Vector2f> result(points.size());
+            transform.transformPoints(points.data(), points.size(), result.data());
+            for (std::size_t i = 0; i < points.size(); ++i)
+                CHECK(result[i] == transform.transformPoint(points[i]));
+
+            // In place
+            transform.transformPoints(points.data(), points.size(), points.data());
+            CHECK(points == result);
+        }
+
+        SECTION("transformVertices()")
+        {
+            std::vector<sf::Vertex> result(vertices.size());
+            transform.transformVertices(vertices.data(), vertices.size(), result.data());
+            for (std::size_t i = 0; i < vertices.size(); ++i)
+            {
+                CHECK(result[i].position == transform.transformPoint(vertices[i].position));
+                CHECK(result[i].color == vertices[i].color);
+                CHECK(result[i].texCoords == vertices[i].texCoords);
+            }
+
+            // In place
+            transform.transformVertices(vertices.data(), vertices.size(), vertices.data());
+            for (std::size_t i = 0; i < vertices.size(); ++i)
+                CHECK(vertices[i].position == result[i].position);
+        }
+
+        SECTION("getTransformedBounds()")
+        {
+            CHECK(transform.getTransformedBounds(points.data(), 0) == sf::FloatRect());
+            CHECK(transform.getTransformedBounds(points.data(), 1) == sf::FloatRect({-2.0f, -16.0f}, {0.0f, 0.0f}));
+
+            const sf::FloatRect bounds({-2.0f, -16.0f}, {210.0f, 540.0f});
+            CHECK(transform.getTransformedBounds(points.data(), points.size()) == bounds);
+            CHECK(transform.getTransformedBounds(vertices.data(), vertices.size()) == bounds);
+
+            // Transform and bound in a single pass
+            std::vector<sf::Vector2f> result(points.size());
+            CHECK(transform.getTransformedBounds(points.data(), points.size(), result.data()) == bounds);
+            CHECK(result[10] == transform.transformPoint(points[10]));
+
+            CHECK(transform.getTransformedBounds(vertices.data(), vertices.size(), vertices.data()) == bounds);
+            CHECK(vertices[10].position == result[10]);
+            CHECK(vertices[10].color == sf::Color(10, 2, 3));
+        }
+    }
+
     SECTION("combine()")
     {
         auto identity = sf::Transform::Identity;
@@ -221,3 +289,35 @@ TEST_CASE("[Graphics] sf::Transform")
         }
     }
 }
+
+TEST_CASE("[Graphics] sf::Transform benchmark", "[.benchmark]")
+{
+    sf::Transform transform;
+    transform.translate({100.0f, 50.0f});
+    transform.rotate(sf::degrees(30));
+    transform.scale({2.0f, 2.0f});
+
+    std::vector<sf::Vertex> vertices(100'000);
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+        vertices[i].position = {static_cast<float>(i % 1000), static_cast<float>(i / 1000)};
+
+    std::vector<sf::Vertex> result(vertices.size());
+
+    BENCHMARK("transformPoint() loop")
+    {
+        for (std::size_t i = 0; i < vertices.size(); ++i)
+            result[i] = {transform.transformPoint(vertices[i].position), vertices[i].color, vertices[i].texCoords};
+        return result.back().position;
+    };
+
+    BENCHMARK("transformVertices()")
+    {
+        transform.transformVertices(vertices.data(), vertices.size(), result.data());
+        return result.back().position;
+    };
+
+    BENCHMARK("getTransformedBounds()")
+    {
+        return transform.getTransformedBounds(vertices.data(), vertices.size());
+    };
+}
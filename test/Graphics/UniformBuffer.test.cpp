@@ -0,0 +1,70 @@
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::UniformBuffer", "[.display]")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::UniformBuffer>);
+    }
+
+    // Skip tests if uniform buffers aren't available
+    if (!sf::UniformBuffer::isAvailable())
+        return;
+
+    SECTION("Construction")
+    {
+        const sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.getSize() == 0);
+        CHECK(uniformBuffer.getNativeHandle() == 0);
+    }
+
+    SECTION("create()")
+    {
+        sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.create(64));
+        CHECK(uniformBuffer.getSize() == 64);
+        CHECK(uniformBuffer.getNativeHandle() != 0);
+    }
+
+    SECTION("update()")
+    {
+        sf::UniformBuffer          uniformBuffer;
+        const std::array<float, 8> data{};
+
+        CHECK(!uniformBuffer.update(data.data(), sizeof(data)));
+
+        REQUIRE(uniformBuffer.create(sizeof(data)));
+        CHECK(uniformBuffer.update(data.data(), sizeof(data)));
+        CHECK(uniformBuffer.update(data.data(), sizeof(float), sizeof(float) * 4));
+        CHECK(!uniformBuffer.update(nullptr, sizeof(data)));
+        CHECK(!uniformBuffer.update(data.data(), sizeof(data), sizeof(float)));
+        CHECK(!uniformBuffer.update(data.data(), sizeof(float), sizeof(data)));
+        CHECK(uniformBuffer.getSize() == sizeof(data));
+    }
+
+    SECTION("Move semantics")
+    {
+        sf::UniformBuffer uniformBuffer;
+        REQUIRE(uniformBuffer.create(16));
+        const unsigned int handle = uniformBuffer.getNativeHandle();
+
+        sf::UniformBuffer moved(std::move(uniformBuffer));
+        CHECK(moved.getNativeHandle() == handle);
+        CHECK(moved.getSize() == 16);
+
+        sf::UniformBuffer assigned;
+        assigned = std::move(moved);
+        CHECK(assigned.getNativeHandle() == handle);
+        CHECK(assigned.getSize() == 16);
+    }
+}
@@ -134,6 +134,31 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
             CHECK(vertexBuffer.getVertexCount() == 128);
         }
 
+        SECTION("Ranges")
+        {
+            const std::array<sf::VertexBuffer::UpdateRange, 2> ranges = {{{vertices.data(), 16, 0},
+                                                                          {vertices.data(), 32, 96}}};
+
+            CHECK(!vertexBuffer.update(ranges.data(), ranges.size()));
+            CHECK(vertexBuffer.create(128));
+
+            SECTION("Range too large")
+            {
+                const sf::VertexBuffer::UpdateRange range{vertices.data(), 64, 100};
+                CHECK(!vertexBuffer.update(&range, 1));
+            }
+
+            SECTION("Null vertices")
+            {
+                const sf::VertexBuffer::UpdateRange range{nullptr, 16, 0};
+                CHECK(!vertexBuffer.update(&range, 1));
+            }
+
+            CHECK(vertexBuffer.update(ranges.data(), ranges.size()));
+            CHECK(vertexBuffer.update(nullptr, 0));
+            CHECK(vertexBuffer.getVertexCount() == 128);
+        }
+
         SECTION("Another buffer")
         {
             sf::VertexBuffer otherVertexBuffer;
@@ -144,6 +169,52 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
         }
     }
 
+    SECTION("Segments")
+    {
+        std::array<sf::Vertex, 64> vertices{};
+
+        SECTION("Static buffer")
+        {
+            sf::VertexBuffer vertexBuffer(sf::VertexBuffer::Usage::Static);
+            CHECK(vertexBuffer.create(64));
+            CHECK(vertexBuffer.update(vertices.data()));
+            CHECK(vertexBuffer.getSegmentOffset() == 0);
+        }
+
+        SECTION("Stream buffer")
+        {
+            sf::VertexBuffer vertexBuffer(sf::VertexBuffer::Usage::Stream);
+            CHECK(vertexBuffer.create(64));
+            CHECK(vertexBuffer.getSegmentOffset() == 0);
+
+            if (!sf::VertexBuffer::isStreamRingAvailable())
+                return;
+
+            // Each update moves to the next segment and wraps around
+            CHECK(vertexBuffer.update(vertices.data()));
+            CHECK(vertexBuffer.getSegmentOffset() == 64);
+
+            const sf::VertexBuffer::UpdateRange range{vertices.data(), 8, 16};
+            CHECK(vertexBuffer.update(&range, 1));
+            CHECK(vertexBuffer.getSegmentOffset() == 128);
+
+            CHECK(vertexBuffer.update(vertices.data(), 64, 0));
+            CHECK(vertexBuffer.getSegmentOffset() == 0);
+            CHECK(vertexBuffer.getVertexCount() == 64);
+
+            // Growing the buffer starts a new ring
+            std::array<sf::Vertex, 100> moreVertices{};
+            CHECK(vertexBuffer.update(moreVertices.data(), moreVertices.size(), 0));
+            CHECK(vertexBuffer.getVertexCount() == 100);
+            CHECK(vertexBuffer.getSegmentOffset() == 100);
+
+            // Copies read the latest segment of the source
+            const sf::VertexBuffer vertexBufferCopy(vertexBuffer);
+            CHECK(vertexBufferCopy.getVertexCount() == 100);
+            CHECK(vertexBufferCopy.getSegmentOffset() == 100);
+        }
+    }
+
     SECTION("swap()")
     {
         sf::VertexBuffer vertexBuffer1(sf::PrimitiveType::LineStrip, sf::VertexBuffer::Usage::Dynamic);
@@ -0,0 +1,144 @@
+#include <SFML/System/AssetLoader.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("[System] sf::AssetLoader")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::AssetLoader>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::AssetLoader>);
+        STATIC_CHECK(!std::is_move_constructible_v<sf::AssetLoader>);
+        STATIC_CHECK(!std::is_move_assignable_v<sf::AssetLoader>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::AssetLoader loader(3);
+        CHECK(loader.getThreadCount() == 3);
+        CHECK(loader.getTaskCount() == 0);
+        CHECK(loader.getCompletedCount() == 0);
+        CHECK(loader.getProgress() == 1.f);
+
+        CHECK(sf::AssetLoader().getThreadCount() >= 1);
+    }
+
+    SECTION("load()")
+    {
+        sf::AssetLoader loader(4);
+
+        std::vector<std::future<int>> futures;
+        for (int i = 0; i < 100; ++i)
+            futures.push_back(loader.load([i] { return i * 2; }));
+
+        CHECK(loader.getTaskCount() == 100);
+        loader.wait();
+        CHECK(loader.getCompletedCount() == 100);
+        CHECK(loader.getProgress() == 1.f);
+
+        for (int i = 0; i < 100; ++i)
+            CHECK(futures[static_cast<std::size_t>(i)].get() == i * 2);
+
+        // Move-only results and functions
+        auto future = loader.load([value = std::make_unique<int>(5)] { return std::make_unique<int>(*value); });
+        CHECK(*future.get() == 5);
+
+        // Exceptions are given to the future
+        auto failed = loader.load([]() -> int { throw std::runtime_error("Failed to load"); });
+        CHECK_THROWS_AS(failed.get(), std::runtime_error);
+    }
+
+    SECTION("load() with finalizer")
+    {
+        sf::AssetLoader loader(2);
+
+        const auto               updatingThread = std::this_thread::get_id();
+        std::atomic<int>         finalizerCount = 0;
+        std::future<std::string> future         = loader.load([] { return std::string("data"); },
+                                                      [&](std::string&& data)
+                                                      {
+                                                          CHECK(std::this_thread::get_id() == updatingThread);
+                                                          ++finalizerCount;
+                                                          return data + " finalized";
+                                                      });
+
+        // Finalizers only run on the updating thread
+        while (future.wait_for(std::chrono::milliseconds(1)) != std::future_status::ready)
+            (void)loader.update();
+
+        CHECK(future.get() == "data finalized");
+        CHECK(finalizerCount == 1);
+        CHECK(loader.getProgress() == 1.f);
+
+        // Finalizers are skipped when loading fails
+        auto failed = loader.load([]() -> int { throw std::runtime_error("Failed to load"); },
+                                  [&](int&& value)
+                                  {
+                                      ++finalizerCount;
+                                      return value;
+                                  });
+        loader.wait();
+        CHECK_THROWS_AS(failed.get(), std::runtime_error);
+        CHECK(finalizerCount == 1);
+
+        // Finalizers may throw and return nothing
+        auto throwing = loader.load([] { return 1; }, [](int&&) { throw std::runtime_error("Failed to upload"); });
+        auto empty    = loader.load([] { return 1; }, [](int&&) {});
+        loader.wait();
+        CHECK_THROWS_AS(throwing.get(), std::runtime_error);
+        CHECK_NOTHROW(empty.get());
+        CHECK(loader.getCompletedCount() == 4);
+    }
+
+    SECTION("update()")
+    {
+        sf::AssetLoader loader(1);
+
+        std::vector<std::future<int>> futures;
+        for (int i = 0; i < 10; ++i)
+            futures.push_back(loader.load([i] { return i; }, [](int&& value) { return value; }));
+
+        std::size_t finalizerCount = 0;
+        while (loader.getCompletedCount() < 10)
+            finalizerCount += loader.update(sf::microseconds(1));
+
+        CHECK(finalizerCount == 10);
+        CHECK(loader.update() == 0);
+        for (int i = 0; i < 10; ++i)
+            CHECK(futures[static_cast<std::size_t>(i)].get() == i);
+    }
+
+    SECTION("Destruction")
+    {
+        std::promise<void> gate;
+        std::future<int>   abandoned;
+        std::thread        opener;
+        {
+            sf::AssetLoader loader(1);
+            (void)loader.load([future = gate.get_future()] { future.wait(); });
+            abandoned = loader.load([] { return 1; });
+
+            // Let the first task finish while the loader is being destroyed
+            opener = std::thread(
+                [&gate]
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    gate.set_value();
+                });
+        }
+        opener.join();
+
+        // Tasks which haven't started are abandoned
+        CHECK_THROWS_AS(abandoned.get(), std::future_error);
+    }
+}
@@ -0,0 +1,128 @@
+#include <SFML/System/MappedFileInputStream.hpp>
+
+// Other 1st party headers
+#include <SFML/System/Exception.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+#include <type_traits>
+
+
+TEST_CASE("[System] sf::MappedFileInputStream")
+{
+    using namespace std::string_view_literals;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::MappedFileInputStream>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::MappedFileInputStream>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::MappedFileInputStream>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::MappedFileInputStream>);
+    }
+
+    std::array<char, 32> buffer{};
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            sf::MappedFileInputStream mappedFileInputStream;
+            CHECK(mappedFileInputStream.read(nullptr, 0) == std::nullopt);
+            CHECK(mappedFileInputStream.seek(0) == std::nullopt);
+            CHECK(mappedFileInputStream.tell() == std::nullopt);
+            CHECK(mappedFileInputStream.getSize() == std::nullopt);
+            CHECK(mappedFileInputStream.getData() == nullptr);
+        }
+
+        SECTION("File path constructor")
+        {
+            sf::MappedFileInputStream mappedFileInputStream("System/test.txt");
+            CHECK(mappedFileInputStream.read(buffer.data(), 5) == 5);
+            CHECK(mappedFileInputStream.tell() == 5);
+            CHECK(mappedFileInputStream.getSize() == 12);
+            CHECK(std::string_view(buffer.data(), 5) == "Hello"sv);
+            CHECK(mappedFileInputStream.seek(6) == 6);
+            CHECK(mappedFileInputStream.tell() == 6);
+
+            CHECK_THROWS_AS(sf::MappedFileInputStream("does/not/exist.txt"), sf::Exception);
+        }
+    }
+
+    SECTION("Move semantics")
+    {
+        SECTION("Move constructor")
+        {
+            sf::MappedFileInputStream movedMappedFileInputStream("System/test.txt");
+            sf::MappedFileInputStream mappedFileInputStream = std::move(movedMappedFileInputStream);
+            CHECK(mappedFileInputStream.read(buffer.data(), 6) == 6);
+            CHECK(mappedFileInputStream.tell() == 6);
+            CHECK(mappedFileInputStream.getSize() == 12);
+            CHECK(std::string_view(buffer.data(), 6) == "Hello "sv);
+        }
+
+        SECTION("Move assignment")
+        {
+            sf::MappedFileInputStream movedMappedFileInputStream("System/test.txt");
+            sf::MappedFileInputStream mappedFileInputStream("System/test2.txt");
+            mappedFileInputStream = std::move(movedMappedFileInputStream);
+            CHECK(mappedFileInputStream.read(buffer.data(), 6) == 6);
+            CHECK(mappedFileInputStream.tell() == 6);
+            CHECK(mappedFileInputStream.getSize() == 12);
+            CHECK(std::string_view(buffer.data(), 6) == "Hello "sv);
+        }
+    }
+
+    SECTION("open()")
+    {
+        const std::u32string        filenameSuffix = GENERATE(U"", U"-ń", U"-🐌");
+        const std::filesystem::path filename       = U"System/test" + filenameSuffix + U".txt";
+        INFO("Filename: " << reinterpret_cast<const char*>(filename.u8string().c_str()));
+
+        sf::MappedFileInputStream mappedFileInputStream;
+        CHECK(mappedFileInputStream.open(filename));
+
+        CHECK(mappedFileInputStream.read(buffer.data(), 5) == 5);
+        CHECK(mappedFileInputStream.tell() == 5);
+        CHECK(mappedFileInputStream.getSize() == 12);
+        CHECK(std::string_view(buffer.data(), 5) == "Hello"sv);
+        CHECK(mappedFileInputStream.seek(6) == 6);
+        CHECK(mappedFileInputStream.tell() == 6);
+
+        // Reads stop at the end of the file
+        CHECK(mappedFileInputStream.read(buffer.data(), buffer.size()) == 6);
+        CHECK(std::string_view(buffer.data(), 6) == "world\n"sv);
+        CHECK(mappedFileInputStream.seek(100) == 12);
+        CHECK(mappedFileInputStream.read(buffer.data(), buffer.size()) == 0);
+
+        CHECK(!mappedFileInputStream.open("does/not/exist.txt"));
+        CHECK(mappedFileInputStream.getSize() == std::nullopt);
+    }
+
+    SECTION("getData()")
+    {
+        const sf::MappedFileInputStream mappedFileInputStream("System/test.txt");
+        REQUIRE(mappedFileInputStream.getData() != nullptr);
+        CHECK(std::string_view(static_cast<const char*>(mappedFileInputStream.getData()), 11) == "Hello world"sv);
+    }
+
+    SECTION("Empty file")
+    {
+        const auto filename = std::filesystem::temp_directory_path() / "empty.txt";
+        std::ofstream(filename).close();
+
+        {
+            sf::MappedFileInputStream mappedFileInputStream;
+            REQUIRE(mappedFileInputStream.open(filename));
+            CHECK(mappedFileInputStream.getData() == nullptr);
+            CHECK(mappedFileInputStream.getSize() == 0);
+            CHECK(mappedFileInputStream.read(buffer.data(), buffer.size()) == 0);
+        }
+
+        CHECK(std::filesystem::remove(filename));
+    }
+}